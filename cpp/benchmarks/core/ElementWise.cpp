@@ -0,0 +1,129 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+
+namespace open3d {
+namespace core {
+
+void BinaryEWAdd(benchmark::State& state, const Device& device) {
+    const int64_t num_elements = state.range(0);
+    Tensor lhs = Tensor::Ones({num_elements}, Dtype::Float32, device);
+    Tensor rhs = Tensor::Ones({num_elements}, Dtype::Float32, device);
+    Tensor warm_up = lhs + rhs;
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs + rhs;
+    }
+}
+
+void UnaryEWSqrt(benchmark::State& state, const Device& device) {
+    const int64_t num_elements = state.range(0);
+    Tensor src = Tensor::Ones({num_elements}, Dtype::Float32, device);
+    Tensor warm_up = src.Sqrt();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.Sqrt();
+    }
+}
+
+/// src + lhs * rhs on {N, 3} point tensors in a single pass.
+void NaryEWAddMul(benchmark::State& state, const Device& device) {
+    const int64_t num_points = state.range(0);
+    Tensor src = Tensor::Ones({num_points, 3}, Dtype::Float32, device);
+    Tensor lhs = Tensor::Ones({num_points, 3}, Dtype::Float32, device);
+    Tensor rhs = Tensor::Ones({num_points, 3}, Dtype::Float32, device);
+    Tensor warm_up = src.AddMul(lhs, rhs);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.AddMul(lhs, rhs);
+    }
+}
+
+/// Same as NaryEWAddMul, with a chain of binary ops.
+void BinaryEWAddMul(benchmark::State& state, const Device& device) {
+    const int64_t num_points = state.range(0);
+    Tensor src = Tensor::Ones({num_points, 3}, Dtype::Float32, device);
+    Tensor lhs = Tensor::Ones({num_points, 3}, Dtype::Float32, device);
+    Tensor rhs = Tensor::Ones({num_points, 3}, Dtype::Float32, device);
+    Tensor warm_up = src + lhs * rhs;
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src + lhs * rhs;
+    }
+}
+
+/// Same as BinaryEWAdd, but run from inside a single-threaded scope as done
+/// from the tasks of an external thread pool.
+void BinaryEWAddSingleThread(benchmark::State& state, const Device& device) {
+    kernel::ScopedNumThreads scoped_num_threads(1);
+    BinaryEWAdd(state, device);
+}
+
+BENCHMARK_CAPTURE(BinaryEWAdd, CPU, Device("CPU:0"))
+        ->RangeMultiplier(16)
+        ->Range(1 << 4, 1 << 24)
+        ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BinaryEWAddSingleThread, CPU, Device("CPU:0"))
+        ->RangeMultiplier(16)
+        ->Range(1 << 4, 1 << 24)
+        ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(UnaryEWSqrt, CPU, Device("CPU:0"))
+        ->RangeMultiplier(16)
+        ->Range(1 << 4, 1 << 24)
+        ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(NaryEWAddMul, CPU, Device("CPU:0"))
+        ->RangeMultiplier(16)
+        ->Range(1 << 4, 1 << 22)
+        ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BinaryEWAddMul, CPU, Device("CPU:0"))
+        ->RangeMultiplier(16)
+        ->Range(1 << 4, 1 << 22)
+        ->Unit(benchmark::kMicrosecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(BinaryEWAdd, CUDA, Device("CUDA:0"))
+        ->RangeMultiplier(16)
+        ->Range(1 << 4, 1 << 24)
+        ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(UnaryEWSqrt, CUDA, Device("CUDA:0"))
+        ->RangeMultiplier(16)
+        ->Range(1 << 4, 1 << 24)
+        ->Unit(benchmark::kMicrosecond);
+#endif
+
+}  // namespace core
+}  // namespace open3d
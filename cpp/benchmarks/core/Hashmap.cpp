@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/hashmap/Hashmap.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// Random int3 voxel coordinates in a 128^3 grid, with duplicates.
+static Tensor RandomVoxelCoords(int64_t num_keys, const Device& device) {
+    std::vector<int> coords(num_keys * 3);
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int> dist(0, 127);
+    for (auto& coord : coords) {
+        coord = dist(rng);
+    }
+    return Tensor(coords, {num_keys, 3}, Dtype::Int32, device);
+}
+
+void HashmapInsert(benchmark::State& state,
+                   const Device& device,
+                   const HashmapBackend& backend) {
+    const int64_t num_keys = state.range(0);
+    Tensor keys = RandomVoxelCoords(num_keys, device);
+    Tensor values = Tensor::Ones({num_keys}, Dtype::Int32, device);
+    Tensor addrs, masks;
+    for (auto _ : state) {
+        state.PauseTiming();
+        Hashmap hashmap(num_keys, Dtype::Int32, Dtype::Int32, {3}, {1}, device,
+                        backend);
+        state.ResumeTiming();
+
+        hashmap.Insert(keys, values, addrs, masks);
+    }
+}
+
+void HashmapFind(benchmark::State& state,
+                 const Device& device,
+                 const HashmapBackend& backend) {
+    const int64_t num_keys = state.range(0);
+    Tensor keys = RandomVoxelCoords(num_keys, device);
+    Tensor values = Tensor::Ones({num_keys}, Dtype::Int32, device);
+    Tensor addrs, masks;
+    Hashmap hashmap(num_keys, Dtype::Int32, Dtype::Int32, {3}, {1}, device,
+                    backend);
+    hashmap.Insert(keys, values, addrs, masks);
+    for (auto _ : state) {
+        hashmap.Find(keys, addrs, masks);
+    }
+}
+
+BENCHMARK_CAPTURE(HashmapInsert,
+                  TBB_CPU,
+                  Device("CPU:0"),
+                  HashmapBackend::TBB)
+        ->RangeMultiplier(16)
+        ->Range(1 << 12, 1 << 20)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(HashmapInsert,
+                  LinearProbing_CPU,
+                  Device("CPU:0"),
+                  HashmapBackend::LinearProbing)
+        ->RangeMultiplier(16)
+        ->Range(1 << 12, 1 << 20)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(HashmapFind, TBB_CPU, Device("CPU:0"), HashmapBackend::TBB)
+        ->RangeMultiplier(16)
+        ->Range(1 << 12, 1 << 20)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(HashmapFind,
+                  LinearProbing_CPU,
+                  Device("CPU:0"),
+                  HashmapBackend::LinearProbing)
+        ->RangeMultiplier(16)
+        ->Range(1 << 12, 1 << 20)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(HashmapInsert,
+                  Slab_CUDA,
+                  Device("CUDA:0"),
+                  HashmapBackend::Slab)
+        ->RangeMultiplier(16)
+        ->Range(1 << 12, 1 << 20)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(HashmapFind,
+                  Slab_CUDA,
+                  Device("CUDA:0"),
+                  HashmapBackend::Slab)
+        ->RangeMultiplier(16)
+        ->Range(1 << 12, 1 << 20)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,70 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/MemoryManager.h"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "open3d/core/Device.h"
+
+namespace open3d {
+namespace core {
+
+/// Allocates and frees a batch of temporaries of the same size, as Tensor
+/// kernels do in every iteration of a pipeline.
+template <class MemoryManagerType>
+void MallocFree(benchmark::State& state) {
+    const Device device("CPU:0");
+    const size_t byte_size = state.range(0);
+    MemoryManagerType mm;
+    std::vector<void*> ptrs(16);
+    for (auto _ : state) {
+        for (void*& ptr : ptrs) {
+            ptr = mm.Malloc(byte_size, device);
+            // Touch the memory so that fresh pages are paid for.
+            static_cast<char*>(ptr)[0] = 0;
+            static_cast<char*>(ptr)[byte_size - 1] = 0;
+        }
+        for (void* ptr : ptrs) {
+            mm.Free(ptr, device);
+        }
+    }
+    CPUCachedMemoryManager::ReleaseCache();
+}
+
+BENCHMARK_TEMPLATE(MallocFree, CPUMemoryManager)
+        ->RangeMultiplier(16)
+        ->Range(1 << 10, 1 << 26)
+        ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(MallocFree, CPUCachedMemoryManager)
+        ->RangeMultiplier(16)
+        ->Range(1 << 10, 1 << 26)
+        ->Unit(benchmark::kMicrosecond);
+
+}  // namespace core
+}  // namespace open3d
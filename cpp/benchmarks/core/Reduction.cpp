@@ -26,12 +26,15 @@
 
 #include <benchmark/benchmark.h>
 
+#include <functional>
+
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/Kernel.h"
+#include "open3d/core/kernel/ParallelUtil.h"
 
 namespace open3d {
 namespace core {
@@ -50,6 +53,66 @@ void Reduction(benchmark::State& state, const Device& device) {
 BENCHMARK_CAPTURE(Reduction, CPU, Device("CPU:0"))
         ->Unit(benchmark::kMillisecond);
 
+/// Reduces a {N, 3} tensor along dim 0, e.g. to compute the centroid or the
+/// bounds of a point cloud, with state.range(0) threads.
+void ReductionFewOutputs(benchmark::State& state,
+                         const Device& device,
+                         const std::function<Tensor(const Tensor&)>& op) {
+    kernel::ScopedNumThreads scoped_num_threads(
+            static_cast<int>(state.range(0)));
+    Tensor src = Tensor::Ones({1 << 23, 3}, Dtype::Float32, device);
+    Tensor warm_up = op(src);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = op(src);
+    }
+}
+
+BENCHMARK_CAPTURE(ReductionFewOutputs,
+                  Sum_CPU,
+                  Device("CPU:0"),
+                  [](const Tensor& src) { return src.Sum({0}); })
+        ->RangeMultiplier(2)
+        ->Range(1, 32)
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(ReductionFewOutputs,
+                  Min_CPU,
+                  Device("CPU:0"),
+                  [](const Tensor& src) { return src.Min({0}); })
+        ->RangeMultiplier(2)
+        ->Range(1, 32)
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(ReductionFewOutputs,
+                  Max_CPU,
+                  Device("CPU:0"),
+                  [](const Tensor& src) { return src.Max({0}); })
+        ->RangeMultiplier(2)
+        ->Range(1, 32)
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(ReductionFewOutputs,
+                  ArgMin_CPU,
+                  Device("CPU:0"),
+                  [](const Tensor& src) { return src.ArgMin({0}); })
+        ->RangeMultiplier(2)
+        ->Range(1, 32)
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(ReductionFewOutputs,
+                  ArgMax_CPU,
+                  Device("CPU:0"),
+                  [](const Tensor& src) { return src.ArgMax({0}); })
+        ->RangeMultiplier(2)
+        ->Range(1, 32)
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+
 #ifdef BUILD_CUDA_MODULE
 BENCHMARK_CAPTURE(Reduction, CUDA, Device("CUDA:0"))
         ->Unit(benchmark::kMillisecond);
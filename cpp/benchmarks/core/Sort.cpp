@@ -0,0 +1,100 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+
+namespace open3d {
+namespace core {
+
+/// Runs op on 2^22 random keys in [0, 2^16), such as hashed voxel
+/// coordinates, with state.range(0) threads.
+void SortKeys(benchmark::State& state,
+              const Device& device,
+              const std::function<void(const Tensor&)>& op) {
+    kernel::ScopedNumThreads scoped_num_threads(
+            static_cast<int>(state.range(0)));
+    const int64_t n = 1 << 22;
+    std::vector<int64_t> vals(n);
+    for (int64_t i = 0; i < n; i++) {
+        vals[i] = (i * 2654435761LL) % (1 << 16);
+    }
+    Tensor keys(vals, {n}, Dtype::Int64, device);
+    op(keys);
+    for (auto _ : state) {
+        op(keys);
+    }
+}
+
+BENCHMARK_CAPTURE(SortKeys,
+                  Sort_CPU,
+                  Device("CPU:0"),
+                  [](const Tensor& keys) { keys.Sort(); })
+        ->RangeMultiplier(2)
+        ->Range(1, 32)
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(SortKeys,
+                  ArgSort_CPU,
+                  Device("CPU:0"),
+                  [](const Tensor& keys) { keys.ArgSort(); })
+        ->RangeMultiplier(2)
+        ->Range(1, 32)
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(SortKeys,
+                  Unique_CPU,
+                  Device("CPU:0"),
+                  [](const Tensor& keys) { keys.Unique(); })
+        ->RangeMultiplier(2)
+        ->Range(1, 32)
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+
+/// Concatenates 16 point clouds of 2^18 points each.
+void Cat(benchmark::State& state, const Device& device) {
+    std::vector<Tensor> tensors(16, Tensor::Ones({1 << 18, 3}, Dtype::Float32,
+                                                 device));
+    Tensor warm_up = Tensor::Cat(tensors);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = Tensor::Cat(tensors);
+    }
+}
+
+BENCHMARK_CAPTURE(Cat, CPU, Device("CPU:0"))->Unit(benchmark::kMillisecond);
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,75 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/TensorExpr.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// Sum of squared point-to-plane residuals of {N, 3} correspondences, with
+/// the regular Tensor operations.
+void PointToPlaneErrorEager(benchmark::State& state, const Device& device) {
+    int64_t n = state.range(0);
+    Tensor source = Tensor::Ones({n, 3}, Dtype::Float32, device);
+    Tensor target = Tensor::Zeros({n, 3}, Dtype::Float32, device);
+    Tensor normals = Tensor::Ones({n, 3}, Dtype::Float32, device);
+    for (auto _ : state) {
+        Tensor error = (source - target).Mul_(normals);
+        error.Mul_(error);
+        Tensor dst = error.Sum({0, 1});
+    }
+}
+
+/// Same as PointToPlaneErrorEager, in one pass with TensorExpr.
+void PointToPlaneErrorFused(benchmark::State& state, const Device& device) {
+    int64_t n = state.range(0);
+    Tensor source = Tensor::Ones({n, 3}, Dtype::Float32, device);
+    Tensor target = Tensor::Zeros({n, 3}, Dtype::Float32, device);
+    Tensor normals = Tensor::Ones({n, 3}, Dtype::Float32, device);
+    for (auto _ : state) {
+        TensorExpr error = (TensorExpr(source) - target) * normals;
+        Tensor dst = (error * error).Sum({0, 1});
+    }
+}
+
+BENCHMARK_CAPTURE(PointToPlaneErrorEager, CPU, Device("CPU:0"))
+        ->RangeMultiplier(16)
+        ->Range(1 << 4, 1 << 22)
+        ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(PointToPlaneErrorFused, CPU, Device("CPU:0"))
+        ->RangeMultiplier(16)
+        ->Range(1 << 4, 1 << 22)
+        ->Unit(benchmark::kMicrosecond);
+
+}  // namespace core
+}  // namespace open3d
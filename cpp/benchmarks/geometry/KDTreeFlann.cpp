@@ -27,6 +27,7 @@
 #include "open3d/geometry/KDTreeFlann.h"
 
 #include <benchmark/benchmark.h>
+#include <random>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
@@ -96,5 +97,99 @@ BENCHMARK(BM_TestKDTreeLine0)
         ->MinTime(0.1)
         ->Ranges({{1 << 0, 1 << 14}, {1 << 16, 1 << 22}});
 
+// Random points in a 100m cube, shared by the DataStorage benchmarks.
+static const geometry::PointCloud& GetRandomPointCloud(int size) {
+    static geometry::PointCloud pc;
+    if (int(pc.points_.size()) != size) {
+        std::mt19937 rng(0);
+        std::uniform_real_distribution<double> dist(0.0, 100.0);
+        pc.points_.resize(size);
+        for (Eigen::Vector3d& point : pc.points_) {
+            point = {dist(rng), dist(rng), dist(rng)};
+        }
+    }
+    return pc;
+}
+
+static void BM_KDTreeFlannBuild(
+        benchmark::State& state,
+        geometry::KDTreeFlann::DataStorage storage) {
+    const geometry::PointCloud& pc = GetRandomPointCloud(state.range(0));
+    for (auto _ : state) {
+        geometry::KDTreeFlann kdtree(pc, storage);
+        benchmark::DoNotOptimize(kdtree);
+    }
+}
+
+static void BM_KDTreeFlannSearchKNN(
+        benchmark::State& state,
+        geometry::KDTreeFlann::DataStorage storage) {
+    const geometry::PointCloud& pc = GetRandomPointCloud(state.range(0));
+    geometry::KDTreeFlann kdtree(pc, storage);
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    size_t query_idx = 0;
+    for (auto _ : state) {
+        kdtree.SearchKNN(pc.points_[query_idx], 10, indices, distance2);
+        query_idx = (query_idx + 7919) % pc.points_.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_KDTreeFlannSearchRadius(
+        benchmark::State& state,
+        geometry::KDTreeFlann::DataStorage storage) {
+    const geometry::PointCloud& pc = GetRandomPointCloud(state.range(0));
+    geometry::KDTreeFlann kdtree(pc, storage);
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    size_t query_idx = 0;
+    for (auto _ : state) {
+        kdtree.SearchRadius(pc.points_[query_idx], 1.5, indices, distance2);
+        query_idx = (query_idx + 7919) % pc.points_.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_CAPTURE(BM_KDTreeFlannBuild,
+                  Copy,
+                  geometry::KDTreeFlann::DataStorage::Copy)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_KDTreeFlannBuild,
+                  Reference,
+                  geometry::KDTreeFlann::DataStorage::Reference)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_KDTreeFlannBuild,
+                  Float,
+                  geometry::KDTreeFlann::DataStorage::Float)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_KDTreeFlannSearchKNN,
+                  Copy,
+                  geometry::KDTreeFlann::DataStorage::Copy)
+        ->Arg(1 << 20);
+BENCHMARK_CAPTURE(BM_KDTreeFlannSearchKNN,
+                  Reference,
+                  geometry::KDTreeFlann::DataStorage::Reference)
+        ->Arg(1 << 20);
+BENCHMARK_CAPTURE(BM_KDTreeFlannSearchKNN,
+                  Float,
+                  geometry::KDTreeFlann::DataStorage::Float)
+        ->Arg(1 << 20);
+BENCHMARK_CAPTURE(BM_KDTreeFlannSearchRadius,
+                  Copy,
+                  geometry::KDTreeFlann::DataStorage::Copy)
+        ->Arg(1 << 20);
+BENCHMARK_CAPTURE(BM_KDTreeFlannSearchRadius,
+                  Reference,
+                  geometry::KDTreeFlann::DataStorage::Reference)
+        ->Arg(1 << 20);
+BENCHMARK_CAPTURE(BM_KDTreeFlannSearchRadius,
+                  Float,
+                  geometry::KDTreeFlann::DataStorage::Float)
+        ->Arg(1 << 20);
+
 }  // namespace benchmarks
 }  // namespace open3d
@@ -0,0 +1,82 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/PointCloud.h"
+
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace open3d {
+namespace benchmarks {
+
+// Random points in a 100m cube with colors and normals.
+static geometry::PointCloud CreateRandomPointCloud(int size) {
+    geometry::PointCloud pc;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> dist(0.0, 100.0);
+    pc.points_.resize(size);
+    pc.colors_.resize(size);
+    pc.normals_.resize(size);
+    for (int i = 0; i < size; ++i) {
+        pc.points_[i] = {dist(rng), dist(rng), dist(rng)};
+        pc.colors_[i] = pc.points_[i] / 100.0;
+        pc.normals_[i] = pc.points_[i].normalized();
+    }
+    return pc;
+}
+
+static void BM_VoxelDownSample(benchmark::State& state) {
+    geometry::PointCloud pc = CreateRandomPointCloud(state.range(0));
+    for (auto _ : state) {
+        std::shared_ptr<geometry::PointCloud> pc_down =
+                pc.VoxelDownSample(0.5);
+        benchmark::DoNotOptimize(pc_down);
+    }
+}
+
+static void BM_VoxelDownSampleAndTrace(benchmark::State& state) {
+    geometry::PointCloud pc = CreateRandomPointCloud(state.range(0));
+    for (auto _ : state) {
+        auto pc_down_trace = pc.VoxelDownSampleAndTrace(
+                0.5, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(100, 100, 100));
+        benchmark::DoNotOptimize(pc_down_trace);
+    }
+}
+
+BENCHMARK(BM_VoxelDownSample)
+        ->Arg(1000000)
+        ->Arg(10000000)
+        ->Arg(50000000)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_VoxelDownSampleAndTrace)
+        ->Arg(1000000)
+        ->Arg(10000000)
+        ->Arg(50000000)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
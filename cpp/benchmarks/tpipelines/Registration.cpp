@@ -0,0 +1,136 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Registration.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+// Samples a smooth wavy surface, so that the ICP problem is well conditioned.
+static geometry::PointCloud CreateWavySurface(int64_t num_points,
+                                              const core::Device& device) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> points(num_points * 3);
+    for (int64_t i = 0; i < num_points; ++i) {
+        float x = dist(rng);
+        float y = dist(rng);
+        points[i * 3 + 0] = x;
+        points[i * 3 + 1] = y;
+        points[i * 3 + 2] = 0.2f * std::sin(3.0f * x) * std::cos(2.0f * y);
+    }
+    geometry::PointCloud pcd(device);
+    pcd.SetPoints(core::Tensor(points, {num_points, 3}, core::Dtype::Float32,
+                               device));
+    return pcd;
+}
+
+static core::Tensor CreateInitTransformation(const core::Device& device) {
+    const float c = std::cos(0.05f);
+    const float s = std::sin(0.05f);
+    std::vector<float> init{c,    -s,   0.0f, 0.02f, s,    c,    0.0f, -0.01f,
+                            0.0f, 0.0f, 1.0f, 0.01f, 0.0f, 0.0f, 0.0f, 1.0f};
+    return core::Tensor(init, {4, 4}, core::Dtype::Float32, device);
+}
+
+// Rebuilds the target index once per RegistrationICP call.
+static void RegistrationICPPointToPoint(benchmark::State& state,
+                                        const core::Device& device) {
+    int max_iterations = static_cast<int>(state.range(0));
+    geometry::PointCloud target = CreateWavySurface(100000, device);
+    geometry::PointCloud source = CreateWavySurface(50000, device);
+    core::Tensor init = CreateInitTransformation(device);
+    // Only max_iterations stops the loop, so that each run does the same work.
+    ICPConvergenceCriteria criteria(-1.0, -1.0, max_iterations);
+
+    // Warm up.
+    RegistrationResult result =
+            RegistrationICP(source, target, 0.1, init,
+                            TransformationEstimationPointToPoint(), criteria);
+
+    for (auto _ : state) {
+        result = RegistrationICP(source, target, 0.1, init,
+                                 TransformationEstimationPointToPoint(),
+                                 criteria);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+// Reuses a target index built once outside of the timed loop, as done when
+// registering many scans against the same map.
+static void RegistrationICPPointToPointReuseIndex(benchmark::State& state,
+                                                  const core::Device& device) {
+    int max_iterations = static_cast<int>(state.range(0));
+    geometry::PointCloud target = CreateWavySurface(100000, device);
+    geometry::PointCloud source = CreateWavySurface(50000, device);
+    core::Tensor init = CreateInitTransformation(device);
+    ICPConvergenceCriteria criteria(-1.0, -1.0, max_iterations);
+
+    core::nns::NearestNeighborSearch target_nns(target.GetPoints());
+    target_nns.HybridIndex();
+
+    // Warm up.
+    RegistrationResult result = RegistrationICP(
+            source, target, target_nns, 0.1, init,
+            TransformationEstimationPointToPoint(), criteria);
+
+    for (auto _ : state) {
+        result = RegistrationICP(source, target, target_nns, 0.1, init,
+                                 TransformationEstimationPointToPoint(),
+                                 criteria);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+BENCHMARK_CAPTURE(RegistrationICPPointToPoint, CPU, core::Device("CPU:0"))
+        ->Arg(1)
+        ->Arg(10)
+        ->Arg(30)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(RegistrationICPPointToPointReuseIndex,
+                  CPU,
+                  core::Device("CPU:0"))
+        ->Arg(1)
+        ->Arg(10)
+        ->Arg(30)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
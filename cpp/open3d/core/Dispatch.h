@@ -54,6 +54,15 @@
         } else if (DTYPE == open3d::core::Dtype::Float64) { \
             using scalar_t = double;                        \
             return __VA_ARGS__();                           \
+        } else if (DTYPE == open3d::core::Dtype::Float16) { \
+            using scalar_t = open3d::core::Float16;         \
+            return __VA_ARGS__();                           \
+        } else if (DTYPE == open3d::core::Dtype::Int8) {    \
+            using scalar_t = int8_t;                        \
+            return __VA_ARGS__();                           \
+        } else if (DTYPE == open3d::core::Dtype::Int16) {   \
+            using scalar_t = int16_t;                       \
+            return __VA_ARGS__();                           \
         } else if (DTYPE == open3d::core::Dtype::Int32) {   \
             using scalar_t = int32_t;                       \
             return __VA_ARGS__();                           \
@@ -66,6 +75,9 @@
         } else if (DTYPE == open3d::core::Dtype::UInt16) {  \
             using scalar_t = uint16_t;                      \
             return __VA_ARGS__();                           \
+        } else if (DTYPE == open3d::core::Dtype::UInt32) {  \
+            using scalar_t = uint32_t;                      \
+            return __VA_ARGS__();                           \
         } else {                                            \
             utility::LogError("Unsupported data type.");    \
         }                                                   \
@@ -31,6 +31,7 @@
 
 #include "open3d/Macro.h"
 #include "open3d/core/Dispatch.h"
+#include "open3d/core/Float16.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -39,12 +40,16 @@ namespace core {
 class OPEN3D_API Dtype {
 public:
     static const Dtype Undefined;
+    static const Dtype Float16;
     static const Dtype Float32;
     static const Dtype Float64;
+    static const Dtype Int8;
+    static const Dtype Int16;
     static const Dtype Int32;
     static const Dtype Int64;
     static const Dtype UInt8;
     static const Dtype UInt16;
+    static const Dtype UInt32;
     static const Dtype Bool;
 
 public:
@@ -87,6 +92,11 @@ private:
     char name_[max_name_len_];  // MSVC warns if std::string is exported to DLL.
 };
 
+template <>
+inline const Dtype Dtype::FromType<Float16>() {
+    return Dtype::Float16;
+}
+
 template <>
 inline const Dtype Dtype::FromType<float>() {
     return Dtype::Float32;
@@ -97,6 +107,16 @@ inline const Dtype Dtype::FromType<double>() {
     return Dtype::Float64;
 }
 
+template <>
+inline const Dtype Dtype::FromType<int8_t>() {
+    return Dtype::Int8;
+}
+
+template <>
+inline const Dtype Dtype::FromType<int16_t>() {
+    return Dtype::Int16;
+}
+
 template <>
 inline const Dtype Dtype::FromType<int32_t>() {
     return Dtype::Int32;
@@ -117,6 +137,11 @@ inline const Dtype Dtype::FromType<uint16_t>() {
     return Dtype::UInt16;
 }
 
+template <>
+inline const Dtype Dtype::FromType<uint32_t>() {
+    return Dtype::UInt32;
+}
+
 template <>
 inline const Dtype Dtype::FromType<bool>() {
     return Dtype::Bool;
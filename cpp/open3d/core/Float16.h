@@ -0,0 +1,186 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <fmt/format.h>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "open3d/core/CUDAUtils.h"
+
+namespace open3d {
+namespace core {
+
+/// IEEE 754 binary16 storage type.
+///
+/// Float16 only defines storage and conversion: it converts implicitly to and
+/// from float, so arithmetic and comparisons are carried out in float32 and
+/// rounded back (round-to-nearest-even) when the result is stored.
+class Float16 {
+public:
+    Float16() = default;
+
+    OPEN3D_HOST_DEVICE Float16(float value) : bits_(FloatToBits(value)) {}
+
+    OPEN3D_HOST_DEVICE operator float() const { return BitsToFloat(bits_); }
+
+    OPEN3D_HOST_DEVICE Float16& operator+=(float rhs) {
+        return *this = Float16(static_cast<float>(*this) + rhs);
+    }
+    OPEN3D_HOST_DEVICE Float16& operator-=(float rhs) {
+        return *this = Float16(static_cast<float>(*this) - rhs);
+    }
+    OPEN3D_HOST_DEVICE Float16& operator*=(float rhs) {
+        return *this = Float16(static_cast<float>(*this) * rhs);
+    }
+    OPEN3D_HOST_DEVICE Float16& operator/=(float rhs) {
+        return *this = Float16(static_cast<float>(*this) / rhs);
+    }
+
+    /// Raw binary16 bit pattern.
+    OPEN3D_HOST_DEVICE uint16_t Bits() const { return bits_; }
+
+    static constexpr OPEN3D_HOST_DEVICE Float16 FromBits(uint16_t bits) {
+        return Float16(bits, BitsTag());
+    }
+
+private:
+    struct BitsTag {};
+    constexpr OPEN3D_HOST_DEVICE Float16(uint16_t bits, BitsTag)
+        : bits_(bits) {}
+
+    static OPEN3D_HOST_DEVICE uint16_t FloatToBits(float value) {
+        uint32_t f;
+        std::memcpy(&f, &value, sizeof(f));
+        const uint32_t sign = (f >> 16) & 0x8000u;
+        const uint32_t abs = f & 0x7fffffffu;
+        uint32_t h;
+        if (abs >= 0x7f800000u) {
+            // Inf stays inf, NaN stays a (quiet) NaN.
+            h = abs > 0x7f800000u ? 0x7e00u : 0x7c00u;
+        } else if (abs >= 0x477ff000u) {
+            // Rounds to a magnitude above 65504.
+            h = 0x7c00u;
+        } else if (abs < 0x38800000u) {
+            // Subnormal half, or zero when below half of the smallest one.
+            if (abs < 0x33000000u) {
+                h = 0;
+            } else {
+                const uint32_t exp = abs >> 23;
+                const uint32_t mant = (abs & 0x7fffffu) | 0x800000u;
+                const uint32_t shift = 126 - exp;
+                h = mant >> shift;
+                const uint32_t rem = mant & ((1u << shift) - 1);
+                const uint32_t half = 1u << (shift - 1);
+                if (rem > half || (rem == half && (h & 1u))) {
+                    ++h;
+                }
+            }
+        } else {
+            h = (abs >> 13) - (112u << 10);
+            const uint32_t rem = abs & 0x1fffu;
+            if (rem > 0x1000u || (rem == 0x1000u && (h & 1u))) {
+                ++h;
+            }
+        }
+        return static_cast<uint16_t>(sign | h);
+    }
+
+    static OPEN3D_HOST_DEVICE float BitsToFloat(uint16_t bits) {
+        const uint32_t sign = static_cast<uint32_t>(bits & 0x8000u) << 16;
+        uint32_t exp = (bits >> 10) & 0x1fu;
+        uint32_t mant = bits & 0x3ffu;
+        uint32_t f;
+        if (exp == 0x1fu) {
+            f = sign | 0x7f800000u | (mant << 13);
+        } else if (exp != 0) {
+            f = sign | ((exp + 112u) << 23) | (mant << 13);
+        } else if (mant == 0) {
+            f = sign;
+        } else {
+            // Normalize the subnormal half.
+            exp = 113;
+            while ((mant & 0x400u) == 0) {
+                mant <<= 1;
+                --exp;
+            }
+            f = sign | (exp << 23) | ((mant & 0x3ffu) << 13);
+        }
+        float value;
+        std::memcpy(&value, &f, sizeof(value));
+        return value;
+    }
+
+    uint16_t bits_;
+};
+
+static_assert(sizeof(Float16) == 2, "Float16 must be 2 bytes.");
+
+}  // namespace core
+}  // namespace open3d
+
+namespace std {
+
+template <>
+class numeric_limits<open3d::core::Float16> {
+    using Float16 = open3d::core::Float16;
+
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr int digits = 11;
+    static constexpr int max_exponent = 16;
+    static constexpr int min_exponent = -13;
+
+    static constexpr Float16 min() { return Float16::FromBits(0x0400); }
+    static constexpr Float16 max() { return Float16::FromBits(0x7bff); }
+    static constexpr Float16 lowest() { return Float16::FromBits(0xfbff); }
+    static constexpr Float16 epsilon() { return Float16::FromBits(0x1400); }
+    static constexpr Float16 infinity() { return Float16::FromBits(0x7c00); }
+    static constexpr Float16 quiet_NaN() { return Float16::FromBits(0x7e00); }
+};
+
+}  // namespace std
+
+namespace fmt {
+
+template <>
+struct formatter<open3d::core::Float16> : formatter<float> {
+    template <typename FormatContext>
+    auto format(const open3d::core::Float16& value, FormatContext& ctx)
+            -> decltype(ctx.out()) {
+        return formatter<float>::format(static_cast<float>(value), ctx);
+    }
+};
+
+}  // namespace fmt
@@ -42,12 +42,27 @@ class Indexer;
 
 class IndexerIterator;
 
+// The limits below size the fixed arrays of TensorRef and Indexer. They can
+// be raised at build time with the INDEXER_MAX_DIMS CMake option. With CUDA,
+// the Indexer is copied by value into kernels and must stay within the 4KB
+// kernel parameter limit, which is checked below the Indexer class.
+#ifndef OPEN3D_INDEXER_MAX_DIMS
+#define OPEN3D_INDEXER_MAX_DIMS 10
+#endif
+
+#ifndef OPEN3D_INDEXER_MAX_INPUTS
+#define OPEN3D_INDEXER_MAX_INPUTS OPEN3D_INDEXER_MAX_DIMS
+#endif
+
 // Maximum number of dimensions of TensorRef.
-static constexpr int64_t MAX_DIMS = 10;
+static constexpr int64_t MAX_DIMS = OPEN3D_INDEXER_MAX_DIMS;
+static_assert(MAX_DIMS >= 10, "MAX_DIMS must be >= 10.");
 
 // Maximum number of inputs of an op.
 // MAX_INPUTS shall be >= MAX_DIMS to support advanced indexing.
-static constexpr int64_t MAX_INPUTS = 10;
+static constexpr int64_t MAX_INPUTS = OPEN3D_INDEXER_MAX_INPUTS;
+static_assert(MAX_INPUTS >= MAX_DIMS,
+              "MAX_INPUTS must be >= MAX_DIMS for advanced indexing.");
 
 // Maximum number of outputs of an op. This number can be increased when
 // necessary.
@@ -527,6 +542,12 @@ protected:
     bool accumulate_ = false;
 };
 
+#ifdef BUILD_CUDA_MODULE
+static_assert(sizeof(Indexer) <= 4096,
+              "Indexer exceeds the CUDA kernel parameter limit, reduce "
+              "OPEN3D_INDEXER_MAX_DIMS or OPEN3D_INDEXER_MAX_INPUTS.");
+#endif
+
 class IndexerIterator {
 public:
     struct Iterator {
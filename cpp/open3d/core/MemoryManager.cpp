@@ -26,6 +26,7 @@
 
 #include "open3d/core/MemoryManager.h"
 
+#include <cstdlib>
 #include <numeric>
 #include <unordered_map>
 
@@ -93,14 +94,29 @@ void MemoryManager::MemcpyToHost(void* host_ptr,
     Memcpy(host_ptr, Device("CPU:0"), src_ptr, src_device, num_bytes);
 }
 
+/// Selects the CPU memory manager from the environment variable
+/// OPEN3D_CPU_MEMORY_MANAGER ("simple" or "cached"), defaulting to "simple".
+static std::shared_ptr<DeviceMemoryManager> MakeCPUMemoryManager() {
+    const char* env = std::getenv("OPEN3D_CPU_MEMORY_MANAGER");
+    const std::string name = env ? env : "simple";
+    if (name == "cached") {
+        return std::make_shared<CPUCachedMemoryManager>();
+    } else if (name != "simple") {
+        utility::LogWarning(
+                "Unknown OPEN3D_CPU_MEMORY_MANAGER {}, using the simple CPU "
+                "memory manager.",
+                name);
+    }
+    return std::make_shared<CPUMemoryManager>();
+}
+
 std::shared_ptr<DeviceMemoryManager> MemoryManager::GetDeviceMemoryManager(
         const Device& device) {
     static std::unordered_map<Device::DeviceType,
                               std::shared_ptr<DeviceMemoryManager>,
                               utility::hash_enum_class>
             map_device_type_to_memory_manager = {
-                    {Device::DeviceType::CPU,
-                     std::make_shared<CPUMemoryManager>()},
+                    {Device::DeviceType::CPU, MakeCPUMemoryManager()},
 #ifdef BUILD_CUDA_MODULE
 #ifdef BUILD_CACHED_CUDA_MANAGER
                     {Device::DeviceType::CUDA,
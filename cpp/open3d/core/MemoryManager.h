@@ -88,6 +88,56 @@ public:
                 size_t num_bytes) override;
 };
 
+/// Statistics of the CPUCachedMemoryManager.
+struct CPUCachedMemoryStatistics {
+    /// Number of Malloc calls served from the cache.
+    size_t num_hits_ = 0;
+    /// Number of Malloc calls that allocated new memory from the system.
+    size_t num_misses_ = 0;
+    /// Number of bytes currently held by the cache.
+    size_t cached_bytes_ = 0;
+};
+
+/// CPU memory manager that caches freed blocks for reuse.
+///
+/// Requests are rounded up to size classes (four classes per power of two)
+/// and aligned to 64 bytes. Freed blocks are kept in a small per-thread cache
+/// and a shared pool, and are returned to the system by ReleaseCache() or
+/// when the cache exceeds its limit. Requests larger than the largest size
+/// class are not cached.
+///
+/// The CPU memory manager is chosen once, on first use: the cached manager is
+/// used only if the environment variable OPEN3D_CPU_MEMORY_MANAGER is set to
+/// "cached", otherwise CPUMemoryManager is used.
+class CPUCachedMemoryManager : public DeviceMemoryManager {
+public:
+    CPUCachedMemoryManager();
+    void* Malloc(size_t byte_size, const Device& device) override;
+    void Free(void* ptr, const Device& device) override;
+    void Memcpy(void* dst_ptr,
+                const Device& dst_device,
+                const void* src_ptr,
+                const Device& src_device,
+                size_t num_bytes) override;
+
+public:
+    /// Returns all cached blocks to the system.
+    static void ReleaseCache();
+
+    /// Returns cached blocks to the system until at most \p max_cached_bytes
+    /// remain in the cache.
+    static void TrimCache(size_t max_cached_bytes);
+
+    /// Sets the maximum number of bytes kept in the cache. Blocks freed beyond
+    /// this limit are returned to the system. The default is 1 GiB.
+    static void SetMaxCachedBytes(size_t max_cached_bytes);
+
+    static CPUCachedMemoryStatistics GetStatistics();
+
+    /// Resets the hit and miss counters.
+    static void ResetStatistics();
+};
+
 #ifdef BUILD_CUDA_MODULE
 class CUDASimpleMemoryManager : public DeviceMemoryManager {
 public:
@@ -0,0 +1,361 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#include "open3d/core/MemoryManager.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+
+namespace {
+
+/// Alignment of the returned pointers in bytes.
+constexpr size_t kAlignment = 64;
+/// Every block starts with a header that records its size class. The header
+/// is padded to the alignment so that the returned pointer stays aligned.
+/// This doubles the footprint of the smallest (64 byte) blocks, but the
+/// overhead is below 7% from 1 KB on, and Tensor buffers are rarely smaller.
+/// A 16 byte header would only give 16 byte aligned pointers, which is not
+/// enough for aligned SIMD loads of whole cache lines.
+constexpr size_t kHeaderSize = kAlignment;
+/// Requests up to 2^kLog2MaxClassSize bytes are cached.
+constexpr int kLog2MaxClassSize = 28;
+/// Blocks up to 2^kLog2MaxThreadClassSize bytes are cached per thread.
+constexpr int kLog2MaxThreadClassSize = 20;
+/// Maximum number of blocks per size class in a thread cache.
+constexpr size_t kMaxThreadCacheBlocks = 8;
+
+/// Size classes: 64 bytes, then four classes per power of two.
+constexpr int kNumBins = 1 + (kLog2MaxClassSize - 6) * 4;
+constexpr int kNumThreadBins = 1 + (kLog2MaxThreadClassSize - 6) * 4;
+
+struct BlockHeader {
+    size_t size_;  // Size of the block without the header.
+    int bin_;      // Size class, -1 for blocks that are not cached.
+};
+static_assert(sizeof(BlockHeader) <= kHeaderSize, "Header too large.");
+
+/// Returns the size class of \p byte_size, or -1 if the size is not cached.
+/// The size of the block to allocate is written to \p block_size.
+inline int SizeToBin(size_t byte_size, size_t* block_size) {
+    if (byte_size <= 64) {
+        *block_size = 64;
+        return 0;
+    }
+    // byte_size is in (2^k, 2^(k+1)].
+    int k = 0;
+    for (size_t s = byte_size - 1; s >>= 1;) {
+        ++k;
+    }
+    if (k >= kLog2MaxClassSize) {
+        *block_size = (byte_size + kAlignment - 1) / kAlignment * kAlignment;
+        return -1;
+    }
+    const size_t step = size_t(1) << (k - 2);
+    const size_t j = (byte_size - (size_t(1) << k) + step - 1) / step;
+    *block_size = (size_t(1) << k) + j * step;
+    return 1 + (k - 6) * 4 + int(j) - 1;
+}
+
+inline void* SystemMalloc(size_t byte_size) {
+#ifdef _WIN32
+    return _aligned_malloc(byte_size, kAlignment);
+#else
+    void* ptr = nullptr;
+    if (posix_memalign(&ptr, kAlignment, byte_size) != 0) {
+        return nullptr;
+    }
+    return ptr;
+#endif
+}
+
+inline void SystemFree(void* ptr) {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+inline BlockHeader* GetHeader(void* base) {
+    return static_cast<BlockHeader*>(base);
+}
+
+// Singleton cacher.
+// Freed blocks are kept in per size class free lists, first in a small cache
+// of the freeing thread and then in a shared pool. Malloc calls first look in
+// the cache of the calling thread, then in the shared pool. The thread caches
+// make the common case of a kernel allocating and releasing temporaries of the
+// same size lock free in practice; their mutexes are only contended when the
+// cache is trimmed.
+class CPUCacher {
+public:
+    static CPUCacher& GetInstance() {
+        // Never destroyed: Tensors with static storage duration may be freed
+        // after the destruction of other static objects.
+        static CPUCacher* instance = new CPUCacher();
+        return *instance;
+    }
+
+    void* Malloc(size_t byte_size) {
+        size_t block_size;
+        const int bin = SizeToBin(byte_size, &block_size);
+
+        void* base = nullptr;
+        if (bin >= 0) {
+            base = PopCached(bin);
+        }
+        if (base != nullptr) {
+            num_hits_.fetch_add(1, std::memory_order_relaxed);
+            cached_bytes_.fetch_sub(block_size, std::memory_order_relaxed);
+        } else {
+            num_misses_.fetch_add(1, std::memory_order_relaxed);
+            base = SystemMalloc(kHeaderSize + block_size);
+            if (base == nullptr) {
+                // Give the cached memory back and try again.
+                Trim(0);
+                base = SystemMalloc(kHeaderSize + block_size);
+            }
+            if (base == nullptr) {
+                utility::LogError("CPU malloc failed");
+            }
+            GetHeader(base)->size_ = block_size;
+            GetHeader(base)->bin_ = bin;
+        }
+        return static_cast<char*>(base) + kHeaderSize;
+    }
+
+    void Free(void* ptr) {
+        void* base = static_cast<char*>(ptr) - kHeaderSize;
+        const BlockHeader* header = GetHeader(base);
+        const int bin = header->bin_;
+        const size_t block_size = header->size_;
+        if (bin < 0 || cached_bytes_.load(std::memory_order_relaxed) +
+                                       block_size >
+                               max_cached_bytes_.load(
+                                       std::memory_order_relaxed)) {
+            SystemFree(base);
+            return;
+        }
+        cached_bytes_.fetch_add(block_size, std::memory_order_relaxed);
+        PushCached(bin, base);
+    }
+
+    /// Releases cached blocks, largest first, until at most \p max_bytes
+    /// remain.
+    void Trim(size_t max_bytes) {
+        std::lock_guard<std::mutex> pool_lock(pool_mutex_);
+        {
+            // Move the blocks of all thread caches to the shared pool.
+            std::lock_guard<std::mutex> registry_lock(registry_mutex_);
+            for (ThreadCache* cache : thread_caches_) {
+                std::lock_guard<std::mutex> cache_lock(cache->mutex_);
+                for (int bin = 0; bin < kNumThreadBins; ++bin) {
+                    std::vector<void*>& blocks = cache->bins_[bin];
+                    pool_[bin].insert(pool_[bin].end(), blocks.begin(),
+                                      blocks.end());
+                    blocks.clear();
+                }
+            }
+        }
+        for (int bin = kNumBins - 1; bin >= 0; --bin) {
+            std::vector<void*>& blocks = pool_[bin];
+            while (!blocks.empty() &&
+                   cached_bytes_.load(std::memory_order_relaxed) > max_bytes) {
+                void* base = blocks.back();
+                blocks.pop_back();
+                cached_bytes_.fetch_sub(GetHeader(base)->size_,
+                                        std::memory_order_relaxed);
+                SystemFree(base);
+            }
+        }
+    }
+
+    void SetMaxCachedBytes(size_t max_cached_bytes) {
+        max_cached_bytes_.store(max_cached_bytes, std::memory_order_relaxed);
+        Trim(max_cached_bytes);
+    }
+
+    CPUCachedMemoryStatistics GetStatistics() const {
+        CPUCachedMemoryStatistics statistics;
+        statistics.num_hits_ = num_hits_.load(std::memory_order_relaxed);
+        statistics.num_misses_ = num_misses_.load(std::memory_order_relaxed);
+        statistics.cached_bytes_ =
+                cached_bytes_.load(std::memory_order_relaxed);
+        return statistics;
+    }
+
+    void ResetStatistics() {
+        num_hits_.store(0, std::memory_order_relaxed);
+        num_misses_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    struct ThreadCache {
+        ThreadCache() {
+            CPUCacher& cacher = CPUCacher::GetInstance();
+            std::lock_guard<std::mutex> lock(cacher.registry_mutex_);
+            cacher.thread_caches_.insert(this);
+        }
+
+        ~ThreadCache() {
+            CPUCacher& cacher = CPUCacher::GetInstance();
+            {
+                std::lock_guard<std::mutex> lock(cacher.registry_mutex_);
+                cacher.thread_caches_.erase(this);
+            }
+            // Hand the remaining blocks over to the shared pool.
+            std::lock_guard<std::mutex> lock(cacher.pool_mutex_);
+            for (int bin = 0; bin < kNumThreadBins; ++bin) {
+                cacher.pool_[bin].insert(cacher.pool_[bin].end(),
+                                         bins_[bin].begin(), bins_[bin].end());
+            }
+            alive_ = false;
+        }
+
+        std::mutex mutex_;
+        std::array<std::vector<void*>, kNumThreadBins> bins_;
+        static thread_local bool alive_;
+    };
+
+    /// Returns the cache of the calling thread, or nullptr if it has already
+    /// been destroyed during thread exit.
+    static ThreadCache* GetThreadCache() {
+        if (!ThreadCache::alive_) {
+            return nullptr;
+        }
+        static thread_local ThreadCache cache;
+        return &cache;
+    }
+
+    void* PopCached(int bin) {
+        if (bin < kNumThreadBins) {
+            if (ThreadCache* cache = GetThreadCache()) {
+                std::lock_guard<std::mutex> lock(cache->mutex_);
+                std::vector<void*>& blocks = cache->bins_[bin];
+                if (!blocks.empty()) {
+                    void* base = blocks.back();
+                    blocks.pop_back();
+                    return base;
+                }
+            }
+        }
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        std::vector<void*>& blocks = pool_[bin];
+        if (blocks.empty()) {
+            return nullptr;
+        }
+        void* base = blocks.back();
+        blocks.pop_back();
+        return base;
+    }
+
+    void PushCached(int bin, void* base) {
+        if (bin < kNumThreadBins) {
+            if (ThreadCache* cache = GetThreadCache()) {
+                std::lock_guard<std::mutex> lock(cache->mutex_);
+                std::vector<void*>& blocks = cache->bins_[bin];
+                if (blocks.size() < kMaxThreadCacheBlocks) {
+                    blocks.push_back(base);
+                    return;
+                }
+            }
+        }
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        pool_[bin].push_back(base);
+    }
+
+    std::mutex pool_mutex_;
+    std::array<std::vector<void*>, kNumBins> pool_;
+
+    std::mutex registry_mutex_;
+    std::unordered_set<ThreadCache*> thread_caches_;
+
+    std::atomic<size_t> num_hits_{0};
+    std::atomic<size_t> num_misses_{0};
+    std::atomic<size_t> cached_bytes_{0};
+    std::atomic<size_t> max_cached_bytes_{size_t(1) << 30};
+};
+
+thread_local bool CPUCacher::ThreadCache::alive_ = true;
+
+}  // namespace
+
+CPUCachedMemoryManager::CPUCachedMemoryManager() {}
+
+void* CPUCachedMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    if (byte_size == 0) return nullptr;
+    return CPUCacher::GetInstance().Malloc(byte_size);
+}
+
+void CPUCachedMemoryManager::Free(void* ptr, const Device& device) {
+    if (ptr) {
+        CPUCacher::GetInstance().Free(ptr);
+    }
+}
+
+void CPUCachedMemoryManager::Memcpy(void* dst_ptr,
+                                    const Device& dst_device,
+                                    const void* src_ptr,
+                                    const Device& src_device,
+                                    size_t num_bytes) {
+    std::memcpy(dst_ptr, src_ptr, num_bytes);
+}
+
+void CPUCachedMemoryManager::ReleaseCache() {
+    CPUCacher::GetInstance().Trim(0);
+}
+
+void CPUCachedMemoryManager::TrimCache(size_t max_cached_bytes) {
+    CPUCacher::GetInstance().Trim(max_cached_bytes);
+}
+
+void CPUCachedMemoryManager::SetMaxCachedBytes(size_t max_cached_bytes) {
+    CPUCacher::GetInstance().SetMaxCachedBytes(max_cached_bytes);
+}
+
+CPUCachedMemoryStatistics CPUCachedMemoryManager::GetStatistics() {
+    return CPUCacher::GetInstance().GetStatistics();
+}
+
+void CPUCachedMemoryManager::ResetStatistics() {
+    CPUCacher::GetInstance().ResetStatistics();
+}
+
+}  // namespace core
+}  // namespace open3d
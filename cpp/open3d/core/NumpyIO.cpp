@@ -78,12 +78,16 @@ static char DtypeToChar(const Dtype& dtype) {
     // 'c': std::complex<float>, std::complex<double>),
     //      std::complex<long double>)
     // '?': object
+    if (dtype == Dtype::Float16) return 'f';
     if (dtype == Dtype::Float32) return 'f';
     if (dtype == Dtype::Float64) return 'f';
+    if (dtype == Dtype::Int8) return 'i';
+    if (dtype == Dtype::Int16) return 'i';
     if (dtype == Dtype::Int32) return 'i';
     if (dtype == Dtype::Int64) return 'i';
     if (dtype == Dtype::UInt8) return 'u';
     if (dtype == Dtype::UInt16) return 'u';
+    if (dtype == Dtype::UInt32) return 'u';
     if (dtype == Dtype::Bool) return 'b';
     utility::LogError("Unsupported dtype: {}", dtype.ToString());
 }
@@ -249,10 +253,16 @@ NumpyArray::NumpyArray(const Tensor& t)
 
 Dtype NumpyArray::GetDtype() const {
     Dtype dtype(Dtype::DtypeCode::Undefined, 1, "undefined");
-    if (type_ == 'f' && word_size_ == 4) {
+    if (type_ == 'f' && word_size_ == 2) {
+        dtype = Dtype::Float16;
+    } else if (type_ == 'f' && word_size_ == 4) {
         dtype = Dtype::Float32;
     } else if (type_ == 'f' && word_size_ == 8) {
         dtype = Dtype::Float64;
+    } else if (type_ == 'i' && word_size_ == 1) {
+        dtype = Dtype::Int8;
+    } else if (type_ == 'i' && word_size_ == 2) {
+        dtype = Dtype::Int16;
     } else if (type_ == 'i' && word_size_ == 4) {
         dtype = Dtype::Int32;
     } else if (type_ == 'i' && word_size_ == 8) {
@@ -261,6 +271,8 @@ Dtype NumpyArray::GetDtype() const {
         dtype = Dtype::UInt8;
     } else if (type_ == 'u' && word_size_ == 2) {
         dtype = Dtype::UInt16;
+    } else if (type_ == 'u' && word_size_ == 4) {
+        dtype = Dtype::UInt32;
     } else if (type_ == 'b') {
         dtype = Dtype::Bool;
     }
@@ -42,6 +42,10 @@ class Scalar {
 public:
     enum class ScalarType { Double, Int64, Bool };
 
+    Scalar(Float16 v) {
+        scalar_type_ = ScalarType::Double;
+        value_.d = static_cast<double>(static_cast<float>(v));
+    }
     Scalar(float v) {
         scalar_type_ = ScalarType::Double;
         value_.d = static_cast<double>(v);
@@ -50,6 +54,14 @@ public:
         scalar_type_ = ScalarType::Double;
         value_.d = static_cast<double>(v);
     }
+    Scalar(int8_t v) {
+        scalar_type_ = ScalarType::Int64;
+        value_.i = static_cast<int64_t>(v);
+    }
+    Scalar(int16_t v) {
+        scalar_type_ = ScalarType::Int64;
+        value_.i = static_cast<int64_t>(v);
+    }
     Scalar(int v) {
         scalar_type_ = ScalarType::Int64;
         value_.i = static_cast<int64_t>(v);
@@ -66,6 +78,10 @@ public:
         scalar_type_ = ScalarType::Int64;
         value_.i = static_cast<int64_t>(v);
     }
+    Scalar(uint32_t v) {
+        scalar_type_ = ScalarType::Int64;
+        value_.i = static_cast<int64_t>(v);
+    }
     Scalar(bool v) {
         scalar_type_ = ScalarType::Bool;
         value_.b = static_cast<bool>(v);
@@ -26,6 +26,7 @@
 
 #include "open3d/core/Tensor.h"
 
+#include <limits>
 #include <sstream>
 
 #include "open3d/core/AdvancedIndexing.h"
@@ -79,17 +80,14 @@ private:
         DLDataType dl_data_type;
         Dtype dtype = o3d_tensor_.GetDtype();
 
-        if (dtype == Dtype::Float32) {
+        if (dtype == Dtype::Float16 || dtype == Dtype::Float32 ||
+            dtype == Dtype::Float64) {
             dl_data_type.code = DLDataTypeCode::kDLFloat;
-        } else if (dtype == Dtype::Float64) {
-            dl_data_type.code = DLDataTypeCode::kDLFloat;
-        } else if (dtype == Dtype::Int32) {
-            dl_data_type.code = DLDataTypeCode::kDLInt;
-        } else if (dtype == Dtype::Int64) {
+        } else if (dtype == Dtype::Int8 || dtype == Dtype::Int16 ||
+                   dtype == Dtype::Int32 || dtype == Dtype::Int64) {
             dl_data_type.code = DLDataTypeCode::kDLInt;
-        } else if (dtype == Dtype::UInt8) {
-            dl_data_type.code = DLDataTypeCode::kDLUInt;
-        } else if (dtype == Dtype::UInt16) {
+        } else if (dtype == Dtype::UInt8 || dtype == Dtype::UInt16 ||
+                   dtype == Dtype::UInt32) {
             dl_data_type.code = DLDataTypeCode::kDLUInt;
         } else {
             utility::LogError("Unsupported data type");
@@ -240,6 +238,92 @@ Tensor Tensor::Arange(Scalar start,
     return kernel::Arange(t_start, t_stop, t_step);
 }
 
+Tensor Tensor::Cat(const std::vector<Tensor>& tensors, int64_t dim) {
+    if (tensors.empty()) {
+        utility::LogError("Cat expects at least one tensor.");
+    }
+    const Tensor& first = tensors[0];
+    if (first.NumDims() == 0) {
+        utility::LogError("Zero-dimensional tensors cannot be concatenated.");
+    }
+    dim = shape_util::WrapDim(dim, first.NumDims());
+    SizeVector expected_shape = first.GetShape();
+    expected_shape[dim] = 0;
+    SizeVector dst_shape = expected_shape;
+    for (const Tensor& tensor : tensors) {
+        tensor.AssertDtype(first.GetDtype());
+        tensor.AssertDevice(first.GetDevice());
+        SizeVector shape = tensor.GetShape();
+        if (shape.size() != expected_shape.size()) {
+            utility::LogError(
+                    "Cat expects tensors with the same number of dimensions, "
+                    "but got shapes {} and {}.",
+                    first.GetShape().ToString(), shape.ToString());
+        }
+        const int64_t dim_size = shape[dim];
+        shape[dim] = 0;
+        if (shape != expected_shape) {
+            utility::LogError(
+                    "Cat expects tensors with the same shape except in "
+                    "dimension {}, but got shapes {} and {}.",
+                    dim, first.GetShape().ToString(),
+                    tensor.GetShape().ToString());
+        }
+        dst_shape[dim] += dim_size;
+    }
+
+    // Each tensor is copied into its slice with the parallel copy kernel.
+    Tensor dst(dst_shape, first.GetDtype(), first.GetDevice());
+    int64_t offset = 0;
+    for (const Tensor& tensor : tensors) {
+        const int64_t dim_size = tensor.GetShape()[dim];
+        if (dim_size > 0) {
+            dst.Slice(dim, offset, offset + dim_size) = tensor;
+        }
+        offset += dim_size;
+    }
+    return dst;
+}
+
+Tensor Tensor::Stack(const std::vector<Tensor>& tensors, int64_t dim) {
+    if (tensors.empty()) {
+        utility::LogError("Stack expects at least one tensor.");
+    }
+    const Tensor& first = tensors[0];
+    dim = shape_util::WrapDim(dim, first.NumDims() + 1);
+    for (const Tensor& tensor : tensors) {
+        tensor.AssertDtype(first.GetDtype());
+        tensor.AssertDevice(first.GetDevice());
+        if (tensor.GetShape() != first.GetShape()) {
+            utility::LogError(
+                    "Stack expects tensors with the same shape, but got "
+                    "shapes {} and {}.",
+                    first.GetShape().ToString(), tensor.GetShape().ToString());
+        }
+    }
+
+    SizeVector dst_shape = first.GetShape();
+    dst_shape.insert(dst_shape.begin() + dim,
+                     static_cast<int64_t>(tensors.size()));
+    Tensor dst(dst_shape, first.GetDtype(), first.GetDevice());
+    for (size_t i = 0; i < tensors.size(); i++) {
+        dst.IndexExtract(dim, static_cast<int64_t>(i)) = tensors[i];
+    }
+    return dst;
+}
+
+Tensor Tensor::Where(const Tensor& condition,
+                     const Tensor& x,
+                     const Tensor& y) {
+    Tensor dst(shape_util::BroadcastedShape(
+                       condition.GetShape(),
+                       shape_util::BroadcastedShape(x.GetShape(),
+                                                    y.GetShape())),
+               x.GetDtype(), x.GetDevice());
+    kernel::Where(condition, x, y, dst);
+    return dst;
+}
+
 Tensor Tensor::GetItem(const TensorKey& tk) const {
     if (tk.GetMode() == TensorKey::TensorKeyMode::Index) {
         return IndexExtract(0, tk.GetIndex());
@@ -638,6 +722,19 @@ Tensor Tensor::Slice(int64_t dim,
 }
 
 Tensor Tensor::IndexGet(const std::vector<Tensor>& index_tensors) const {
+    // A single boolean mask over the leading dimensions is compacted directly
+    // on CPU, without computing the indices of the selected elements.
+    if (index_tensors.size() == 1 &&
+        index_tensors[0].GetDtype() == Dtype::Bool &&
+        index_tensors[0].NumDims() > 0 &&
+        index_tensors[0].NumDims() <= NumDims() &&
+        GetDevice().GetType() == Device::DeviceType::CPU &&
+        index_tensors[0].GetDevice().GetType() == Device::DeviceType::CPU &&
+        std::equal(index_tensors[0].GetShape().begin(),
+                   index_tensors[0].GetShape().end(), shape_.begin())) {
+        return kernel::IndexGetMasked(*this, index_tensors[0]);
+    }
+
     AdvancedIndexPreprocessor aip(*this, index_tensors);
     Tensor dst = Tensor(aip.GetOutputShape(), dtype_, GetDevice());
     kernel::IndexGet(aip.GetTensor(), dst, aip.GetIndexTensors(),
@@ -777,6 +874,21 @@ Tensor Tensor::Div_(const Tensor& value) {
     return *this;
 }
 
+Tensor Tensor::AddMul(const Tensor& lhs, const Tensor& rhs) const {
+    Tensor dst_tensor(
+            shape_util::BroadcastedShape(
+                    shape_, shape_util::BroadcastedShape(lhs.shape_,
+                                                         rhs.shape_)),
+            dtype_, GetDevice());
+    kernel::AddMul(*this, lhs, rhs, dst_tensor);
+    return dst_tensor;
+}
+
+Tensor Tensor::AddMul_(const Tensor& lhs, const Tensor& rhs) {
+    kernel::AddMul(*this, lhs, rhs, *this);
+    return *this;
+}
+
 Tensor Tensor::Sum(const SizeVector& dims, bool keepdim) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
                GetDevice());
@@ -785,9 +897,13 @@ Tensor Tensor::Sum(const SizeVector& dims, bool keepdim) const {
 }
 
 Tensor Tensor::Mean(const SizeVector& dims, bool keepdim) const {
+    if (dtype_ == Dtype::Float16) {
+        return To(Dtype::Float32).Mean(dims, keepdim).To(Dtype::Float16);
+    }
     if (dtype_ != Dtype::Float32 && dtype_ != Dtype::Float64) {
         utility::LogError(
-                "Can only compute mean for Float32 or Float64, got {} instead.",
+                "Can only compute mean for Float16, Float32 or Float64, got {} "
+                "instead.",
                 dtype_.ToString());
     }
 
@@ -837,6 +953,55 @@ Tensor Tensor::ArgMax(const SizeVector& dims) const {
     return dst;
 }
 
+Tensor Tensor::Sort(int64_t dim) const {
+    if (NumDims() == 0) {
+        return Clone();
+    }
+    // The kernel sorts along the last dimension.
+    dim = shape_util::WrapDim(dim, NumDims());
+    Tensor src = Transpose(dim, NumDims() - 1).Contiguous();
+    Tensor dst(src.GetShape(), dtype_, GetDevice());
+    kernel::Sort(src, dst);
+    return dst.Transpose(dim, NumDims() - 1).Contiguous();
+}
+
+Tensor Tensor::ArgSort(int64_t dim) const {
+    if (NumDims() == 0) {
+        return Tensor::Zeros({}, Dtype::Int64, GetDevice());
+    }
+    dim = shape_util::WrapDim(dim, NumDims());
+    Tensor src = Transpose(dim, NumDims() - 1).Contiguous();
+    Tensor dst(src.GetShape(), Dtype::Int64, GetDevice());
+    kernel::ArgSort(src, dst);
+    return dst.Transpose(dim, NumDims() - 1).Contiguous();
+}
+
+std::tuple<Tensor, Tensor, Tensor> Tensor::Unique() const {
+    Tensor values;
+    Tensor inverse;
+    Tensor counts;
+    kernel::Unique(Contiguous().Reshape({NumElements()}), values, inverse,
+                   counts);
+    return std::make_tuple(values, inverse.Reshape(shape_), counts);
+}
+
+std::tuple<Tensor, Tensor, Tensor> Tensor::Unique(int64_t dim) const {
+    // The kernel finds the unique rows of a 2D tensor.
+    dim = shape_util::WrapDim(dim, NumDims());
+    Tensor src = Transpose(0, dim).Contiguous();
+    SizeVector src_shape = src.GetShape();
+    const int64_t row_size =
+            SizeVector(src_shape.begin() + 1, src_shape.end()).NumElements();
+    Tensor values;
+    Tensor inverse;
+    Tensor counts;
+    kernel::Unique(src.Reshape({src_shape[0], row_size}), values, inverse,
+                   counts);
+    src_shape[0] = values.GetShape(0);
+    values = values.Reshape(src_shape).Transpose(0, dim).Contiguous();
+    return std::make_tuple(values, inverse, counts);
+}
+
 Tensor Tensor::Sqrt() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Sqrt);
@@ -903,14 +1068,41 @@ Tensor Tensor::Abs_() {
     return *this;
 }
 
+/// Returns a scalar Tensor holding the clipping bound \p value. For integer
+/// and boolean dtypes, the bound is first clamped to the range of the dtype,
+/// so that out of range bounds saturate instead of wrapping around.
+static Tensor ClipBound(double value, Dtype dtype, const Device& device) {
+    if (dtype == Dtype::Float16 || dtype == Dtype::Float32 ||
+        dtype == Dtype::Float64) {
+        return Tensor::Full({}, value, dtype, device);
+    }
+    Tensor bound;
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype, [&]() {
+        const scalar_t lowest = std::numeric_limits<scalar_t>::lowest();
+        const scalar_t max = std::numeric_limits<scalar_t>::max();
+        scalar_t clamped;
+        if (value <= static_cast<double>(lowest)) {
+            clamped = lowest;
+        } else if (value >= static_cast<double>(max)) {
+            clamped = max;
+        } else {
+            clamped = static_cast<scalar_t>(value);
+        }
+        bound = Tensor::Full({}, clamped, dtype, device);
+    });
+    return bound;
+}
+
 Tensor Tensor::Clip(double min_val, double max_val) const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
-    utility::LogError("Not Implemented!");
+    kernel::Clip(*this, ClipBound(min_val, dtype_, GetDevice()),
+                 ClipBound(max_val, dtype_, GetDevice()), dst_tensor);
     return dst_tensor;
 }
 
 Tensor Tensor::Clip_(double min_val, double max_val) {
-    utility::LogError("Not Implemented!");
+    kernel::Clip(*this, ClipBound(min_val, dtype_, GetDevice()),
+                 ClipBound(max_val, dtype_, GetDevice()), *this);
     return *this;
 }
 
@@ -1137,6 +1329,9 @@ Tensor Tensor::FromDLPack(const DLManagedTensor* src) {
                 case 16:
                     dtype = Dtype::UInt16;
                     break;
+                case 32:
+                    dtype = Dtype::UInt32;
+                    break;
                 default:
                     utility::LogError("Unsupported kDLUInt bits {}",
                                       src->dl_tensor.dtype.bits);
@@ -1144,6 +1339,12 @@ Tensor Tensor::FromDLPack(const DLManagedTensor* src) {
             break;
         case DLDataTypeCode::kDLInt:
             switch (src->dl_tensor.dtype.bits) {
+                case 8:
+                    dtype = Dtype::Int8;
+                    break;
+                case 16:
+                    dtype = Dtype::Int16;
+                    break;
                 case 32:
                     dtype = Dtype::Int32;
                     break;
@@ -1157,6 +1358,9 @@ Tensor Tensor::FromDLPack(const DLManagedTensor* src) {
             break;
         case DLDataTypeCode::kDLFloat:
             switch (src->dl_tensor.dtype.bits) {
+                case 16:
+                    dtype = Dtype::Float16;
+                    break;
                 case 32:
                     dtype = Dtype::Float32;
                     break;
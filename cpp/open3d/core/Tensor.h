@@ -340,6 +340,22 @@ public:
                          Dtype dtype = Dtype::Int64,
                          const Device& device = core::Device("CPU:0"));
 
+    /// Concatenates \p tensors along dimension \p dim. The tensors must have
+    /// the same dtype, device and number of dimensions, and the same shape
+    /// except in dimension \p dim.
+    static Tensor Cat(const std::vector<Tensor>& tensors, int64_t dim = 0);
+
+    /// Stacks \p tensors along a new dimension \p dim. The tensors must have
+    /// the same dtype, device and shape.
+    static Tensor Stack(const std::vector<Tensor>& tensors, int64_t dim = 0);
+
+    /// Returns x where \p condition is true and y elsewhere, element-wise.
+    /// \p condition must be Bool, \p x and \p y must have the same dtype, and
+    /// all three are broadcast to a common shape.
+    static Tensor Where(const Tensor& condition,
+                        const Tensor& x,
+                        const Tensor& y);
+
     /// Pythonic __getitem__ for tensor.
     ///
     /// Returns a view of the original tensor, if TensorKey is
@@ -677,6 +693,15 @@ public:
         return Div_(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
     }
 
+    /// Returns this + lhs * rhs in a single pass. Floating point values are
+    /// computed with a fused multiply-add (std::fma), which rounds once.
+    /// Float16 values are computed as Float32 and rounded to Float16.
+    Tensor AddMul(const Tensor& lhs, const Tensor& rhs) const;
+
+    /// Inplace version of Tensor::AddMul. The broadcast shape of \p lhs and
+    /// \p rhs must be broadcastable to the shape of the current tensor.
+    Tensor AddMul_(const Tensor& lhs, const Tensor& rhs);
+
     /// Returns the sum of the tensor along the given \p dims.
     /// \param dims A list of dimensions to be reduced.
     /// \param keepdim If true, the reduced dims will be retained as size 1.
@@ -722,6 +747,28 @@ public:
     /// is into the flattend tensor.
     Tensor ArgMax(const SizeVector& dims) const;
 
+    /// Returns the tensor sorted in ascending order along dimension \p dim.
+    /// NaNs are sorted last.
+    Tensor Sort(int64_t dim = -1) const;
+
+    /// Returns the int64 indices that sort the tensor in ascending order along
+    /// dimension \p dim. The sort is stable: equal elements keep their order.
+    Tensor ArgSort(int64_t dim = -1) const;
+
+    /// Finds the unique elements of the flattened tensor. Returns the sorted
+    /// unique elements, the int64 index into them of each element of the
+    /// tensor (with the shape of the tensor), and the int64 number of
+    /// occurrences of each unique element. NaNs are treated as equal.
+    std::tuple<Tensor, Tensor, Tensor> Unique() const;
+
+    /// Finds the unique slices of the tensor along dimension \p dim, e.g. the
+    /// unique rows of an {N, 3} tensor for dim 0. Returns the unique slices in
+    /// lexicographic order (with the shape of the tensor, except for the size
+    /// of \p dim), the int64 index into them of each slice of the tensor, and
+    /// the int64 number of occurrences of each unique slice. NaNs are treated
+    /// as equal.
+    std::tuple<Tensor, Tensor, Tensor> Unique(int64_t dim) const;
+
     /// Element-wise square root of a tensor, returns a new tensor.
     Tensor Sqrt() const;
 
@@ -759,13 +806,14 @@ public:
     Tensor Abs_();
 
     /// Element-wise clipping of tensor values so that resulting values lie in
-    /// the range [\p min_val, \p max_val], returning a new tensor.
+    /// the range [\p min_val, \p max_val], returning a new tensor. For integer
+    /// and boolean dtypes, the bounds saturate at the range of the dtype.
     /// \param min_val Lower bound for output values.
     /// \param max_val Upper bound for output values.
     Tensor Clip(double min_val, double max_val) const;
 
     /// Element-wise clipping of tensor values so that resulting values lie in
-    /// the range [\p min_val, \p max_val]. In-place version.
+    /// the range [\p min_val, \p max_val]. In-place version of Clip().
     /// \param min_val Lower bound for output values.
     /// \param max_val Upper bound for output values.
     Tensor Clip_(double min_val, double max_val);
@@ -0,0 +1,268 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/TensorExpr.h"
+
+#include <functional>
+#include <unordered_map>
+
+#include "open3d/core/Indexer.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+
+TensorExpr::TensorExpr(const Tensor& tensor)
+    : shape_(tensor.GetShape()),
+      dtype_(tensor.GetDtype()),
+      device_(tensor.GetDevice()) {
+    if (dtype_ == Dtype::Bool || dtype_.IsObject()) {
+        utility::LogError("TensorExpr does not support dtype {}.",
+                          dtype_.ToString());
+    }
+    auto node = std::make_shared<Node>();
+    node->op_code_ = kernel::FusedEWOpCode::Input;
+    node->tensor_ = tensor;
+    node_ = node;
+}
+
+TensorExpr::TensorExpr(const std::shared_ptr<const Node>& node,
+                       const SizeVector& shape,
+                       Dtype dtype,
+                       Device device)
+    : node_(node), shape_(shape), dtype_(dtype), device_(device) {}
+
+TensorExpr TensorExpr::Add(const TensorExpr& value) const {
+    return Binary(kernel::FusedEWOpCode::Add, value);
+}
+
+TensorExpr TensorExpr::Sub(const TensorExpr& value) const {
+    return Binary(kernel::FusedEWOpCode::Sub, value);
+}
+
+TensorExpr TensorExpr::Mul(const TensorExpr& value) const {
+    return Binary(kernel::FusedEWOpCode::Mul, value);
+}
+
+TensorExpr TensorExpr::Div(const TensorExpr& value) const {
+    return Binary(kernel::FusedEWOpCode::Div, value);
+}
+
+TensorExpr TensorExpr::Neg() const {
+    return Unary(kernel::FusedEWOpCode::Neg);
+}
+
+TensorExpr TensorExpr::Abs() const {
+    return Unary(kernel::FusedEWOpCode::Abs);
+}
+
+TensorExpr TensorExpr::Sqrt() const {
+    if (dtype_ != Dtype::Float16 && dtype_ != Dtype::Float32 &&
+        dtype_ != Dtype::Float64) {
+        utility::LogError(
+                "Only supports Float16, Float32 and Float64, but {} is used.",
+                dtype_.ToString());
+    }
+    return Unary(kernel::FusedEWOpCode::Sqrt);
+}
+
+TensorExpr TensorExpr::Binary(kernel::FusedEWOpCode op_code,
+                              const TensorExpr& value) const {
+    if (value.dtype_ != dtype_) {
+        utility::LogError("Dtype mismatch {} != {}.", value.dtype_.ToString(),
+                          dtype_.ToString());
+    }
+    if (value.device_ != device_) {
+        utility::LogError("Device mismatch {} != {}.",
+                          value.device_.ToString(), device_.ToString());
+    }
+    auto node = std::make_shared<Node>();
+    node->op_code_ = op_code;
+    node->lhs_ = node_;
+    node->rhs_ = value.node_;
+    return TensorExpr(node, shape_util::BroadcastedShape(shape_, value.shape_),
+                      dtype_, device_);
+}
+
+TensorExpr TensorExpr::Unary(kernel::FusedEWOpCode op_code) const {
+    auto node = std::make_shared<Node>();
+    node->op_code_ = op_code;
+    node->lhs_ = node_;
+    return TensorExpr(node, shape_, dtype_, device_);
+}
+
+bool TensorExpr::Compile(
+        std::vector<Tensor>& inputs,
+        std::vector<kernel::FusedEWInstruction>& program) const {
+    if (device_.GetType() != Device::DeviceType::CPU) {
+        return false;
+    }
+
+    // Sub-expressions used more than once are computed once.
+    std::unordered_map<const Node*, int64_t> node_to_instruction;
+    std::function<int64_t(const Node*)> compile =
+            [&](const Node* node) -> int64_t {
+        auto it = node_to_instruction.find(node);
+        if (it != node_to_instruction.end()) {
+            return it->second;
+        }
+        kernel::FusedEWInstruction instruction{node->op_code_, 0, 0};
+        if (node->op_code_ == kernel::FusedEWOpCode::Input) {
+            // The same view may be wrapped in several TensorExprs.
+            const Tensor& tensor = node->tensor_;
+            int64_t input_idx = 0;
+            while (input_idx < static_cast<int64_t>(inputs.size()) &&
+                   !(inputs[input_idx].GetDataPtr() == tensor.GetDataPtr() &&
+                     inputs[input_idx].GetShape() == tensor.GetShape() &&
+                     inputs[input_idx].GetStrides() == tensor.GetStrides())) {
+                ++input_idx;
+            }
+            if (input_idx == static_cast<int64_t>(inputs.size())) {
+                inputs.push_back(tensor);
+            }
+            instruction.lhs = input_idx;
+        } else {
+            instruction.lhs = compile(node->lhs_.get());
+            if (node->rhs_ != nullptr) {
+                instruction.rhs = compile(node->rhs_.get());
+            }
+        }
+        program.push_back(instruction);
+        node_to_instruction[node] = static_cast<int64_t>(program.size()) - 1;
+        return node_to_instruction[node];
+    };
+    compile(node_.get());
+
+    return static_cast<int64_t>(inputs.size()) <= MAX_INPUTS &&
+           static_cast<int64_t>(shape_.size()) <= MAX_DIMS;
+}
+
+Tensor TensorExpr::EvalEager() const {
+    std::unordered_map<const Node*, Tensor> node_to_tensor;
+    std::function<Tensor(const Node*)> eval = [&](const Node* node) -> Tensor {
+        auto it = node_to_tensor.find(node);
+        if (it != node_to_tensor.end()) {
+            return it->second;
+        }
+        Tensor result;
+        switch (node->op_code_) {
+            case kernel::FusedEWOpCode::Input:
+                result = node->tensor_;
+                break;
+            case kernel::FusedEWOpCode::Add:
+                result = eval(node->lhs_.get()).Add(eval(node->rhs_.get()));
+                break;
+            case kernel::FusedEWOpCode::Sub:
+                result = eval(node->lhs_.get()).Sub(eval(node->rhs_.get()));
+                break;
+            case kernel::FusedEWOpCode::Mul:
+                result = eval(node->lhs_.get()).Mul(eval(node->rhs_.get()));
+                break;
+            case kernel::FusedEWOpCode::Div:
+                result = eval(node->lhs_.get()).Div(eval(node->rhs_.get()));
+                break;
+            case kernel::FusedEWOpCode::Neg:
+                result = eval(node->lhs_.get()).Neg();
+                break;
+            case kernel::FusedEWOpCode::Abs:
+                result = eval(node->lhs_.get()).Abs();
+                break;
+            case kernel::FusedEWOpCode::Sqrt:
+                result = eval(node->lhs_.get()).Sqrt();
+                break;
+            default:
+                utility::LogError("Unsupported op code.");
+        }
+        node_to_tensor[node] = result;
+        return result;
+    };
+    Tensor result = eval(node_.get());
+    return node_->op_code_ == kernel::FusedEWOpCode::Input ? result.Clone()
+                                                           : result;
+}
+
+Tensor TensorExpr::Eval() const {
+    std::vector<Tensor> inputs;
+    std::vector<kernel::FusedEWInstruction> program;
+    if (!Compile(inputs, program)) {
+        return EvalEager();
+    }
+    Tensor dst(shape_, dtype_, device_);
+    kernel::FusedEW(inputs, program, dst);
+    return dst;
+}
+
+Tensor TensorExpr::Sum(const SizeVector& dims, bool keepdim) const {
+    return Reduce(dims, keepdim, kernel::ReductionOpCode::Sum);
+}
+
+Tensor TensorExpr::Prod(const SizeVector& dims, bool keepdim) const {
+    return Reduce(dims, keepdim, kernel::ReductionOpCode::Prod);
+}
+
+Tensor TensorExpr::Min(const SizeVector& dims, bool keepdim) const {
+    return Reduce(dims, keepdim, kernel::ReductionOpCode::Min);
+}
+
+Tensor TensorExpr::Max(const SizeVector& dims, bool keepdim) const {
+    return Reduce(dims, keepdim, kernel::ReductionOpCode::Max);
+}
+
+Tensor TensorExpr::Reduce(const SizeVector& dims,
+                          bool keepdim,
+                          kernel::ReductionOpCode op_code) const {
+    // Also validates dims.
+    SizeVector dst_shape = shape_util::ReductionShape(shape_, dims, keepdim);
+    std::vector<Tensor> inputs;
+    std::vector<kernel::FusedEWInstruction> program;
+    bool reduce_all =
+            shape_util::ReductionShape(shape_, dims, false).size() == 0;
+    if (!reduce_all || !Compile(inputs, program)) {
+        // Partial reductions reuse the Tensor reduction kernels.
+        Tensor src = node_->op_code_ == kernel::FusedEWOpCode::Input
+                             ? node_->tensor_
+                             : Eval();
+        switch (op_code) {
+            case kernel::ReductionOpCode::Sum:
+                return src.Sum(dims, keepdim);
+            case kernel::ReductionOpCode::Prod:
+                return src.Prod(dims, keepdim);
+            case kernel::ReductionOpCode::Min:
+                return src.Min(dims, keepdim);
+            case kernel::ReductionOpCode::Max:
+                return src.Max(dims, keepdim);
+            default:
+                utility::LogError("Unsupported op code.");
+        }
+    }
+    Tensor dst = Tensor::Empty({}, dtype_, device_);
+    kernel::FusedEWReduction(inputs, program, shape_, dst, op_code);
+    return dst.Reshape(dst_shape);
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,190 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/FusedEW.h"
+
+namespace open3d {
+namespace core {
+
+/// A lazily evaluated chain of element-wise Tensor operations.
+///
+/// Arithmetic on a TensorExpr records the operation instead of running it.
+/// Eval() and the reductions then compute the whole expression in a single
+/// pass over the inputs, without allocating the intermediate tensors. Inputs
+/// follow the usual broadcasting rules and must share dtype and device.
+///
+/// \code{.cpp}
+/// // One pass, no temporaries. diff is computed once per element:
+/// TensorExpr diff = TensorExpr(a) - b;
+/// Tensor sq = (diff * diff).Sum({0, 1});
+/// \endcode
+///
+/// Only CPU expressions are fused. On other devices the expression is
+/// evaluated eagerly with the regular Tensor operations.
+class TensorExpr {
+public:
+    TensorExpr(const Tensor& tensor);
+
+    /// Returns the shape of the result.
+    SizeVector GetShape() const { return shape_; }
+
+    /// Returns the dtype of the result.
+    Dtype GetDtype() const { return dtype_; }
+
+    /// Returns the device of the result.
+    Device GetDevice() const { return device_; }
+
+    /// Adds an expression.
+    TensorExpr Add(const TensorExpr& value) const;
+    TensorExpr Add(const Tensor& value) const { return Add(TensorExpr(value)); }
+    template <typename T>
+    TensorExpr Add(T scalar_value) const {
+        return Add(Tensor::Full({}, scalar_value, dtype_, device_));
+    }
+    TensorExpr operator+(const TensorExpr& value) const { return Add(value); }
+    TensorExpr operator+(const Tensor& value) const { return Add(value); }
+    template <typename T>
+    TensorExpr operator+(T scalar_value) const {
+        return Add(scalar_value);
+    }
+
+    /// Substracts an expression.
+    TensorExpr Sub(const TensorExpr& value) const;
+    TensorExpr Sub(const Tensor& value) const { return Sub(TensorExpr(value)); }
+    template <typename T>
+    TensorExpr Sub(T scalar_value) const {
+        return Sub(Tensor::Full({}, scalar_value, dtype_, device_));
+    }
+    TensorExpr operator-(const TensorExpr& value) const { return Sub(value); }
+    TensorExpr operator-(const Tensor& value) const { return Sub(value); }
+    template <typename T>
+    TensorExpr operator-(T scalar_value) const {
+        return Sub(scalar_value);
+    }
+
+    /// Multiplies an expression.
+    TensorExpr Mul(const TensorExpr& value) const;
+    TensorExpr Mul(const Tensor& value) const { return Mul(TensorExpr(value)); }
+    template <typename T>
+    TensorExpr Mul(T scalar_value) const {
+        return Mul(Tensor::Full({}, scalar_value, dtype_, device_));
+    }
+    TensorExpr operator*(const TensorExpr& value) const { return Mul(value); }
+    TensorExpr operator*(const Tensor& value) const { return Mul(value); }
+    template <typename T>
+    TensorExpr operator*(T scalar_value) const {
+        return Mul(scalar_value);
+    }
+
+    /// Divides by an expression.
+    TensorExpr Div(const TensorExpr& value) const;
+    TensorExpr Div(const Tensor& value) const { return Div(TensorExpr(value)); }
+    template <typename T>
+    TensorExpr Div(T scalar_value) const {
+        return Div(Tensor::Full({}, scalar_value, dtype_, device_));
+    }
+    TensorExpr operator/(const TensorExpr& value) const { return Div(value); }
+    TensorExpr operator/(const Tensor& value) const { return Div(value); }
+    template <typename T>
+    TensorExpr operator/(T scalar_value) const {
+        return Div(scalar_value);
+    }
+
+    /// Element-wise negation.
+    TensorExpr Neg() const;
+    TensorExpr operator-() const { return Neg(); }
+
+    /// Element-wise absolute value.
+    TensorExpr Abs() const;
+
+    /// Element-wise square root. Only float dtypes are supported.
+    TensorExpr Sqrt() const;
+
+    /// Evaluates the expression into a new contiguous Tensor.
+    Tensor Eval() const;
+
+    /// Returns the sum along \p dims of the expression. When all dimensions
+    /// are reduced, the reduction is fused with the expression and the
+    /// element-wise results are never stored.
+    Tensor Sum(const SizeVector& dims, bool keepdim = false) const;
+
+    /// Returns the product along \p dims. See TensorExpr::Sum.
+    Tensor Prod(const SizeVector& dims, bool keepdim = false) const;
+
+    /// Returns the min along \p dims. See TensorExpr::Sum.
+    Tensor Min(const SizeVector& dims, bool keepdim = false) const;
+
+    /// Returns the max along \p dims. See TensorExpr::Sum.
+    Tensor Max(const SizeVector& dims, bool keepdim = false) const;
+
+private:
+    struct Node {
+        kernel::FusedEWOpCode op_code_;
+        /// Only set for FusedEWOpCode::Input.
+        Tensor tensor_;
+        std::shared_ptr<const Node> lhs_;
+        std::shared_ptr<const Node> rhs_;
+    };
+
+    TensorExpr(const std::shared_ptr<const Node>& node,
+               const SizeVector& shape,
+               Dtype dtype,
+               Device device);
+
+    TensorExpr Binary(kernel::FusedEWOpCode op_code,
+                      const TensorExpr& value) const;
+
+    TensorExpr Unary(kernel::FusedEWOpCode op_code) const;
+
+    /// Evaluates the expression with the regular Tensor operations.
+    Tensor EvalEager() const;
+
+    Tensor Reduce(const SizeVector& dims,
+                  bool keepdim,
+                  kernel::ReductionOpCode op_code) const;
+
+    /// Returns true if the expression can be evaluated with the fused kernels.
+    /// Fills \p inputs and \p program with the compiled expression.
+    bool Compile(std::vector<Tensor>& inputs,
+                 std::vector<kernel::FusedEWInstruction>& program) const;
+
+    std::shared_ptr<const Node> node_;
+    SizeVector shape_;
+    Dtype dtype_;
+    Device device_;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/core/hashmap/CPU/LinearProbingHashmapCPU.h"
 #include "open3d/core/hashmap/CPU/TemplateHashmapCPU.hpp"
 
 namespace open3d {
@@ -35,9 +36,23 @@ std::shared_ptr<DefaultDeviceHashmap> CreateDefaultCPUHashmap(
         int64_t init_capacity,
         int64_t dsize_key,
         int64_t dsize_value,
-        const Device& device) {
-    return std::make_shared<CPUHashmap<DefaultHash, DefaultKeyEq>>(
-            init_buckets, init_capacity, dsize_key, dsize_value, device);
+        const Device& device,
+        const HashmapBackend& backend) {
+    switch (backend) {
+        case HashmapBackend::Default:
+        case HashmapBackend::TBB:
+            return std::make_shared<CPUHashmap<DefaultHash, DefaultKeyEq>>(
+                    init_buckets, init_capacity, dsize_key, dsize_value,
+                    device);
+        case HashmapBackend::LinearProbing:
+            return std::make_shared<
+                    CPULinearProbingHashmap<DefaultHash, DefaultKeyEq>>(
+                    init_buckets, init_capacity, dsize_key, dsize_value,
+                    device);
+        default:
+            utility::LogError(
+                    "[CreateDefaultCPUHashmap]: Unsupported backend for CPU");
+    }
 }
 
 }  // namespace core
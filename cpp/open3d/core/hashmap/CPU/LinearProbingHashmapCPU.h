@@ -0,0 +1,442 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/hashmap/CPU/HashmapBufferCPU.hpp"
+#include "open3d/core/hashmap/DeviceHashmap.h"
+
+namespace open3d {
+namespace core {
+
+/// Open-addressing CPU hashmap with linear probing.
+///
+/// Each slot stores its state, or the buffer address of its key-value pair,
+/// followed by a copy of the key, so probing compares keys inline without
+/// chasing pointers into the key buffer. The table keeps at least twice as
+/// many slots as the buffer capacity, so probe sequences stay short.
+///
+/// Inserting claims an empty slot with a compare-and-swap, so concurrent
+/// inserts of the same key in a batch resolve to a single success. Erased
+/// slots become tombstones that are only reclaimed by Rehash, which rebuilds
+/// the table from the active key-value pairs.
+template <typename Hash, typename KeyEq>
+class CPULinearProbingHashmap : public DeviceHashmap<Hash, KeyEq> {
+public:
+    CPULinearProbingHashmap(int64_t init_buckets,
+                            int64_t init_capacity,
+                            int64_t dsize_key,
+                            int64_t dsize_value,
+                            const Device& device);
+
+    ~CPULinearProbingHashmap();
+
+    void Rehash(int64_t buckets) override;
+
+    void Insert(const void* input_keys,
+                const void* input_values,
+                addr_t* output_addrs,
+                bool* output_masks,
+                int64_t count) override;
+
+    void Activate(const void* input_keys,
+                  addr_t* output_addrs,
+                  bool* output_masks,
+                  int64_t count) override;
+
+    void Find(const void* input_keys,
+              addr_t* output_addrs,
+              bool* output_masks,
+              int64_t count) override;
+
+    void Erase(const void* input_keys,
+               bool* output_masks,
+               int64_t count) override;
+
+    int64_t GetActiveIndices(addr_t* output_indices) override;
+
+    int64_t Size() const override;
+
+    std::vector<int64_t> BucketSizes() const override;
+    float LoadFactor() const override;
+
+protected:
+    /// Slot states. Non-negative states are buffer addresses.
+    static constexpr int32_t kEmpty = -1;
+    static constexpr int32_t kBusy = -2;
+    static constexpr int32_t kErased = -3;
+
+    Hash hash_fn_;
+    KeyEq cmp_fn_;
+
+    std::vector<uint8_t> slots_;
+    int64_t slot_stride_;
+    int64_t slot_key_offset_;
+    int64_t num_slots_;
+    int64_t num_erased_;
+    int64_t size_;
+
+    std::shared_ptr<CPUHashmapBufferContext> buffer_ctx_;
+
+    std::atomic<int32_t>* SlotState(int64_t slot_idx) {
+        return reinterpret_cast<std::atomic<int32_t>*>(slots_.data() +
+                                                       slot_idx * slot_stride_);
+    }
+    const std::atomic<int32_t>* SlotState(int64_t slot_idx) const {
+        return reinterpret_cast<const std::atomic<int32_t>*>(
+                slots_.data() + slot_idx * slot_stride_);
+    }
+    uint8_t* SlotKey(int64_t slot_idx) {
+        return slots_.data() + slot_idx * slot_stride_ + slot_key_offset_;
+    }
+
+    int64_t FirstSlot(const void* key) const {
+        // Mix the high bits in, since the probe start only uses the low bits.
+        uint64_t hash = hash_fn_(key);
+        hash ^= hash >> 33;
+        hash *= UINT64_C(0xff51afd7ed558ccd);
+        hash ^= hash >> 33;
+        return static_cast<int64_t>(hash & (num_slots_ - 1));
+    }
+
+    /// Returns the slot holding \p key, or -1 if the key is not present.
+    int64_t FindSlot(const void* key) {
+        int64_t slot_idx = FirstSlot(key);
+        while (true) {
+            int32_t state =
+                    SlotState(slot_idx)->load(std::memory_order_acquire);
+            if (state == kEmpty) {
+                return -1;
+            }
+            if (state == kBusy) {
+                // Wait until the key of the slot is written.
+                std::this_thread::yield();
+                continue;
+            }
+            if (state >= 0 && cmp_fn_(SlotKey(slot_idx), key)) {
+                return slot_idx;
+            }
+            slot_idx = (slot_idx + 1) & (num_slots_ - 1);
+        }
+    }
+
+    /// Reserves buffer and table space for \p count more keys, growing or
+    /// rebuilding the table if needed.
+    void Reserve(int64_t count);
+
+    void InsertImpl(const void* input_keys,
+                    const void* input_values,
+                    addr_t* output_addrs,
+                    bool* output_masks,
+                    int64_t count);
+
+    void Allocate(int64_t capacity, int64_t buckets);
+};
+
+template <typename Hash, typename KeyEq>
+CPULinearProbingHashmap<Hash, KeyEq>::CPULinearProbingHashmap(
+        int64_t init_buckets,
+        int64_t init_capacity,
+        int64_t dsize_key,
+        int64_t dsize_value,
+        const Device& device)
+    : DeviceHashmap<Hash, KeyEq>(
+              init_buckets, init_capacity, dsize_key, dsize_value, device),
+      hash_fn_(dsize_key),
+      cmp_fn_(dsize_key) {
+    Allocate(init_capacity, init_buckets);
+}
+
+template <typename Hash, typename KeyEq>
+CPULinearProbingHashmap<Hash, KeyEq>::~CPULinearProbingHashmap() {}
+
+template <typename Hash, typename KeyEq>
+int64_t CPULinearProbingHashmap<Hash, KeyEq>::Size() const {
+    return size_;
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::Insert(const void* input_keys,
+                                                  const void* input_values,
+                                                  addr_t* output_addrs,
+                                                  bool* output_masks,
+                                                  int64_t count) {
+    Reserve(count);
+    InsertImpl(input_keys, input_values, output_addrs, output_masks, count);
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::Activate(const void* input_keys,
+                                                    addr_t* output_addrs,
+                                                    bool* output_masks,
+                                                    int64_t count) {
+    Reserve(count);
+    InsertImpl(input_keys, nullptr, output_addrs, output_masks, count);
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::Find(const void* input_keys,
+                                                addr_t* output_addrs,
+                                                bool* output_masks,
+                                                int64_t count) {
+#pragma omp parallel for
+    for (int64_t i = 0; i < count; ++i) {
+        const uint8_t* key =
+                static_cast<const uint8_t*>(input_keys) + this->dsize_key_ * i;
+
+        int64_t slot_idx = FindSlot(key);
+        bool flag = (slot_idx >= 0);
+        output_masks[i] = flag;
+        output_addrs[i] =
+                flag ? SlotState(slot_idx)->load(std::memory_order_relaxed)
+                     : 0;
+    }
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::Erase(const void* input_keys,
+                                                 bool* output_masks,
+                                                 int64_t count) {
+    int64_t num_erased = 0;
+#pragma omp parallel for reduction(+ : num_erased)
+    for (int64_t i = 0; i < count; ++i) {
+        const uint8_t* key =
+                static_cast<const uint8_t*>(input_keys) + this->dsize_key_ * i;
+
+        bool flag = false;
+        int64_t slot_idx = FindSlot(key);
+        if (slot_idx >= 0) {
+            // Only one of the duplicates of a key in a batch wins.
+            std::atomic<int32_t>* slot_state = SlotState(slot_idx);
+            int32_t state = slot_state->load(std::memory_order_relaxed);
+            flag = state >= 0 &&
+                   slot_state->compare_exchange_strong(
+                           state, kErased, std::memory_order_acq_rel);
+            if (flag) {
+                buffer_ctx_->DeviceFree(static_cast<addr_t>(state));
+                ++num_erased;
+            }
+        }
+        output_masks[i] = flag;
+    }
+    size_ -= num_erased;
+    num_erased_ += num_erased;
+}
+
+template <typename Hash, typename KeyEq>
+int64_t CPULinearProbingHashmap<Hash, KeyEq>::GetActiveIndices(
+        addr_t* output_indices) {
+    int64_t count = 0;
+    for (int64_t slot_idx = 0; slot_idx < num_slots_; ++slot_idx) {
+        int32_t state = SlotState(slot_idx)->load(std::memory_order_relaxed);
+        if (state >= 0) {
+            output_indices[count++] = static_cast<addr_t>(state);
+        }
+    }
+    return count;
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::Rehash(int64_t buckets) {
+    int64_t iterator_count = Size();
+
+    Tensor active_keys;
+    Tensor active_values;
+
+    if (iterator_count > 0) {
+        Tensor active_addrs({iterator_count}, Dtype::Int32, this->device_);
+        GetActiveIndices(static_cast<addr_t*>(active_addrs.GetDataPtr()));
+
+        Tensor active_indices = active_addrs.To(Dtype::Int64);
+        active_keys = this->GetKeyBuffer().IndexGet({active_indices});
+        active_values = this->GetValueBuffer().IndexGet({active_indices});
+    }
+
+    float avg_capacity_per_bucket =
+            float(this->capacity_) / float(this->bucket_count_);
+
+    int64_t new_capacity =
+            int64_t(std::ceil(buckets * avg_capacity_per_bucket));
+    Allocate(new_capacity, buckets);
+
+    if (iterator_count > 0) {
+        Tensor output_addrs({iterator_count}, Dtype::Int32, this->device_);
+        Tensor output_masks({iterator_count}, Dtype::Bool, this->device_);
+
+        InsertImpl(active_keys.GetDataPtr(), active_values.GetDataPtr(),
+                   static_cast<addr_t*>(output_addrs.GetDataPtr()),
+                   output_masks.GetDataPtr<bool>(), iterator_count);
+    }
+}
+
+template <typename Hash, typename KeyEq>
+std::vector<int64_t> CPULinearProbingHashmap<Hash, KeyEq>::BucketSizes()
+        const {
+    std::vector<int64_t> ret(num_slots_);
+    for (int64_t slot_idx = 0; slot_idx < num_slots_; ++slot_idx) {
+        ret[slot_idx] =
+                SlotState(slot_idx)->load(std::memory_order_relaxed) >= 0 ? 1
+                                                                           : 0;
+    }
+    return ret;
+}
+
+template <typename Hash, typename KeyEq>
+float CPULinearProbingHashmap<Hash, KeyEq>::LoadFactor() const {
+    return float(size_) / float(num_slots_);
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::Reserve(int64_t count) {
+    int64_t new_size = Size() + count;
+    if (new_size > this->capacity_) {
+        float avg_capacity_per_bucket =
+                float(this->capacity_) / float(this->bucket_count_);
+        int64_t expected_buckets = std::max(
+                this->bucket_count_ * 2,
+                int64_t(std::ceil(new_size / avg_capacity_per_bucket)));
+        Rehash(expected_buckets);
+    } else if (new_size + num_erased_ > num_slots_ / 2) {
+        // Drop the tombstones, which would otherwise lengthen probe sequences
+        // and eventually fill the table.
+        Rehash(this->bucket_count_);
+    }
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::InsertImpl(const void* input_keys,
+                                                      const void* input_values,
+                                                      addr_t* output_addrs,
+                                                      bool* output_masks,
+                                                      int64_t count) {
+    int64_t num_inserted = 0;
+#pragma omp parallel for reduction(+ : num_inserted)
+    for (int64_t i = 0; i < count; ++i) {
+        const uint8_t* src_key =
+                static_cast<const uint8_t*>(input_keys) + this->dsize_key_ * i;
+
+        output_addrs[i] = 0;
+        output_masks[i] = false;
+        int64_t slot_idx = FirstSlot(src_key);
+        while (true) {
+            std::atomic<int32_t>* slot_state = SlotState(slot_idx);
+            int32_t state = slot_state->load(std::memory_order_acquire);
+            if (state == kEmpty) {
+                if (!slot_state->compare_exchange_strong(
+                            state, kBusy, std::memory_order_acq_rel)) {
+                    // Another thread claimed the slot, check its key.
+                    continue;
+                }
+                std::memcpy(SlotKey(slot_idx), src_key, this->dsize_key_);
+
+                addr_t dst_kv_addr = buffer_ctx_->DeviceAllocate();
+                auto dst_kv_iter = buffer_ctx_->ExtractIterator(dst_kv_addr);
+
+                uint8_t* dst_key = static_cast<uint8_t*>(dst_kv_iter.first);
+                uint8_t* dst_value = static_cast<uint8_t*>(dst_kv_iter.second);
+                std::memcpy(dst_key, src_key, this->dsize_key_);
+
+                if (input_values != nullptr) {
+                    const uint8_t* src_value =
+                            static_cast<const uint8_t*>(input_values) +
+                            this->dsize_value_ * i;
+                    std::memcpy(dst_value, src_value, this->dsize_value_);
+                } else {
+                    std::memset(dst_value, 0, this->dsize_value_);
+                }
+
+                slot_state->store(static_cast<int32_t>(dst_kv_addr),
+                                  std::memory_order_release);
+                output_addrs[i] = dst_kv_addr;
+                output_masks[i] = true;
+                ++num_inserted;
+                break;
+            }
+            if (state == kBusy) {
+                // Wait until the key of the slot is written.
+                std::this_thread::yield();
+                continue;
+            }
+            if (state >= 0 && cmp_fn_(SlotKey(slot_idx), src_key)) {
+                break;
+            }
+            slot_idx = (slot_idx + 1) & (num_slots_ - 1);
+        }
+    }
+    size_ += num_inserted;
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::Allocate(int64_t capacity,
+                                                    int64_t buckets) {
+    this->capacity_ = capacity;
+
+    this->buffer_ =
+            std::make_shared<HashmapBuffer>(this->capacity_, this->dsize_key_,
+                                            this->dsize_value_, this->device_);
+
+    buffer_ctx_ = std::make_shared<CPUHashmapBufferContext>(
+            this->capacity_, this->dsize_key_, this->dsize_value_,
+            this->buffer_->GetKeyBuffer(), this->buffer_->GetValueBuffer(),
+            this->buffer_->GetHeap());
+    buffer_ctx_->Reset();
+
+    // Power-of-two table with a load factor of at most 0.5.
+    num_slots_ = 1;
+    while (num_slots_ < std::max(buckets, 2 * capacity)) {
+        num_slots_ *= 2;
+    }
+    this->bucket_count_ = num_slots_;
+    // A slot is the atomic state followed by the key. Keys are aligned to
+    // the largest power of two dividing their size (up to 8 bytes), and the
+    // stride keeps both the state and the key of every slot aligned.
+    int64_t key_align = 1;
+    while (key_align < 8 && this->dsize_key_ % (2 * key_align) == 0) {
+        key_align *= 2;
+    }
+    const int64_t slot_align = std::max<int64_t>(
+            alignof(std::atomic<int32_t>), key_align);
+    slot_key_offset_ = std::max<int64_t>(sizeof(std::atomic<int32_t>),
+                                         key_align);
+    slot_stride_ = (slot_key_offset_ + this->dsize_key_ + slot_align - 1) /
+                   slot_align * slot_align;
+    slots_.resize(num_slots_ * slot_stride_);
+#pragma omp parallel for
+    for (int64_t slot_idx = 0; slot_idx < num_slots_; ++slot_idx) {
+        new (SlotState(slot_idx)) std::atomic<int32_t>(kEmpty);
+    }
+    num_erased_ = 0;
+    size_ = 0;
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -35,7 +35,12 @@ std::shared_ptr<DefaultDeviceHashmap> CreateDefaultCUDAHashmap(
         int64_t init_capacity,
         int64_t dsize_key,
         int64_t dsize_value,
-        const Device& device) {
+        const Device& device,
+        const HashmapBackend& backend) {
+    if (backend != HashmapBackend::Default && backend != HashmapBackend::Slab) {
+        utility::LogError(
+                "[CreateDefaultCUDAHashmap]: Unsupported backend for CUDA");
+    }
     return std::make_shared<CUDAHashmap<DefaultHash, DefaultKeyEq>>(
             init_buckets, init_capacity, dsize_key, dsize_value, device);
 }
@@ -29,6 +29,7 @@
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
 #include "open3d/core/hashmap/HashmapBuffer.h"
 
 namespace open3d {
@@ -184,7 +185,8 @@ public:
 };
 
 /// Factory functions:
-/// - Default constructor switch is in DeviceHashmap.cpp
+/// - Default constructor switch is in DeviceHashmap.cpp, which also selects
+///   the backend, see HashmapBackend
 /// - Default CPU constructor is in CPU/DefaultHashmapCPU.cpp
 /// - Default CUDA constructor is in CUDA/DefaultHashmapCUDA.cu
 
@@ -198,21 +200,24 @@ std::shared_ptr<DefaultDeviceHashmap> CreateDefaultDeviceHashmap(
         int64_t init_capacity,
         int64_t dsize_key,
         int64_t dsize_value,
-        const Device& device);
+        const Device& device,
+        const HashmapBackend& backend = HashmapBackend::Default);
 
 std::shared_ptr<DefaultDeviceHashmap> CreateDefaultCPUHashmap(
         int64_t init_buckets,
         int64_t init_capacity,
         int64_t dsize_key,
         int64_t dsize_value,
-        const Device& device);
+        const Device& device,
+        const HashmapBackend& backend = HashmapBackend::Default);
 
 std::shared_ptr<DefaultDeviceHashmap> CreateDefaultCUDAHashmap(
         int64_t init_buckets,
         int64_t init_capacity,
         int64_t dsize_key,
         int64_t dsize_value,
-        const Device& device);
+        const Device& device,
+        const HashmapBackend& backend = HashmapBackend::Default);
 
 }  // namespace core
 }  // namespace open3d
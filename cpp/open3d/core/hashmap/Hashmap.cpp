@@ -45,8 +45,10 @@ Hashmap::Hashmap(int64_t init_capacity,
                  const Dtype& dtype_value,
                  const SizeVector& element_shape_key,
                  const SizeVector& element_shape_value,
-                 const Device& device)
-    : dtype_key_(dtype_key),
+                 const Device& device,
+                 const HashmapBackend& backend)
+    : backend_(backend),
+      dtype_key_(dtype_key),
       dtype_value_(dtype_value),
       element_shape_key_(element_shape_key),
       element_shape_value_(element_shape_value) {
@@ -68,7 +70,7 @@ Hashmap::Hashmap(int64_t init_capacity,
             init_capacity,
             dtype_key.ByteSize() * element_shape_key_.NumElements(),
             dtype_value.ByteSize() * element_shape_value_.NumElements(),
-            device);
+            device, backend_);
 }
 
 void Hashmap::Rehash(int64_t buckets) {
@@ -207,8 +209,13 @@ Hashmap Hashmap::To(const Device& device, bool copy) const {
         return *this;
     }
 
+    // Backends are device specific, keep the backend on the same device type.
+    HashmapBackend backend = device.GetType() == GetDevice().GetType()
+                                     ? backend_
+                                     : HashmapBackend::Default;
     Hashmap new_hashmap(GetCapacity(), dtype_key_, dtype_value_,
-                        element_shape_key_, element_shape_value_, device);
+                        element_shape_key_, element_shape_value_, device,
+                        backend);
 
     Tensor keys = GetKeyTensor().To(device, /*copy=*/true);
     Tensor values = GetValueTensor().To(device, /*copy=*/true);
@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#pragma once
+
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/HashmapBuffer.h"
@@ -39,6 +41,13 @@ template <typename Hash, typename KeyEq>
 class DeviceHashmap;
 typedef DeviceHashmap<DefaultHash, DefaultKeyEq> DefaultDeviceHashmap;
 
+/// Hash table implementations behind Hashmap.
+/// - Default: TBB on CPU, Slab on CUDA.
+/// - TBB: CPU only, tbb::concurrent_unordered_map over the key buffer.
+/// - LinearProbing: CPU only, open addressing with keys stored in the table.
+/// - Slab: CUDA only, slab hash.
+enum class HashmapBackend { Default, TBB, LinearProbing, Slab };
+
 class Hashmap {
 public:
     static constexpr int64_t kDefaultElemsPerBucket = 4;
@@ -62,7 +71,8 @@ public:
             const Dtype& dtype_value,
             const SizeVector& element_shape_key,
             const SizeVector& element_shape_value,
-            const Device& device);
+            const Device& device,
+            const HashmapBackend& backend = HashmapBackend::Default);
 
     ~Hashmap(){};
 
@@ -151,6 +161,7 @@ protected:
 
 private:
     std::shared_ptr<DefaultDeviceHashmap> device_hashmap_;
+    HashmapBackend backend_;
 
     Dtype dtype_key_ = Dtype::Undefined;
     Dtype dtype_value_ = Dtype::Undefined;
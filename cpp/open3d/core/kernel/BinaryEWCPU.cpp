@@ -132,40 +132,43 @@ static void LaunchBoolBinaryEWCPUKernel(const Tensor& lhs,
                                         const Indexer& indexer) {
     switch (op_code) {
         case BinaryEWOpCode::LogicalAnd:
-            CPULauncher::LaunchBinaryEWKernel(
-                    indexer, CPULogicalAndElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWKernel<
+                    src_t, dst_t,
+                    CPULogicalAndElementKernel<src_t, dst_t>>(indexer);
             break;
         case BinaryEWOpCode::LogicalOr:
-            CPULauncher::LaunchBinaryEWKernel(
-                    indexer, CPULogicalOrElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWKernel<
+                    src_t, dst_t,
+                    CPULogicalOrElementKernel<src_t, dst_t>>(indexer);
             break;
         case BinaryEWOpCode::LogicalXor:
-            CPULauncher::LaunchBinaryEWKernel(
-                    indexer, CPULogicalXorElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWKernel<
+                    src_t, dst_t,
+                    CPULogicalXorElementKernel<src_t, dst_t>>(indexer);
             break;
         case BinaryEWOpCode::Gt:
-            CPULauncher::LaunchBinaryEWKernel(indexer,
-                                              CPUGtElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWKernel<
+                    src_t, dst_t, CPUGtElementKernel<src_t, dst_t>>(indexer);
             break;
         case BinaryEWOpCode::Lt:
-            CPULauncher::LaunchBinaryEWKernel(indexer,
-                                              CPULtElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWKernel<
+                    src_t, dst_t, CPULtElementKernel<src_t, dst_t>>(indexer);
             break;
         case BinaryEWOpCode::Ge:
-            CPULauncher::LaunchBinaryEWKernel(
-                    indexer, CPUGeqElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWKernel<
+                    src_t, dst_t, CPUGeqElementKernel<src_t, dst_t>>(indexer);
             break;
         case BinaryEWOpCode::Le:
-            CPULauncher::LaunchBinaryEWKernel(
-                    indexer, CPULeqElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWKernel<
+                    src_t, dst_t, CPULeqElementKernel<src_t, dst_t>>(indexer);
             break;
         case BinaryEWOpCode::Eq:
-            CPULauncher::LaunchBinaryEWKernel(indexer,
-                                              CPUEqElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWKernel<
+                    src_t, dst_t, CPUEqElementKernel<src_t, dst_t>>(indexer);
             break;
         case BinaryEWOpCode::Ne:
-            CPULauncher::LaunchBinaryEWKernel(
-                    indexer, CPUNeqElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWKernel<
+                    src_t, dst_t, CPUNeqElementKernel<src_t, dst_t>>(indexer);
             break;
         default:
             break;
@@ -206,20 +209,24 @@ void BinaryEWCPU(const Tensor& lhs,
         DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
             switch (op_code) {
                 case BinaryEWOpCode::Add:
-                    CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUAddElementKernel<scalar_t>);
+                    CPULauncher::LaunchBinaryEWKernel<
+                            scalar_t, scalar_t,
+                            CPUAddElementKernel<scalar_t>>(indexer);
                     break;
                 case BinaryEWOpCode::Sub:
-                    CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUSubElementKernel<scalar_t>);
+                    CPULauncher::LaunchBinaryEWKernel<
+                            scalar_t, scalar_t,
+                            CPUSubElementKernel<scalar_t>>(indexer);
                     break;
                 case BinaryEWOpCode::Mul:
-                    CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUMulElementKernel<scalar_t>);
+                    CPULauncher::LaunchBinaryEWKernel<
+                            scalar_t, scalar_t,
+                            CPUMulElementKernel<scalar_t>>(indexer);
                     break;
                 case BinaryEWOpCode::Div:
-                    CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUDivElementKernel<scalar_t>);
+                    CPULauncher::LaunchBinaryEWKernel<
+                            scalar_t, scalar_t,
+                            CPUDivElementKernel<scalar_t>>(indexer);
                     break;
                 default:
                     break;
@@ -27,6 +27,8 @@
 #pragma once
 
 #include <cassert>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "open3d/core/AdvancedIndexing.h"
@@ -41,6 +43,81 @@ namespace kernel {
 
 class CPULauncher {
 public:
+    /// Default minimum number of workloads per thread for element-wise
+    /// kernels. Smaller launches run serially, since the cost of starting a
+    /// parallel region outweighs the work.
+    static constexpr int64_t kDefaultGrainSize = 32768;
+
+    /// Default minimum number of workloads per thread for general kernels,
+    /// whose workloads are typically more expensive than element-wise ones.
+    static constexpr int64_t kDefaultGeneralGrainSize = 1024;
+
+    /// Runs func(workload_idx) for workload_idx in [0, n). Each thread gets at
+    /// least \p grain_size workloads; the loop runs serially if that leaves a
+    /// single thread or if it is called from within a parallel region.
+    template <typename func_t>
+    static void ParallelFor(int64_t n, int64_t grain_size, func_t func) {
+        const int64_t num_threads = GetNumThreadsForWorkloads(n, grain_size);
+        if (num_threads <= 1) {
+            for (int64_t workload_idx = 0; workload_idx < n; ++workload_idx) {
+                func(workload_idx);
+            }
+            return;
+        }
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+        for (int64_t workload_idx = 0; workload_idx < n; ++workload_idx) {
+            func(workload_idx);
+        }
+    }
+
+    /// Runs func(begin, end) on consecutive ranges that partition [0, n), one
+    /// range per thread. Each range holds at least \p grain_size workloads,
+    /// unless n is smaller.
+    template <typename func_t>
+    static void ParallelForRange(int64_t n, int64_t grain_size, func_t func) {
+        const int64_t num_threads = GetNumThreadsForWorkloads(n, grain_size);
+        if (num_threads <= 1) {
+            func(0, n);
+            return;
+        }
+        const int64_t range_size = (n + num_threads - 1) / num_threads;
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+            const int64_t begin = thread_idx * range_size;
+            func(begin, std::min(begin + range_size, n));
+        }
+    }
+
+    /// Returns true if the workloads of \p indexer can be visited with raw
+    /// pointers: the output is contiguous and each input is either contiguous
+    /// or a single value broadcast to all workloads. Dimensions of size 1 are
+    /// ignored, so the check holds for any number of dimensions.
+    static bool IsContiguousOrScalar(const Indexer& indexer) {
+        if (!IsDense(indexer, indexer.GetOutput())) {
+            return false;
+        }
+        for (int64_t i = 0; i < indexer.NumInputs(); ++i) {
+            if (!IsDense(indexer, indexer.GetInput(i)) &&
+                !IsScalarInput(indexer, i)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Returns true if input \p input_idx of \p indexer is a single value
+    /// broadcast to all workloads.
+    static bool IsScalarInput(const Indexer& indexer, int64_t input_idx) {
+        const TensorRef& input = indexer.GetInput(input_idx);
+        for (int64_t dim = 0; dim < indexer.NumDims(); ++dim) {
+            if (indexer.GetMasterShape()[dim] > 1 &&
+                input.byte_strides_[dim] != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     /// Fills tensor[:][i] with element_kernel(i).
     ///
     /// \param indexer The input tensor and output tensor to the indexer are the
@@ -48,48 +125,160 @@ public:
     /// \param element_kernel A function that takes pointer location and
     /// workload_idx, computes the value to fill, and fills the value at the
     /// pointer location.
+    /// \param grain_size Minimum number of workloads per thread.
     template <typename func_t>
     static void LaunchIndexFillKernel(const Indexer& indexer,
-                                      func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx), workload_idx);
-        }
+                                      func_t element_kernel,
+                                      int64_t grain_size = kDefaultGrainSize) {
+        ParallelFor(indexer.NumWorkloads(), grain_size,
+                    [&](int64_t workload_idx) {
+                        element_kernel(indexer.GetInputPtr(0, workload_idx),
+                                       workload_idx);
+                    });
     }
 
     template <typename func_t>
     static void LaunchUnaryEWKernel(const Indexer& indexer,
-                                    func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
-        }
+                                    func_t element_kernel,
+                                    int64_t grain_size = kDefaultGrainSize) {
+        ParallelFor(indexer.NumWorkloads(), grain_size,
+                    [&](int64_t workload_idx) {
+                        element_kernel(indexer.GetInputPtr(0, workload_idx),
+                                       indexer.GetOutputPtr(workload_idx));
+                    });
     }
 
     template <typename func_t>
     static void LaunchBinaryEWKernel(const Indexer& indexer,
-                                     func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetInputPtr(1, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
+                                     func_t element_kernel,
+                                     int64_t grain_size = kDefaultGrainSize) {
+        ParallelFor(indexer.NumWorkloads(), grain_size,
+                    [&](int64_t workload_idx) {
+                        element_kernel(indexer.GetInputPtr(0, workload_idx),
+                                       indexer.GetInputPtr(1, workload_idx),
+                                       indexer.GetOutputPtr(workload_idx));
+                    });
+    }
+
+    /// Same as LaunchUnaryEWKernel, but with the element kernel and the
+    /// element types known at compile time. If the operands are contiguous or
+    /// broadcast scalars, the kernel runs in tight loops over typed pointers
+    /// that the compiler can inline and vectorize.
+    template <typename src_t,
+              typename dst_t,
+              void (*element_kernel)(const void*, void*)>
+    static void LaunchUnaryEWKernel(const Indexer& indexer,
+                                    int64_t grain_size = kDefaultGrainSize) {
+        if (!IsContiguousOrScalar(indexer)) {
+            LaunchUnaryEWKernel(indexer, element_kernel, grain_size);
+            return;
+        }
+        const int64_t n = indexer.NumWorkloads();
+        if (n == 0) {
+            return;
         }
+        const src_t* src =
+                reinterpret_cast<const src_t*>(indexer.GetInputPtr(0, 0));
+        dst_t* dst = reinterpret_cast<dst_t*>(indexer.GetOutputPtr(0));
+        const bool src_scalar = IsScalarInput(indexer, 0);
+        ParallelForRange(n, grain_size, [&](int64_t begin, int64_t end) {
+            if (src_scalar) {
+                for (int64_t i = begin; i < end; ++i) {
+                    element_kernel(src, dst + i);
+                }
+            } else {
+                for (int64_t i = begin; i < end; ++i) {
+                    element_kernel(src + i, dst + i);
+                }
+            }
+        });
     }
 
-    template <typename func_t>
-    static void LaunchAdvancedIndexerKernel(const AdvancedIndexer& indexer,
-                                            func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
+    /// Same as LaunchBinaryEWKernel, but with the element kernel and the
+    /// element types known at compile time. If the operands are contiguous or
+    /// broadcast scalars, the kernel runs in tight loops over typed pointers
+    /// that the compiler can inline and vectorize.
+    template <typename src_t,
+              typename dst_t,
+              void (*element_kernel)(const void*, const void*, void*)>
+    static void LaunchBinaryEWKernel(const Indexer& indexer,
+                                     int64_t grain_size = kDefaultGrainSize) {
+        if (!IsContiguousOrScalar(indexer)) {
+            LaunchBinaryEWKernel(indexer, element_kernel, grain_size);
+            return;
+        }
+        const int64_t n = indexer.NumWorkloads();
+        if (n == 0) {
+            return;
+        }
+        const src_t* lhs =
+                reinterpret_cast<const src_t*>(indexer.GetInputPtr(0, 0));
+        const src_t* rhs =
+                reinterpret_cast<const src_t*>(indexer.GetInputPtr(1, 0));
+        dst_t* dst = reinterpret_cast<dst_t*>(indexer.GetOutputPtr(0));
+        const bool lhs_scalar = IsScalarInput(indexer, 0);
+        const bool rhs_scalar = IsScalarInput(indexer, 1);
+        ParallelForRange(n, grain_size, [&](int64_t begin, int64_t end) {
+            if (lhs_scalar && rhs_scalar) {
+                for (int64_t i = begin; i < end; ++i) {
+                    element_kernel(lhs, rhs, dst + i);
+                }
+            } else if (lhs_scalar) {
+                for (int64_t i = begin; i < end; ++i) {
+                    element_kernel(lhs, rhs + i, dst + i);
+                }
+            } else if (rhs_scalar) {
+                for (int64_t i = begin; i < end; ++i) {
+                    element_kernel(lhs + i, rhs, dst + i);
+                }
+            } else {
+                for (int64_t i = begin; i < end; ++i) {
+                    element_kernel(lhs + i, rhs + i, dst + i);
+                }
+            }
+        });
+    }
+
+    /// Runs element_kernel(src_0, ..., src_{N-1}, dst) for every workload of
+    /// \p indexer, where N = sizeof...(src_ts) is the number of inputs and
+    /// the pointers are typed as src_ts and dst_t. The inputs may have
+    /// different dtypes. If the operands are contiguous or broadcast scalars,
+    /// the kernel runs in tight loops over typed pointers that the compiler
+    /// can inline and vectorize.
+    ///
+    /// \code{.cpp}
+    /// CPULauncher::LaunchNaryEWKernel<float, bool, float, float>(
+    ///         indexer, [](const bool* cond, const float* x, const float* y,
+    ///                     float* dst) { *dst = *cond ? *x : *y; });
+    /// \endcode
+    template <typename dst_t, typename... src_ts, typename func_t>
+    static void LaunchNaryEWKernel(const Indexer& indexer,
+                                   func_t element_kernel,
+                                   int64_t grain_size = kDefaultGrainSize) {
+        static_assert(sizeof...(src_ts) >= 1 &&
+                              sizeof...(src_ts) <= MAX_INPUTS,
+                      "Invalid number of inputs.");
+        if (indexer.NumInputs() != sizeof...(src_ts)) {
+            utility::LogError(
+                    "Internal error: expected {} inputs, but the indexer has "
+                    "{}.",
+                    sizeof...(src_ts), indexer.NumInputs());
         }
+        LaunchNaryEWKernelImpl<dst_t, src_ts...>(
+                indexer, element_kernel, grain_size,
+                std::index_sequence_for<src_ts...>());
+    }
+
+    template <typename func_t>
+    static void LaunchAdvancedIndexerKernel(
+            const AdvancedIndexer& indexer,
+            func_t element_kernel,
+            int64_t grain_size = kDefaultGrainSize) {
+        ParallelFor(indexer.NumWorkloads(), grain_size,
+                    [&](int64_t workload_idx) {
+                        element_kernel(indexer.GetInputPtr(workload_idx),
+                                       indexer.GetOutputPtr(workload_idx));
+                    });
     }
 
     template <typename scalar_t, typename func_t>
@@ -105,21 +294,25 @@ public:
     /// Create num_threads workers to compute partial reductions and then reduce
     /// to the final results. This only applies to reduction op with one output.
     template <typename scalar_t, typename func_t>
-    static void LaunchReductionKernelTwoPass(const Indexer& indexer,
-                                             func_t element_kernel,
-                                             scalar_t identity) {
+    static void LaunchReductionKernelTwoPass(
+            const Indexer& indexer,
+            func_t element_kernel,
+            scalar_t identity,
+            int64_t grain_size = kDefaultGrainSize) {
         if (indexer.NumOutputElements() > 1) {
             utility::LogError(
                     "Internal error: two-pass reduction only works for "
                     "single-output reduction ops.");
         }
         int64_t num_workloads = indexer.NumWorkloads();
-        int64_t num_threads = GetMaxThreads();
+        int64_t num_threads =
+                GetNumThreadsForWorkloads(num_workloads, grain_size);
         int64_t workload_per_thread =
                 (num_workloads + num_threads - 1) / num_threads;
         std::vector<scalar_t> thread_results(num_threads, identity);
 
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(num_threads) \
+        if (num_threads > 1)
         for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
             int64_t start = thread_idx * workload_per_thread;
             int64_t end = std::min(start + workload_per_thread, num_workloads);
@@ -163,21 +356,85 @@ public:
                     "LaunchReductionKernelTwoPass instead.");
         }
 
-#pragma omp parallel for schedule(static)
-        for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
+        // Each slice along best_dim holds the same share of the workloads.
+        const int64_t slice_grain_size = std::max<int64_t>(
+                1, kDefaultGrainSize * indexer_shape[best_dim] /
+                           std::max<int64_t>(indexer.NumWorkloads(), 1));
+        ParallelFor(indexer_shape[best_dim], slice_grain_size, [&](int64_t i) {
             Indexer sub_indexer(indexer);
             sub_indexer.ShrinkDim(best_dim, i, 1);
             LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
-        }
+        });
     }
 
     /// General kernels with non-conventional indexers
     template <typename func_t>
-    static void LaunchGeneralKernel(int64_t n, func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < n; ++workload_idx) {
-            element_kernel(workload_idx);
+    static void LaunchGeneralKernel(
+            int64_t n,
+            func_t element_kernel,
+            int64_t grain_size = kDefaultGeneralGrainSize) {
+        ParallelFor(n, grain_size, element_kernel);
+    }
+
+private:
+    /// Returns true if workload i of \p indexer is element i of \p ref.
+    static bool IsDense(const Indexer& indexer, const TensorRef& ref) {
+        for (int64_t dim = 0; dim < indexer.NumDims(); ++dim) {
+            if (indexer.GetMasterShape()[dim] > 1 &&
+                ref.byte_strides_[dim] != indexer.GetMasterStrides()[dim] *
+                                                  ref.dtype_byte_size_) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename dst_t,
+              typename... src_ts,
+              typename func_t,
+              std::size_t... input_indices>
+    static void LaunchNaryEWKernelImpl(const Indexer& indexer,
+                                       func_t element_kernel,
+                                       int64_t grain_size,
+                                       std::index_sequence<input_indices...>) {
+        const int64_t n = indexer.NumWorkloads();
+        if (n == 0) {
+            return;
+        }
+        if (!IsContiguousOrScalar(indexer)) {
+            ParallelFor(n, grain_size, [&](int64_t workload_idx) {
+                element_kernel(
+                        reinterpret_cast<const src_ts*>(indexer.GetInputPtr(
+                                input_indices, workload_idx))...,
+                        reinterpret_cast<dst_t*>(
+                                indexer.GetOutputPtr(workload_idx)));
+            });
+            return;
         }
+        const std::tuple<const src_ts*...> srcs(reinterpret_cast<const src_ts*>(
+                indexer.GetInputPtr(input_indices, 0))...);
+        dst_t* dst = reinterpret_cast<dst_t*>(indexer.GetOutputPtr(0));
+        // Workload i reads srcs[k] + i * src_steps[k].
+        const int64_t src_steps[] = {
+                (IsScalarInput(indexer, input_indices) ? 0 : 1)...};
+        bool any_scalar = false;
+        for (int64_t step : src_steps) {
+            any_scalar = any_scalar || step == 0;
+        }
+        ParallelForRange(n, grain_size, [&](int64_t begin, int64_t end) {
+            if (any_scalar) {
+                for (int64_t i = begin; i < end; ++i) {
+                    element_kernel(std::get<input_indices>(srcs) +
+                                           i * src_steps[input_indices]...,
+                                   dst + i);
+                }
+            } else {
+                for (int64_t i = begin; i < end; ++i) {
+                    element_kernel(std::get<input_indices>(srcs) + i...,
+                                   dst + i);
+                }
+            }
+        });
     }
 };
 
@@ -0,0 +1,133 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/FusedEW.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Checks that every instruction only refers to existing inputs and to
+/// earlier instructions.
+static void CheckProgram(const std::vector<Tensor>& inputs,
+                         const std::vector<FusedEWInstruction>& program) {
+    if (inputs.empty() || program.empty()) {
+        utility::LogError("FusedEW: empty inputs or program.");
+    }
+    const int64_t num_inputs = static_cast<int64_t>(inputs.size());
+    for (int64_t i = 0; i < static_cast<int64_t>(program.size()); ++i) {
+        const FusedEWInstruction& instruction = program[i];
+        bool valid;
+        switch (instruction.op_code) {
+            case FusedEWOpCode::Input:
+                valid = instruction.lhs >= 0 && instruction.lhs < num_inputs;
+                break;
+            case FusedEWOpCode::Add:
+            case FusedEWOpCode::Sub:
+            case FusedEWOpCode::Mul:
+            case FusedEWOpCode::Div:
+                valid = instruction.lhs >= 0 && instruction.lhs < i &&
+                        instruction.rhs >= 0 && instruction.rhs < i;
+                break;
+            default:
+                valid = instruction.lhs >= 0 && instruction.lhs < i;
+                break;
+        }
+        if (!valid) {
+            utility::LogError("FusedEW: invalid operand in instruction {}.",
+                              i);
+        }
+    }
+    for (const Tensor& input : inputs) {
+        if (input.GetDevice() != inputs[0].GetDevice()) {
+            utility::LogError("FusedEW: device mismatch {} != {}.",
+                              input.GetDevice().ToString(),
+                              inputs[0].GetDevice().ToString());
+        }
+    }
+}
+
+void FusedEW(const std::vector<Tensor>& inputs,
+             const std::vector<FusedEWInstruction>& program,
+             Tensor& dst) {
+    CheckProgram(inputs, program);
+    for (const Tensor& input : inputs) {
+        if (!shape_util::CanBeBrocastedToShape(input.GetShape(),
+                                               dst.GetShape())) {
+            utility::LogError("Shape {} can not be broadcasted to {}.",
+                              input.GetShape(), dst.GetShape());
+        }
+    }
+    if (dst.GetDevice() != inputs[0].GetDevice()) {
+        utility::LogError("FusedEW: device mismatch {} != {}.",
+                          dst.GetDevice().ToString(),
+                          inputs[0].GetDevice().ToString());
+    }
+
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        FusedEWCPU(inputs, program, dst);
+    } else {
+        utility::LogError("FusedEW: Unimplemented device");
+    }
+}
+
+void FusedEWReduction(const std::vector<Tensor>& inputs,
+                      const std::vector<FusedEWInstruction>& program,
+                      const SizeVector& shape,
+                      Tensor& dst,
+                      ReductionOpCode op_code) {
+    CheckProgram(inputs, program);
+    for (const Tensor& input : inputs) {
+        if (!shape_util::CanBeBrocastedToShape(input.GetShape(), shape)) {
+            utility::LogError("Shape {} can not be broadcasted to {}.",
+                              input.GetShape(), shape);
+        }
+    }
+    if (dst.NumDims() != 0) {
+        utility::LogError("FusedEWReduction: expected 0-dim output, got {}.",
+                          dst.GetShape());
+    }
+    if (s_regular_reduce_ops.find(op_code) == s_regular_reduce_ops.end()) {
+        utility::LogError("FusedEWReduction: unsupported op code.");
+    }
+
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        FusedEWReductionCPU(inputs, program, shape, dst, op_code);
+    } else {
+        utility::LogError("FusedEWReduction: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
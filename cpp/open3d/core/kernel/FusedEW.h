@@ -0,0 +1,88 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Reduction.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+enum class FusedEWOpCode {
+    Input,  // Loads input tensor lhs.
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Neg,
+    Abs,
+    Sqrt,
+};
+
+/// One step of a fused element-wise program. Each instruction produces one
+/// value per element. lhs and rhs refer to the values of earlier instructions,
+/// except for FusedEWOpCode::Input where lhs is the index of the input tensor.
+/// Unary ops only use lhs. The last instruction produces the result.
+struct FusedEWInstruction {
+    FusedEWOpCode op_code;
+    int64_t lhs;
+    int64_t rhs;
+};
+
+/// Evaluates \p program for every element of \p dst in a single pass. The
+/// inputs are broadcast to the shape of \p dst and must have the same dtype
+/// and device as \p dst.
+void FusedEW(const std::vector<Tensor>& inputs,
+             const std::vector<FusedEWInstruction>& program,
+             Tensor& dst);
+
+/// Evaluates \p program for every element of \p shape and reduces all results
+/// to the 0-dim tensor \p dst with \p op_code, which must be one of Sum, Prod,
+/// Min and Max. The results are never materialized.
+void FusedEWReduction(const std::vector<Tensor>& inputs,
+                      const std::vector<FusedEWInstruction>& program,
+                      const SizeVector& shape,
+                      Tensor& dst,
+                      ReductionOpCode op_code);
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const std::vector<FusedEWInstruction>& program,
+                Tensor& dst);
+
+void FusedEWReductionCPU(const std::vector<Tensor>& inputs,
+                         const std::vector<FusedEWInstruction>& program,
+                         const SizeVector& shape,
+                         Tensor& dst,
+                         ReductionOpCode op_code);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,333 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Number of workloads each instruction processes before the next instruction
+/// runs. The intermediate values of a block stay in the L1 cache, so a program
+/// reads its inputs and writes its output once.
+static constexpr int64_t kFusedEWBlockSize = 256;
+
+/// Values are computed in float for Float16 and in the storage type otherwise.
+template <typename scalar_t>
+struct FusedEWComputeType {
+    using type = scalar_t;
+};
+
+template <>
+struct FusedEWComputeType<Float16> {
+    using type = float;
+};
+
+/// Layout of an operand relative to the Indexer's workloads.
+enum class FusedEWLayout {
+    Dense,   // Workload i is at data_ptr + i.
+    Scalar,  // All workloads read data_ptr.
+    Strided,
+};
+
+static FusedEWLayout GetLayout(const Indexer& indexer, const TensorRef& ref) {
+    bool dense = true;
+    bool scalar = true;
+    for (int64_t dim = 0; dim < indexer.NumDims(); ++dim) {
+        if (indexer.GetMasterShape()[dim] <= 1) {
+            continue;
+        }
+        dense = dense && ref.byte_strides_[dim] ==
+                                 indexer.GetMasterStrides()[dim] *
+                                         ref.dtype_byte_size_;
+        scalar = scalar && ref.byte_strides_[dim] == 0;
+    }
+    return scalar ? FusedEWLayout::Scalar
+                  : (dense ? FusedEWLayout::Dense : FusedEWLayout::Strided);
+}
+
+template <typename scalar_t>
+class CPUFusedEWProgram {
+public:
+    using compute_t = typename FusedEWComputeType<scalar_t>::type;
+
+    CPUFusedEWProgram(const Indexer& indexer,
+                      const std::vector<FusedEWInstruction>& program)
+        : indexer_(indexer), program_(program) {
+        for (int64_t i = 0; i < indexer.NumInputs(); ++i) {
+            input_layouts_.push_back(GetLayout(indexer, indexer.GetInput(i)));
+        }
+    }
+
+    /// Number of values a thread needs in its registers buffer.
+    int64_t NumRegisters() const {
+        return static_cast<int64_t>(program_.size()) * kFusedEWBlockSize;
+    }
+
+    /// Evaluates the program for workloads [begin, begin + n), with
+    /// n <= kFusedEWBlockSize, and returns the n results.
+    const compute_t* Run(int64_t begin, int64_t n, compute_t* registers) const {
+        compute_t* dst = registers;
+        for (const FusedEWInstruction& instruction : program_) {
+            if (instruction.op_code == FusedEWOpCode::Input) {
+                Load(instruction.lhs, begin, n, dst);
+                dst += kFusedEWBlockSize;
+                continue;
+            }
+            const compute_t* lhs =
+                    registers + instruction.lhs * kFusedEWBlockSize;
+            const compute_t* rhs =
+                    registers + instruction.rhs * kFusedEWBlockSize;
+            switch (instruction.op_code) {
+                case FusedEWOpCode::Add:
+                    for (int64_t i = 0; i < n; ++i) {
+                        dst[i] = static_cast<compute_t>(lhs[i] + rhs[i]);
+                    }
+                    break;
+                case FusedEWOpCode::Sub:
+                    for (int64_t i = 0; i < n; ++i) {
+                        dst[i] = static_cast<compute_t>(lhs[i] - rhs[i]);
+                    }
+                    break;
+                case FusedEWOpCode::Mul:
+                    for (int64_t i = 0; i < n; ++i) {
+                        dst[i] = static_cast<compute_t>(lhs[i] * rhs[i]);
+                    }
+                    break;
+                case FusedEWOpCode::Div:
+                    for (int64_t i = 0; i < n; ++i) {
+                        dst[i] = static_cast<compute_t>(lhs[i] / rhs[i]);
+                    }
+                    break;
+                case FusedEWOpCode::Neg:
+                    for (int64_t i = 0; i < n; ++i) {
+                        dst[i] = static_cast<compute_t>(-lhs[i]);
+                    }
+                    break;
+                case FusedEWOpCode::Abs:
+                    for (int64_t i = 0; i < n; ++i) {
+                        dst[i] = static_cast<compute_t>(
+                                std::abs(static_cast<double>(lhs[i])));
+                    }
+                    break;
+                case FusedEWOpCode::Sqrt:
+                    for (int64_t i = 0; i < n; ++i) {
+                        dst[i] = static_cast<compute_t>(std::sqrt(lhs[i]));
+                    }
+                    break;
+                default:
+                    utility::LogError("Unsupported op code.");
+            }
+            dst += kFusedEWBlockSize;
+        }
+        return dst - kFusedEWBlockSize;
+    }
+
+private:
+    void Load(int64_t input_idx,
+              int64_t begin,
+              int64_t n,
+              compute_t* dst) const {
+        switch (input_layouts_[input_idx]) {
+            case FusedEWLayout::Dense: {
+                const scalar_t* src = reinterpret_cast<const scalar_t*>(
+                                              indexer_.GetInputPtr(input_idx,
+                                                                   0)) +
+                                      begin;
+                for (int64_t i = 0; i < n; ++i) {
+                    dst[i] = static_cast<compute_t>(src[i]);
+                }
+                break;
+            }
+            case FusedEWLayout::Scalar: {
+                const compute_t value = static_cast<compute_t>(
+                        *reinterpret_cast<const scalar_t*>(
+                                indexer_.GetInputPtr(input_idx, 0)));
+                for (int64_t i = 0; i < n; ++i) {
+                    dst[i] = value;
+                }
+                break;
+            }
+            default:
+                for (int64_t i = 0; i < n; ++i) {
+                    dst[i] = static_cast<compute_t>(
+                            *reinterpret_cast<const scalar_t*>(
+                                    indexer_.GetInputPtr(input_idx,
+                                                         begin + i)));
+                }
+                break;
+        }
+    }
+
+    const Indexer& indexer_;
+    const std::vector<FusedEWInstruction>& program_;
+    std::vector<FusedEWLayout> input_layouts_;
+};
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const std::vector<FusedEWInstruction>& program,
+                Tensor& dst) {
+    Indexer indexer(inputs, dst, DtypePolicy::ALL_SAME);
+    const int64_t n = indexer.NumWorkloads();
+    if (n == 0) {
+        return;
+    }
+    const bool dst_dense =
+            GetLayout(indexer, indexer.GetOutput()) == FusedEWLayout::Dense;
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        using compute_t = typename CPUFusedEWProgram<scalar_t>::compute_t;
+        CPUFusedEWProgram<scalar_t> fused_program(indexer, program);
+        scalar_t* dst_ptr =
+                reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
+        CPULauncher::ParallelForRange(
+                n, CPULauncher::kDefaultGrainSize,
+                [&](int64_t begin, int64_t end) {
+                    std::vector<compute_t> registers(
+                            fused_program.NumRegisters());
+                    for (int64_t block_begin = begin; block_begin < end;
+                         block_begin += kFusedEWBlockSize) {
+                        const int64_t block_size = std::min(
+                                kFusedEWBlockSize, end - block_begin);
+                        const compute_t* result = fused_program.Run(
+                                block_begin, block_size, registers.data());
+                        for (int64_t i = 0; i < block_size; ++i) {
+                            scalar_t* ptr =
+                                    dst_dense
+                                            ? dst_ptr + block_begin + i
+                                            : reinterpret_cast<scalar_t*>(
+                                                      indexer.GetOutputPtr(
+                                                              block_begin + i));
+                            *ptr = static_cast<scalar_t>(result[i]);
+                        }
+                    }
+                });
+    });
+}
+
+/// Reduces the program results with reduce_func in chunks of
+/// CPULauncher::kDefaultGrainSize workloads, then reduces the chunk results in
+/// order. The result does not depend on the number of threads.
+template <typename scalar_t, typename func_t>
+static typename CPUFusedEWProgram<scalar_t>::compute_t ReduceFusedEW(
+        const CPUFusedEWProgram<scalar_t>& fused_program,
+        int64_t n,
+        typename CPUFusedEWProgram<scalar_t>::compute_t identity,
+        func_t reduce_func) {
+    using compute_t = typename CPUFusedEWProgram<scalar_t>::compute_t;
+    const int64_t chunk_size = CPULauncher::kDefaultGrainSize;
+    const int64_t num_chunks = (n + chunk_size - 1) / chunk_size;
+    std::vector<compute_t> chunk_results(num_chunks, identity);
+    CPULauncher::ParallelFor(num_chunks, 1, [&](int64_t chunk_idx) {
+        std::vector<compute_t> registers(fused_program.NumRegisters());
+        const int64_t end = std::min(n, (chunk_idx + 1) * chunk_size);
+        compute_t acc = identity;
+        for (int64_t block_begin = chunk_idx * chunk_size; block_begin < end;
+             block_begin += kFusedEWBlockSize) {
+            const int64_t block_size =
+                    std::min(kFusedEWBlockSize, end - block_begin);
+            const compute_t* result = fused_program.Run(
+                    block_begin, block_size, registers.data());
+            for (int64_t i = 0; i < block_size; ++i) {
+                acc = reduce_func(acc, result[i]);
+            }
+        }
+        chunk_results[chunk_idx] = acc;
+    });
+    compute_t acc = identity;
+    for (const compute_t& chunk_result : chunk_results) {
+        acc = reduce_func(acc, chunk_result);
+    }
+    return acc;
+}
+
+void FusedEWReductionCPU(const std::vector<Tensor>& inputs,
+                         const std::vector<FusedEWInstruction>& program,
+                         const SizeVector& shape,
+                         Tensor& dst,
+                         ReductionOpCode op_code) {
+    // The Indexer needs an output of the full shape to broadcast the inputs.
+    // A broadcast view of dst is used, since the results are never stored.
+    Indexer indexer(inputs, dst.Expand(shape), DtypePolicy::ALL_SAME);
+    const int64_t n = indexer.NumWorkloads();
+    if (n == 0 &&
+        (op_code == ReductionOpCode::Min || op_code == ReductionOpCode::Max)) {
+        utility::LogError("Zero-size Tensor does not suport Min or Max.");
+    }
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        using compute_t = typename CPUFusedEWProgram<scalar_t>::compute_t;
+        CPUFusedEWProgram<scalar_t> fused_program(indexer, program);
+        compute_t result;
+        switch (op_code) {
+            case ReductionOpCode::Sum:
+                result = ReduceFusedEW<scalar_t>(
+                        fused_program, n, compute_t(0),
+                        [](compute_t a, compute_t b) -> compute_t {
+                            return a + b;
+                        });
+                break;
+            case ReductionOpCode::Prod:
+                result = ReduceFusedEW<scalar_t>(
+                        fused_program, n, compute_t(1),
+                        [](compute_t a, compute_t b) -> compute_t {
+                            return a * b;
+                        });
+                break;
+            case ReductionOpCode::Min:
+                result = ReduceFusedEW<scalar_t>(
+                        fused_program, n, std::numeric_limits<compute_t>::max(),
+                        [](compute_t a, compute_t b) -> compute_t {
+                            return a < b ? a : b;
+                        });
+                break;
+            case ReductionOpCode::Max:
+                result = ReduceFusedEW<scalar_t>(
+                        fused_program, n,
+                        std::numeric_limits<compute_t>::lowest(),
+                        [](compute_t a, compute_t b) -> compute_t {
+                            return a > b ? a : b;
+                        });
+                break;
+            default:
+                utility::LogError("Unsupported op code.");
+        }
+        *static_cast<scalar_t*>(dst.GetDataPtr()) =
+                static_cast<scalar_t>(result);
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,101 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/NaryEW.h"
+
+#include <vector>
+
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void NaryEW(const std::vector<Tensor>& srcs,
+            Tensor& dst,
+            NaryEWOpCode op_code) {
+    if (srcs.size() != 3) {
+        utility::LogError("NaryEW expects 3 inputs, but got {}.",
+                          srcs.size());
+    }
+
+    // srcs and dst must be on the same device.
+    for (const Tensor& src : srcs) {
+        if (src.GetDevice() != dst.GetDevice()) {
+            utility::LogError("Device mismatch {} != {}.",
+                              src.GetDevice().ToString(),
+                              dst.GetDevice().ToString());
+        }
+    }
+
+    // The value inputs must have the dtype of dst. Where's condition is Bool.
+    for (size_t i = 0; i < srcs.size(); ++i) {
+        Dtype expected_dtype = dst.GetDtype();
+        if (op_code == NaryEWOpCode::Where && i == 0) {
+            expected_dtype = Dtype::Bool;
+        }
+        if (srcs[i].GetDtype() != expected_dtype) {
+            utility::LogError("Dtype mismatch {} != {}.",
+                              srcs[i].GetDtype().ToString(),
+                              expected_dtype.ToString());
+        }
+    }
+
+    // broadcast(srcs.shape) must be dst.shape.
+    SizeVector broadcasted_input_shape = srcs[0].GetShape();
+    for (const Tensor& src : srcs) {
+        broadcasted_input_shape = shape_util::BroadcastedShape(
+                broadcasted_input_shape, src.GetShape());
+    }
+    if (broadcasted_input_shape != dst.GetShape()) {
+        utility::LogError(
+                "The broadcasted input shape {} does not match the output "
+                "shape {}.",
+                broadcasted_input_shape, dst.GetShape());
+    }
+
+    // There are no CUDA kernels yet: CUDA tensors are computed on the CPU.
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        NaryEWCPU(srcs, dst, op_code);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        std::vector<Tensor> srcs_cpu;
+        for (const Tensor& src : srcs) {
+            srcs_cpu.push_back(src.To(Device("CPU:0")));
+        }
+        Tensor dst_cpu(dst.GetShape(), dst.GetDtype(), Device("CPU:0"));
+        NaryEWCPU(srcs_cpu, dst_cpu, op_code);
+        dst.CopyFrom(dst_cpu);
+    } else {
+        utility::LogError("NaryEW: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
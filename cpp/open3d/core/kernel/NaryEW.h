@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Element-wise ops with more than two inputs. All of them take three inputs.
+enum class NaryEWOpCode {
+    Where,   // dst = srcs[0] ? srcs[1] : srcs[2], srcs[0] is Bool.
+    Clip,    // dst = min(max(srcs[0], srcs[1]), srcs[2]).
+    AddMul,  // dst = srcs[0] + srcs[1] * srcs[2].
+};
+
+/// Broadcasts \p srcs to the shape of \p dst and computes \p op_code element
+/// by element in a single pass.
+void NaryEW(const std::vector<Tensor>& srcs,
+            Tensor& dst,
+            NaryEWOpCode op_code);
+
+void NaryEWCPU(const std::vector<Tensor>& srcs,
+               Tensor& dst,
+               NaryEWOpCode op_code);
+
+inline void Where(const Tensor& condition,
+                  const Tensor& x,
+                  const Tensor& y,
+                  Tensor& dst) {
+    NaryEW({condition, x, y}, dst, NaryEWOpCode::Where);
+}
+
+inline void Clip(const Tensor& src,
+                 const Tensor& min_val,
+                 const Tensor& max_val,
+                 Tensor& dst) {
+    NaryEW({src, min_val, max_val}, dst, NaryEWOpCode::Clip);
+}
+
+inline void AddMul(const Tensor& src,
+                   const Tensor& lhs,
+                   const Tensor& rhs,
+                   Tensor& dst) {
+    NaryEW({src, lhs, rhs}, dst, NaryEWOpCode::AddMul);
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
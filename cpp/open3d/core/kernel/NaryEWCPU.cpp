@@ -0,0 +1,119 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Float16.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/core/kernel/NaryEW.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Returns src + lhs * rhs.
+template <typename scalar_t>
+static inline scalar_t CPUAddMul(scalar_t src, scalar_t lhs, scalar_t rhs) {
+    return static_cast<scalar_t>(src + lhs * rhs);
+}
+
+// Floating point values are computed with a fused multiply-add, which rounds
+// once. std::fma is a library call on targets without an fma instruction.
+static inline float CPUAddMul(float src, float lhs, float rhs) {
+    return std::fma(lhs, rhs, src);
+}
+
+static inline double CPUAddMul(double src, double lhs, double rhs) {
+    return std::fma(lhs, rhs, src);
+}
+
+// Computed as Float32 and rounded to Float16.
+static inline Float16 CPUAddMul(Float16 src, Float16 lhs, Float16 rhs) {
+    return Float16(CPUAddMul(static_cast<float>(src), static_cast<float>(lhs),
+                             static_cast<float>(rhs)));
+}
+
+void NaryEWCPU(const std::vector<Tensor>& srcs,
+               Tensor& dst,
+               NaryEWOpCode op_code) {
+    // srcs and dst have been checked to have compatible shapes, dtypes and
+    // the same device.
+    switch (op_code) {
+        case NaryEWOpCode::Where: {
+            Indexer indexer(srcs, dst, DtypePolicy::NONE);
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst.GetDtype(), [&]() {
+                CPULauncher::LaunchNaryEWKernel<scalar_t, bool, scalar_t,
+                                                scalar_t>(
+                        indexer, [](const bool* condition, const scalar_t* x,
+                                    const scalar_t* y, scalar_t* dst) {
+                            *dst = *condition ? *x : *y;
+                        });
+            });
+            break;
+        }
+        case NaryEWOpCode::Clip: {
+            Indexer indexer(srcs, dst, DtypePolicy::ALL_SAME);
+            DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+                CPULauncher::LaunchNaryEWKernel<scalar_t, scalar_t, scalar_t,
+                                                scalar_t>(
+                        indexer, [](const scalar_t* src,
+                                    const scalar_t* min_val,
+                                    const scalar_t* max_val, scalar_t* dst) {
+                            // NaN stays NaN, as both comparisons are false.
+                            *dst = *src < *min_val
+                                           ? *min_val
+                                           : (*max_val < *src ? *max_val
+                                                              : *src);
+                        });
+            });
+            break;
+        }
+        case NaryEWOpCode::AddMul: {
+            Indexer indexer(srcs, dst, DtypePolicy::ALL_SAME);
+            DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+                CPULauncher::LaunchNaryEWKernel<scalar_t, scalar_t, scalar_t,
+                                                scalar_t>(
+                        indexer, [](const scalar_t* src, const scalar_t* lhs,
+                                    const scalar_t* rhs, scalar_t* dst) {
+                            *dst = CPUAddMul(*src, *lhs, *rhs);
+                        });
+            });
+            break;
+        }
+        default:
+            utility::LogError("Unimplemented op_code for NaryEWCPU");
+            break;
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
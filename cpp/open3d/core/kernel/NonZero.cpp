@@ -49,6 +49,15 @@ Tensor NonZero(const Tensor& src) {
     }
 }
 
+Tensor IndexGetMasked(const Tensor& src, const Tensor& mask) {
+    if (src.GetDevice().GetType() == Device::DeviceType::CPU &&
+        mask.GetDevice().GetType() == Device::DeviceType::CPU) {
+        return IndexGetMaskedCPU(src, mask);
+    } else {
+        utility::LogError("IndexGetMasked: Unimplemented device");
+    }
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
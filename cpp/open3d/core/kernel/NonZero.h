@@ -40,6 +40,13 @@ Tensor NonZeroCPU(const Tensor& src);
 Tensor NonZeroCUDA(const Tensor& src);
 #endif
 
+/// Returns the slices of \p src selected by the boolean \p mask, whose shape
+/// must match the leading dimensions of \p src. Equivalent to
+/// src.IndexGet({mask}), without computing the indices of the selected slices.
+Tensor IndexGetMasked(const Tensor& src, const Tensor& mask);
+
+Tensor IndexGetMaskedCPU(const Tensor& src, const Tensor& mask);
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
@@ -24,53 +24,143 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
-#include "open3d/core/Indexer.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/kernel/CPULauncher.h"
 #include "open3d/core/kernel/NonZero.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/ParallelScan.h"
 
 namespace open3d {
 namespace core {
 namespace kernel {
 
+/// Number of workloads counted and compacted by one task.
+static constexpr int64_t kCompactChunkSize = 32768;
+
+/// Two-pass parallel compaction of the workloads in [0, n) for which
+/// is_selected(workload_idx) holds. The first pass counts the selected
+/// workloads of each chunk, the counts are prefix summed, and the second pass
+/// calls emit(workload_idx, output_idx) with consecutive output indices in
+/// workload order. allocate(num_selected) is called between the two passes.
+template <typename select_func_t, typename alloc_func_t, typename emit_func_t>
+static void ParallelCompact(int64_t n,
+                            select_func_t is_selected,
+                            alloc_func_t allocate,
+                            emit_func_t emit) {
+    const int64_t num_chunks = (n + kCompactChunkSize - 1) / kCompactChunkSize;
+    std::vector<int64_t> chunk_counts(num_chunks, 0);
+    CPULauncher::ParallelFor(num_chunks, 1, [&](int64_t chunk_idx) {
+        const int64_t begin = chunk_idx * kCompactChunkSize;
+        const int64_t end = std::min(begin + kCompactChunkSize, n);
+        int64_t count = 0;
+        for (int64_t workload_idx = begin; workload_idx < end;
+             ++workload_idx) {
+            count += is_selected(workload_idx) ? 1 : 0;
+        }
+        chunk_counts[chunk_idx] = count;
+    });
+
+    // chunk_ends[i] is the output index after the last selection of chunk i.
+    std::vector<int64_t> chunk_ends(num_chunks, 0);
+    if (num_chunks > 0) {
+        utility::InclusivePrefixSum(chunk_counts.data(),
+                                    chunk_counts.data() + num_chunks,
+                                    chunk_ends.data());
+    }
+    allocate(num_chunks > 0 ? chunk_ends.back() : 0);
+
+    CPULauncher::ParallelFor(num_chunks, 1, [&](int64_t chunk_idx) {
+        const int64_t begin = chunk_idx * kCompactChunkSize;
+        const int64_t end = std::min(begin + kCompactChunkSize, n);
+        int64_t output_idx = chunk_ends[chunk_idx] - chunk_counts[chunk_idx];
+        for (int64_t workload_idx = begin; workload_idx < end;
+             ++workload_idx) {
+            if (is_selected(workload_idx)) {
+                emit(workload_idx, output_idx++);
+            }
+        }
+    });
+}
+
 Tensor NonZeroCPU(const Tensor& src) {
-    // Get flattened non-zero indices.
-    TensorIterator src_iter(src);
-    const int64_t num_elements = src.NumElements();
-    std::vector<int64_t> indices(static_cast<size_t>(num_elements));
-    std::iota(std::begin(indices), std::end(indices), 0);
-    std::vector<int64_t> non_zero_indices(num_elements);
+    const Tensor src_contiguous = src.Contiguous();
+    const SizeVector shape = src.GetShape();
+    const int64_t num_dims = src.NumDims();
+    Tensor result;
     DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
-        auto it = std::copy_if(
-                indices.begin(), indices.end(), non_zero_indices.begin(),
-                [&src_iter](int64_t index) {
-                    return static_cast<float>(*static_cast<scalar_t*>(
-                                   src_iter.GetPtr(index))) != 0;
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src_contiguous.GetDataPtr());
+        int64_t num_non_zeros = 0;
+        int64_t* result_ptr = nullptr;
+        ParallelCompact(
+                src.NumElements(),
+                [&](int64_t idx) { return src_ptr[idx] != scalar_t(0); },
+                [&](int64_t num_selected) {
+                    num_non_zeros = num_selected;
+                    result = Tensor({num_dims, num_non_zeros}, Dtype::Int64,
+                                    src.GetDevice());
+                    result_ptr = static_cast<int64_t*>(result.GetDataPtr());
+                },
+                [&](int64_t idx, int64_t output_idx) {
+                    // Transform the flattened index to indices in each
+                    // dimension.
+                    for (int64_t dim = num_dims - 1; dim >= 0; dim--) {
+                        result_ptr[dim * num_non_zeros + output_idx] =
+                                idx % shape[dim];
+                        idx = idx / shape[dim];
+                    }
                 });
-        non_zero_indices.resize(std::distance(non_zero_indices.begin(), it));
     });
+    return result;
+}
 
-    // Transform flattend indices to indices in each dimension.
-    SizeVector shape = src.GetShape();
-    const int64_t num_dims = src.NumDims();
-    const size_t num_non_zeros = non_zero_indices.size();
-
-    SizeVector result_shape{num_dims, static_cast<int64_t>(num_non_zeros)};
-    Tensor result(result_shape, Dtype::Int64, src.GetDevice());
-    TensorIterator result_iter(result);
-
-    std::vector<std::vector<int64_t>> non_zero_indices_by_dimensions(
-            num_dims, std::vector<int64_t>(num_non_zeros, 0));
-#pragma omp parallel for schedule(static)
-    for (int64_t i = 0; i < static_cast<int64_t>(num_non_zeros); i++) {
-        int64_t non_zero_index = non_zero_indices[i];
-        for (int64_t dim = num_dims - 1; dim >= 0; dim--) {
-            *static_cast<int64_t*>(result_iter.GetPtr(
-                    dim * num_non_zeros + i)) = non_zero_index % shape[dim];
-            non_zero_index = non_zero_index / shape[dim];
-        }
+Tensor IndexGetMaskedCPU(const Tensor& src, const Tensor& mask) {
+    if (mask.GetDtype() != Dtype::Bool) {
+        utility::LogError("Mask must be a Bool tensor, but got {}.",
+                          mask.GetDtype().ToString());
+    }
+    const SizeVector& src_shape = src.GetShape();
+    const SizeVector& mask_shape = mask.GetShape();
+    if (mask_shape.size() > src_shape.size() ||
+        !std::equal(mask_shape.begin(), mask_shape.end(),
+                    src_shape.begin())) {
+        utility::LogError(
+                "Mask of shape {} does not match the leading dimensions of "
+                "tensor of shape {}.",
+                mask_shape.ToString(), src_shape.ToString());
     }
 
-    return result;
+    // Each mask element selects a contiguous slice of src.
+    const Tensor src_contiguous = src.Contiguous();
+    const Tensor mask_contiguous = mask.Contiguous();
+    const SizeVector slice_shape(src_shape.begin() + mask_shape.size(),
+                                 src_shape.end());
+    const int64_t slice_byte_size =
+            slice_shape.NumElements() * src.GetDtype().ByteSize();
+    const char* src_ptr = static_cast<const char*>(src_contiguous.GetDataPtr());
+    const bool* mask_ptr =
+            static_cast<const bool*>(mask_contiguous.GetDataPtr());
+
+    Tensor dst;
+    char* dst_ptr = nullptr;
+    ParallelCompact(
+            mask.NumElements(), [&](int64_t idx) { return mask_ptr[idx]; },
+            [&](int64_t num_selected) {
+                SizeVector dst_shape{num_selected};
+                dst_shape.insert(dst_shape.end(), slice_shape.begin(),
+                                 slice_shape.end());
+                dst = Tensor(dst_shape, src.GetDtype(), src.GetDevice());
+                dst_ptr = static_cast<char*>(dst.GetDataPtr());
+            },
+            [&](int64_t idx, int64_t output_idx) {
+                std::memcpy(dst_ptr + output_idx * slice_byte_size,
+                            src_ptr + idx * slice_byte_size, slice_byte_size);
+            });
+    return dst;
 }
 
 }  // namespace kernel
@@ -26,6 +26,13 @@
 
 #pragma once
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+
 namespace open3d {
 namespace core {
 namespace kernel {
@@ -46,6 +53,47 @@ inline bool InParallel() {
 #endif
 }
 
+/// Returns the number of threads to use for \p num_workloads workloads such
+/// that each thread gets at least \p grain_size workloads. Returns 1 inside a
+/// parallel region, since nested parallelism is not used.
+inline int64_t GetNumThreadsForWorkloads(int64_t num_workloads,
+                                         int64_t grain_size) {
+    if (InParallel()) {
+        return 1;
+    }
+    grain_size = std::max<int64_t>(grain_size, 1);
+    return std::max<int64_t>(
+            std::min<int64_t>(GetMaxThreads(),
+                              (num_workloads + grain_size - 1) / grain_size),
+            1);
+}
+
+/// Limits the number of threads of parallel regions started by the calling
+/// thread while the object is alive. Other threads are not affected, so the
+/// guard can be used in the tasks of an external thread pool to avoid
+/// oversubscription.
+class ScopedNumThreads {
+public:
+    explicit ScopedNumThreads(int num_threads)
+        : prev_num_threads_(GetMaxThreads()) {
+#ifdef _OPENMP
+        omp_set_num_threads(std::max(num_threads, 1));
+#endif
+    }
+
+    ~ScopedNumThreads() {
+#ifdef _OPENMP
+        omp_set_num_threads(prev_num_threads_);
+#endif
+    }
+
+    ScopedNumThreads(const ScopedNumThreads&) = delete;
+    ScopedNumThreads& operator=(const ScopedNumThreads&) = delete;
+
+private:
+    int prev_num_threads_;
+};
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
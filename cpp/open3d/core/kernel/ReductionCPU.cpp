@@ -29,6 +29,7 @@
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Indexer.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CPULauncher.h"
 #include "open3d/core/kernel/ParallelUtil.h"
 #include "open3d/core/kernel/Reduction.h"
 #include "open3d/utility/Console.h"
@@ -95,17 +96,31 @@ public:
     void Run(const func_t& reduce_func, scalar_t identity) {
         // See: PyTorch's TensorIterator::parallel_reduce for the reference
         // design of reduction strategy.
-        if (GetMaxThreads() == 1 || InParallel()) {
+        const int64_t num_threads = GetNumThreadsForWorkloads(
+                indexer_.NumWorkloads(), CPULauncher::kDefaultGrainSize);
+        const int64_t num_outputs = indexer_.NumOutputElements();
+        if (num_threads <= 1) {
             LaunchReductionKernelSerial<scalar_t>(indexer_, reduce_func);
-        } else if (indexer_.NumOutputElements() <= 1) {
+        } else if (num_outputs <= 1) {
             LaunchReductionKernelTwoPass<scalar_t>(indexer_, reduce_func,
-                                                   identity);
+                                                   identity, num_threads);
+        } else if (FindParallelDimSize(indexer_, num_threads) < num_threads &&
+                   num_outputs * static_cast<int64_t>(sizeof(scalar_t)) <=
+                           kMaxMultiOutputBufferBytes &&
+                   HasDenseOutput<scalar_t>(indexer_)) {
+            LaunchReductionKernelMultiOutputTwoPass<scalar_t>(
+                    indexer_, reduce_func, identity, num_threads);
         } else {
-            LaunchReductionParallelDim<scalar_t>(indexer_, reduce_func);
+            LaunchReductionParallelDim<scalar_t>(indexer_, reduce_func,
+                                                 num_threads);
         }
     }
 
 private:
+    /// Upper bound of the per-thread output buffer of the multi-output
+    /// two-pass reduction, chosen to stay within a typical L2 cache.
+    static constexpr int64_t kMaxMultiOutputBufferBytes = 1 << 18;
+
     template <typename scalar_t, typename func_t>
     static void LaunchReductionKernelSerial(const Indexer& indexer,
                                             func_t element_kernel) {
@@ -124,19 +139,19 @@ private:
     template <typename scalar_t, typename func_t>
     static void LaunchReductionKernelTwoPass(const Indexer& indexer,
                                              func_t element_kernel,
-                                             scalar_t identity) {
+                                             scalar_t identity,
+                                             int64_t num_threads) {
         if (indexer.NumOutputElements() > 1) {
             utility::LogError(
                     "Internal error: two-pass reduction only works for "
                     "single-output reduction ops.");
         }
         int64_t num_workloads = indexer.NumWorkloads();
-        int64_t num_threads = GetMaxThreads();
         int64_t workload_per_thread =
                 (num_workloads + num_threads - 1) / num_threads;
         std::vector<scalar_t> thread_results(num_threads, identity);
 
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(num_threads)
         for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
             int64_t start = thread_idx * workload_per_thread;
             int64_t end = std::min(start + workload_per_thread, num_workloads);
@@ -154,13 +169,87 @@ private:
         }
     }
 
+    /// Two-pass reduction for ops with multiple outputs. The workloads are
+    /// split into one contiguous tile per thread, each thread reduces its tile
+    /// into a private buffer holding all outputs, and the buffers are merged
+    /// into the outputs at the end. This keeps all threads busy when there
+    /// are fewer outputs than threads, e.g. reducing a {N, 3} tensor along
+    /// dim 0, where LaunchReductionParallelDim could use 3 threads at most.
+    /// The outputs must be densely packed, see HasDenseOutput().
+    template <typename scalar_t, typename func_t>
+    static void LaunchReductionKernelMultiOutputTwoPass(const Indexer& indexer,
+                                                        func_t element_kernel,
+                                                        scalar_t identity,
+                                                        int64_t num_threads) {
+        const int64_t num_workloads = indexer.NumWorkloads();
+        const int64_t num_outputs = indexer.NumOutputElements();
+        const int64_t workload_per_thread =
+                (num_workloads + num_threads - 1) / num_threads;
+        // Pad each thread's buffer to a multiple of 64 bytes to avoid false
+        // sharing between neighbouring threads.
+        const int64_t elements_per_line = 64 / sizeof(scalar_t);
+        const int64_t buffer_stride =
+                (num_outputs + elements_per_line - 1) / elements_per_line *
+                elements_per_line;
+        std::vector<scalar_t> thread_results(num_threads * buffer_stride,
+                                             identity);
+        scalar_t* dst = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
+
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+            scalar_t* thread_dst =
+                    thread_results.data() + thread_idx * buffer_stride;
+            int64_t start = thread_idx * workload_per_thread;
+            int64_t end = std::min(start + workload_per_thread, num_workloads);
+            for (int64_t workload_idx = start; workload_idx < end;
+                 ++workload_idx) {
+                scalar_t* src = reinterpret_cast<scalar_t*>(
+                        indexer.GetInputPtr(0, workload_idx));
+                int64_t output_idx = reinterpret_cast<scalar_t*>(
+                                             indexer.GetOutputPtr(
+                                                     workload_idx)) -
+                                     dst;
+                thread_dst[output_idx] =
+                        element_kernel(*src, thread_dst[output_idx]);
+            }
+        }
+        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+            const scalar_t* thread_dst =
+                    thread_results.data() + thread_idx * buffer_stride;
+            for (int64_t output_idx = 0; output_idx < num_outputs;
+                 ++output_idx) {
+                dst[output_idx] =
+                        element_kernel(thread_dst[output_idx], dst[output_idx]);
+            }
+        }
+    }
+
     template <typename scalar_t, typename func_t>
     static void LaunchReductionParallelDim(const Indexer& indexer,
-                                           func_t element_kernel) {
+                                           func_t element_kernel,
+                                           int64_t num_threads) {
+        int64_t best_dim = FindParallelDim(indexer, num_threads);
+        if (best_dim == -1) {
+            utility::LogError(
+                    "Internal error: all dims are reduction dims, use "
+                    "LaunchReductionKernelTwoPass instead.");
+        }
+
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+        for (int64_t i = 0; i < indexer.GetMasterShape()[best_dim]; ++i) {
+            Indexer sub_indexer(indexer);
+            sub_indexer.ShrinkDim(best_dim, i, 1);
+            LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
+        }
+    }
+
+    /// Returns the non-reduction dim to parallelize over in
+    /// LaunchReductionParallelDim, or -1 if all dims are reduction dims.
+    static int64_t FindParallelDim(const Indexer& indexer,
+                                   int64_t num_threads) {
         // Prefers outer dimension >= num_threads.
         const int64_t* indexer_shape = indexer.GetMasterShape();
         const int64_t num_dims = indexer.NumDims();
-        int64_t num_threads = GetMaxThreads();
 
         // Init best_dim as the outer-most non-reduction dim.
         int64_t best_dim = num_dims - 1;
@@ -176,21 +265,31 @@ private:
                 best_dim = dim;
             }
         }
-        if (best_dim == -1) {
-            utility::LogError(
-                    "Internal error: all dims are reduction dims, use "
-                    "LaunchReductionKernelTwoPass instead.");
-        }
+        return best_dim;
+    }
 
-#pragma omp parallel for schedule(static)
-        for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
-            Indexer sub_indexer(indexer);
-            sub_indexer.ShrinkDim(best_dim, i, 1);
-            LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
+    static int64_t FindParallelDimSize(const Indexer& indexer,
+                                       int64_t num_threads) {
+        int64_t best_dim = FindParallelDim(indexer, num_threads);
+        return best_dim == -1 ? 1 : indexer.GetMasterShape()[best_dim];
+    }
+
+    /// Returns true if the outputs occupy a contiguous range of memory, so that
+    /// an output's offset from the first output is its index. Tensor strides
+    /// are non-negative, so the last workload maps to the furthest output.
+    template <typename scalar_t>
+    static bool HasDenseOutput(const Indexer& indexer) {
+        const int64_t num_workloads = indexer.NumWorkloads();
+        if (num_workloads == 0) {
+            return false;
         }
+        const scalar_t* first = reinterpret_cast<const scalar_t*>(
+                indexer.GetOutputPtr(0));
+        const scalar_t* last = reinterpret_cast<const scalar_t*>(
+                indexer.GetOutputPtr(num_workloads - 1));
+        return last - first + 1 == indexer.NumOutputElements();
     }
 
-private:
     Indexer indexer_;
 };
 
@@ -207,8 +306,14 @@ public:
         // elements. We need to keep track of the indices within each
         // sub-iteration.
         int64_t num_output_elements = indexer_.NumOutputElements();
+        int64_t num_threads = GetNumThreadsForWorkloads(
+                indexer_.NumWorkloads(), CPULauncher::kDefaultGrainSize);
+        if (num_threads > 1 && num_output_elements < num_threads) {
+            RunTwoPass(reduce_func, identity, num_threads);
+            return;
+        }
 
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(num_threads)
         for (int64_t output_idx = 0; output_idx < num_output_elements;
              output_idx++) {
             // sub_indexer.NumWorkloads() == ipo.
@@ -229,6 +334,60 @@ public:
     }
 
 private:
+    /// Splits the sub-iteration of each output element into chunks, such that
+    /// there are at least num_threads (output, chunk) pairs in total. Each
+    /// chunk is reduced to a partial (index, value) pair independently, and
+    /// the partial results are merged in chunk order, so that ties resolve to
+    /// the first occurrence as in the single-pass reduction.
+    template <typename func_t, typename scalar_t>
+    void RunTwoPass(const func_t& reduce_func,
+                    scalar_t identity,
+                    int64_t num_threads) {
+        const int64_t num_output_elements = indexer_.NumOutputElements();
+        const int64_t num_chunks =
+                (num_threads + num_output_elements - 1) / num_output_elements;
+        const int64_t ipo = indexer_.NumWorkloads() / num_output_elements;
+        const int64_t chunk_size = (ipo + num_chunks - 1) / num_chunks;
+        const int64_t num_tasks = num_output_elements * num_chunks;
+        std::vector<int64_t> chunk_indices(num_tasks, 0);
+        std::vector<scalar_t> chunk_values(num_tasks, identity);
+
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+        for (int64_t task_idx = 0; task_idx < num_tasks; ++task_idx) {
+            const int64_t output_idx = task_idx / num_chunks;
+            const int64_t start = (task_idx % num_chunks) * chunk_size;
+            const int64_t end = std::min(start + chunk_size, ipo);
+            Indexer sub_indexer = indexer_.GetPerOutputIndexer(output_idx);
+            int64_t dst_idx = start;
+            scalar_t dst_val = identity;
+            for (int64_t workload_idx = start; workload_idx < end;
+                 workload_idx++) {
+                scalar_t* src_val = reinterpret_cast<scalar_t*>(
+                        sub_indexer.GetInputPtr(0, workload_idx));
+                std::tie(dst_idx, dst_val) =
+                        reduce_func(workload_idx, *src_val, dst_idx, dst_val);
+            }
+            chunk_indices[task_idx] = dst_idx;
+            chunk_values[task_idx] = dst_val;
+        }
+
+        for (int64_t output_idx = 0; output_idx < num_output_elements;
+             output_idx++) {
+            const int64_t first = output_idx * num_chunks;
+            int64_t dst_idx = chunk_indices[first];
+            scalar_t dst_val = chunk_values[first];
+            for (int64_t task_idx = first + 1; task_idx < first + num_chunks;
+                 ++task_idx) {
+                std::tie(dst_idx, dst_val) =
+                        reduce_func(chunk_indices[task_idx],
+                                    chunk_values[task_idx], dst_idx, dst_val);
+            }
+            Indexer sub_indexer = indexer_.GetPerOutputIndexer(output_idx);
+            *reinterpret_cast<int64_t*>(sub_indexer.GetOutputPtr(0, 0)) =
+                    dst_idx;
+        }
+    }
+
     Indexer indexer_;
 };
 
@@ -237,6 +396,15 @@ void ReductionCPU(const Tensor& src,
                   const SizeVector& dims,
                   bool keepdim,
                   ReductionOpCode op_code) {
+    if (src.GetDtype() == Dtype::Float16 &&
+        (op_code == ReductionOpCode::Sum || op_code == ReductionOpCode::Prod)) {
+        // Accumulate in Float32, rounding to Float16 only once per output.
+        Tensor dst_float32(dst.GetShape(), Dtype::Float32, dst.GetDevice());
+        ReductionCPU(src.To(Dtype::Float32), dst_float32, dims, keepdim,
+                     op_code);
+        dst.AsRvalue() = dst_float32.To(Dtype::Float16);
+        return;
+    }
     if (s_regular_reduce_ops.find(op_code) != s_regular_reduce_ops.end()) {
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME, dims);
         CPUReductionEngine re(indexer);
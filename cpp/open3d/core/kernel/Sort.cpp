@@ -0,0 +1,85 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/Sort.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+// There are no CUDA kernels yet: CUDA tensors are sorted on the CPU.
+
+void Sort(const Tensor& src, Tensor& dst) {
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SortCPU(src, dst);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        Tensor dst_cpu(dst.GetShape(), dst.GetDtype(), Device("CPU:0"));
+        SortCPU(src.To(Device("CPU:0")), dst_cpu);
+        dst.CopyFrom(dst_cpu);
+    } else {
+        utility::LogError("Sort: Unimplemented device");
+    }
+}
+
+void ArgSort(const Tensor& src, Tensor& dst) {
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        ArgSortCPU(src, dst);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        Tensor dst_cpu(dst.GetShape(), dst.GetDtype(), Device("CPU:0"));
+        ArgSortCPU(src.To(Device("CPU:0")), dst_cpu);
+        dst.CopyFrom(dst_cpu);
+    } else {
+        utility::LogError("ArgSort: Unimplemented device");
+    }
+}
+
+void Unique(const Tensor& src,
+            Tensor& values,
+            Tensor& inverse,
+            Tensor& counts) {
+    Device device = src.GetDevice();
+    Device::DeviceType device_type = device.GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        UniqueCPU(src, values, inverse, counts);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        UniqueCPU(src.To(Device("CPU:0")), values, inverse, counts);
+        values = values.To(device);
+        inverse = inverse.To(device);
+        counts = counts.To(device);
+    } else {
+        utility::LogError("Unique: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
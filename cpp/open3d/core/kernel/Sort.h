@@ -0,0 +1,61 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Sorts each row of the last dimension of the contiguous tensor \p src in
+/// ascending order into \p dst, which has the shape and dtype of \p src.
+void Sort(const Tensor& src, Tensor& dst);
+
+void SortCPU(const Tensor& src, Tensor& dst);
+
+/// Writes the stable sorting indices of each row of the last dimension of the
+/// contiguous tensor \p src to the Int64 tensor \p dst of the same shape.
+void ArgSort(const Tensor& src, Tensor& dst);
+
+void ArgSortCPU(const Tensor& src, Tensor& dst);
+
+/// Finds the unique elements of the contiguous 1D tensor \p src, or the unique
+/// rows of the contiguous 2D tensor \p src. Returns the sorted unique elements
+/// (rows in lexicographic order) in \p values, the index in \p values of each
+/// element (row) of \p src in \p inverse, and the number of occurrences of
+/// each element (row) of \p values in \p counts.
+void Unique(const Tensor& src, Tensor& values, Tensor& inverse, Tensor& counts);
+
+void UniqueCPU(const Tensor& src,
+               Tensor& values,
+               Tensor& inverse,
+               Tensor& counts);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,256 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Minimum number of elements sorted by one thread.
+static constexpr int64_t kSortGrainSize = 32768;
+
+template <typename scalar_t>
+static typename std::enable_if<std::is_floating_point<scalar_t>::value,
+                               bool>::type
+IsNaN(scalar_t value) {
+    return std::isnan(value);
+}
+
+template <typename scalar_t>
+static typename std::enable_if<!std::is_floating_point<scalar_t>::value,
+                               bool>::type
+IsNaN(scalar_t) {
+    return false;
+}
+
+static bool IsNaN(Float16 value) {
+    return std::isnan(static_cast<float>(value));
+}
+
+/// Strict weak ordering that sorts NaNs after all other values.
+template <typename scalar_t>
+static bool LessNaNLast(scalar_t lhs, scalar_t rhs) {
+    return lhs < rhs || (IsNaN(rhs) && !IsNaN(lhs));
+}
+
+/// Stable sort of [data, data + n). Each thread sorts a chunk of the range,
+/// and the sorted chunks are merged pairwise in parallel, doubling the merged
+/// width in each round.
+template <typename T, typename compare_t>
+static void ParallelStableSort(T* data, int64_t n, compare_t comp) {
+    const int64_t num_chunks = GetNumThreadsForWorkloads(n, kSortGrainSize);
+    if (num_chunks <= 1) {
+        std::stable_sort(data, data + n, comp);
+        return;
+    }
+    const int64_t chunk_size = (n + num_chunks - 1) / num_chunks;
+    auto chunk_begin = [&](int64_t chunk_idx) {
+        return std::min(chunk_idx * chunk_size, n);
+    };
+    CPULauncher::ParallelFor(num_chunks, 1, [&](int64_t chunk_idx) {
+        std::stable_sort(data + chunk_begin(chunk_idx),
+                         data + chunk_begin(chunk_idx + 1), comp);
+    });
+
+    // Not a std::vector, which is bit-packed for bool.
+    std::unique_ptr<T[]> buffer(new T[n]);
+    T* src = data;
+    T* dst = buffer.get();
+    for (int64_t width = 1; width < num_chunks; width *= 2) {
+        const int64_t num_merges = (num_chunks + 2 * width - 1) / (2 * width);
+        CPULauncher::ParallelFor(num_merges, 1, [&](int64_t merge_idx) {
+            const int64_t begin = chunk_begin(2 * width * merge_idx);
+            const int64_t mid = chunk_begin(2 * width * merge_idx + width);
+            const int64_t end = chunk_begin(2 * width * (merge_idx + 1));
+            std::merge(src + begin, src + mid, src + mid, src + end,
+                       dst + begin, comp);
+        });
+        std::swap(src, dst);
+    }
+    if (src != data) {
+        CPULauncher::ParallelFor(num_chunks, 1, [&](int64_t chunk_idx) {
+            std::copy(src + chunk_begin(chunk_idx),
+                      src + chunk_begin(chunk_idx + 1),
+                      data + chunk_begin(chunk_idx));
+        });
+    }
+}
+
+/// Runs func(row_begin, row_size) for each row of the last dimension of \p src,
+/// where row_begin is the index of the first element of the row. The rows are
+/// split over the threads with at least kSortGrainSize elements per thread.
+/// Parallel loops nested in func run serially if there are several threads, so
+/// a single row is sorted by all threads, but several long rows are sorted one
+/// row per thread.
+template <typename func_t>
+static void ForEachRow(const Tensor& src, func_t func) {
+    const int64_t row_size = src.NumDims() == 0 ? 1 : src.GetShape().back();
+    if (row_size == 0) {
+        return;
+    }
+    const int64_t num_rows = src.NumElements() / row_size;
+    CPULauncher::ParallelFor(
+            num_rows, std::max<int64_t>(kSortGrainSize / row_size, 1),
+            [&](int64_t row_idx) {
+                func(row_idx * row_size, row_size);
+            });
+}
+
+void SortCPU(const Tensor& src, Tensor& dst) {
+    dst.CopyFrom(src);
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+        ForEachRow(src, [&](int64_t row_begin, int64_t row_size) {
+            ParallelStableSort(dst_ptr + row_begin, row_size,
+                               LessNaNLast<scalar_t>);
+        });
+    });
+}
+
+void ArgSortCPU(const Tensor& src, Tensor& dst) {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src.GetDataPtr());
+        int64_t* dst_ptr = static_cast<int64_t*>(dst.GetDataPtr());
+        ForEachRow(src, [&](int64_t row_begin, int64_t row_size) {
+            const scalar_t* row_ptr = src_ptr + row_begin;
+            int64_t* indices = dst_ptr + row_begin;
+            std::iota(indices, indices + row_size, 0);
+            ParallelStableSort(indices, row_size,
+                               [&](int64_t lhs, int64_t rhs) {
+                                   return LessNaNLast(row_ptr[lhs],
+                                                      row_ptr[rhs]);
+                               });
+        });
+    });
+}
+
+void UniqueCPU(const Tensor& src,
+               Tensor& values,
+               Tensor& inverse,
+               Tensor& counts) {
+    if (src.NumDims() != 1 && src.NumDims() != 2) {
+        utility::LogError("Unique: expected a 1D or 2D tensor, but got {}D.",
+                          src.NumDims());
+    }
+    // Each row of a 2D tensor is one key.
+    const int64_t n = src.GetShape(0);
+    const int64_t row_size = src.NumDims() == 2 ? src.GetShape(1) : 1;
+    Tensor order({n}, Dtype::Int64, src.GetDevice());
+    int64_t* order_ptr = static_cast<int64_t*>(order.GetDataPtr());
+    if (row_size == 1) {
+        ArgSortCPU(src.Reshape({n}), order);
+    }
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src.GetDataPtr());
+        if (row_size != 1) {
+            // Lexicographic order of the rows, NaNs last in each column.
+            std::iota(order_ptr, order_ptr + n, 0);
+            ParallelStableSort(order_ptr, n, [&](int64_t lhs, int64_t rhs) {
+                const scalar_t* lhs_row = src_ptr + lhs * row_size;
+                const scalar_t* rhs_row = src_ptr + rhs * row_size;
+                return std::lexicographical_compare(
+                        lhs_row, lhs_row + row_size, rhs_row,
+                        rhs_row + row_size, LessNaNLast<scalar_t>);
+            });
+        }
+        auto rows_equal = [&](int64_t lhs, int64_t rhs) {
+            const scalar_t* lhs_row = src_ptr + lhs * row_size;
+            const scalar_t* rhs_row = src_ptr + rhs * row_size;
+            for (int64_t k = 0; k < row_size; ++k) {
+                if (!(lhs_row[k] == rhs_row[k] ||
+                      (IsNaN(lhs_row[k]) && IsNaN(rhs_row[k])))) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        // A group of equal rows begins at each sorted row that differs from
+        // its predecessor. group_ends[i] is the number of groups that begin at
+        // or before the i-th sorted row.
+        std::vector<int64_t> is_group_begin(n);
+        CPULauncher::ParallelFor(
+                n, CPULauncher::kDefaultGrainSize, [&](int64_t idx) {
+                    is_group_begin[idx] =
+                            idx == 0 || !rows_equal(order_ptr[idx - 1],
+                                                    order_ptr[idx]);
+                });
+        std::vector<int64_t> group_ends(n);
+        if (n > 0) {
+            utility::InclusivePrefixSum(is_group_begin.data(),
+                                        is_group_begin.data() + n,
+                                        group_ends.data());
+        }
+        const int64_t num_unique = n > 0 ? group_ends.back() : 0;
+
+        SizeVector values_shape = src.GetShape();
+        values_shape[0] = num_unique;
+        values = Tensor(values_shape, src.GetDtype(), src.GetDevice());
+        inverse = Tensor({n}, Dtype::Int64, src.GetDevice());
+        counts = Tensor({num_unique}, Dtype::Int64, src.GetDevice());
+        scalar_t* values_ptr = static_cast<scalar_t*>(values.GetDataPtr());
+        int64_t* inverse_ptr = static_cast<int64_t*>(inverse.GetDataPtr());
+        int64_t* counts_ptr = static_cast<int64_t*>(counts.GetDataPtr());
+        std::vector<int64_t> group_begins(num_unique + 1, n);
+        CPULauncher::ParallelFor(
+                n, CPULauncher::kDefaultGrainSize, [&](int64_t idx) {
+                    const int64_t group_idx = group_ends[idx] - 1;
+                    inverse_ptr[order_ptr[idx]] = group_idx;
+                    if (is_group_begin[idx]) {
+                        std::copy(src_ptr + order_ptr[idx] * row_size,
+                                  src_ptr + (order_ptr[idx] + 1) * row_size,
+                                  values_ptr + group_idx * row_size);
+                        group_begins[group_idx] = idx;
+                    }
+                });
+        CPULauncher::ParallelFor(num_unique, CPULauncher::kDefaultGrainSize,
+                                 [&](int64_t group_idx) {
+                                     counts_ptr[group_idx] =
+                                             group_begins[group_idx + 1] -
+                                             group_begins[group_idx];
+                                 });
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
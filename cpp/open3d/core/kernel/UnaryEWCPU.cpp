@@ -144,8 +144,9 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
                 using src_t = scalar_t;
                 DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
                     using dst_t = scalar_t;
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUCopyElementKernel<src_t, dst_t>);
+                    CPULauncher::LaunchUnaryEWKernel<
+                            src_t, dst_t,
+                            CPUCopyElementKernel<src_t, dst_t>>(indexer);
                 });
             });
         }
@@ -158,9 +159,11 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
     Dtype dst_dtype = dst.GetDtype();
 
     auto assert_dtype_is_float = [](Dtype dtype) -> void {
-        if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        if (dtype != Dtype::Float16 && dtype != Dtype::Float32 &&
+            dtype != Dtype::Float64) {
             utility::LogError(
-                    "Only supports Float32 and Float64, but {} is used.",
+                    "Only supports Float16, Float32 and Float64, but {} is "
+                    "used.",
                     dtype.ToString());
         }
     };
@@ -169,14 +172,16 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
         DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
             if (dst_dtype == src_dtype) {
                 Indexer indexer({src}, dst, DtypePolicy::ALL_SAME);
-                CPULauncher::LaunchUnaryEWKernel(
-                        indexer,
-                        CPULogicalNotElementKernel<scalar_t, scalar_t>);
+                CPULauncher::LaunchUnaryEWKernel<
+                        scalar_t, scalar_t,
+                        CPULogicalNotElementKernel<scalar_t, scalar_t>>(
+                        indexer);
             } else if (dst_dtype == Dtype::Bool) {
                 Indexer indexer({src}, dst,
                                 DtypePolicy::INPUT_SAME_OUTPUT_BOOL);
-                CPULauncher::LaunchUnaryEWKernel(
-                        indexer, CPULogicalNotElementKernel<scalar_t, bool>);
+                CPULauncher::LaunchUnaryEWKernel<
+                        scalar_t, bool,
+                        CPULogicalNotElementKernel<scalar_t, bool>>(indexer);
             } else {
                 utility::LogError(
                         "Boolean op's output type must be boolean or the "
@@ -189,47 +194,57 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
             switch (op_code) {
                 case UnaryEWOpCode::Sqrt:
                     assert_dtype_is_float(src_dtype);
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUSqrtElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<
+                            scalar_t, scalar_t,
+                            CPUSqrtElementKernel<scalar_t>>(indexer);
                     break;
                 case UnaryEWOpCode::Sin:
                     assert_dtype_is_float(src_dtype);
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUSinElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<
+                            scalar_t, scalar_t,
+                            CPUSinElementKernel<scalar_t>>(indexer);
                     break;
                 case UnaryEWOpCode::Cos:
                     assert_dtype_is_float(src_dtype);
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUCosElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<
+                            scalar_t, scalar_t,
+                            CPUCosElementKernel<scalar_t>>(indexer);
                     break;
                 case UnaryEWOpCode::Neg:
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUNegElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<
+                            scalar_t, scalar_t,
+                            CPUNegElementKernel<scalar_t>>(indexer);
                     break;
                 case UnaryEWOpCode::Exp:
                     assert_dtype_is_float(src_dtype);
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUExpElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<
+                            scalar_t, scalar_t,
+                            CPUExpElementKernel<scalar_t>>(indexer);
                     break;
                 case UnaryEWOpCode::Abs:
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUAbsElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<
+                            scalar_t, scalar_t,
+                            CPUAbsElementKernel<scalar_t>>(indexer);
                     break;
                 case UnaryEWOpCode::Floor:
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUFloorElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<
+                            scalar_t, scalar_t,
+                            CPUFloorElementKernel<scalar_t>>(indexer);
                     break;
                 case UnaryEWOpCode::Ceil:
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUCeilElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<
+                            scalar_t, scalar_t,
+                            CPUCeilElementKernel<scalar_t>>(indexer);
                     break;
                 case UnaryEWOpCode::Round:
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPURoundElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<
+                            scalar_t, scalar_t,
+                            CPURoundElementKernel<scalar_t>>(indexer);
                     break;
                 case UnaryEWOpCode::Trunc:
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUTruncElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<
+                            scalar_t, scalar_t,
+                            CPUTruncElementKernel<scalar_t>>(indexer);
                     break;
                 default:
                     utility::LogError("Unimplemented op_code for UnaryEWCPU");
@@ -205,9 +205,11 @@ void UnaryEWCUDA(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
     Dtype dst_dtype = dst.GetDtype();
 
     auto assert_dtype_is_float = [](Dtype dtype) -> void {
-        if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        if (dtype != Dtype::Float16 && dtype != Dtype::Float32 &&
+            dtype != Dtype::Float64) {
             utility::LogError(
-                    "Only supports Float32 and Float64, but {} is used.",
+                    "Only supports Float16, Float32 and Float64, but {} is "
+                    "used.",
                     dtype.ToString());
         }
     };
@@ -26,11 +26,8 @@
 
 #include "open3d/core/nns/FixedRadiusIndex.h"
 
-#ifdef BUILD_CUDA_MODULE
-#include "open3d/core/nns/FixedRadiusSearch.h"
-#endif
-
 #include "open3d/core/CoreUtil.h"
+#include "open3d/core/nns/FixedRadiusSearch.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -48,17 +45,21 @@ FixedRadiusIndex::~FixedRadiusIndex(){};
 
 bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
                                      double radius) {
-#ifdef BUILD_CUDA_MODULE
-    if (dataset_points.GetDevice().GetType() != Device::DeviceType::CUDA) {
-        utility::LogError(
-                "[FixedRadiusIndex::SetTensorData] dataset_points should be "
-                "GPU Tensor.");
-    }
     if (radius <= 0) {
         utility::LogError(
                 "[FixedRadiusIndex::SetTensorData] radius should be positive.");
     }
+    const Device::DeviceType device_type =
+            dataset_points.GetDevice().GetType();
+#ifndef BUILD_CUDA_MODULE
+    if (device_type == Device::DeviceType::CUDA) {
+        utility::LogError(
+                "FixedRadiusIndex::SetTensorData BUILD_CUDA_MODULE is OFF. "
+                "Please compile Open3d with BUILD_CUDA_MODULE=ON.");
+    }
+#endif
     dataset_points_ = dataset_points.Contiguous();
+    radius_ = radius;
     int64_t num_points = GetDatasetSize();
     int64_t hash_table_size = std::min<int64_t>(
             std::max<int64_t>(hash_table_size_factor * num_points, 1),
@@ -78,10 +79,24 @@ bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
         out_hash_table_splits_[i] = hash_table_splits_[i];
     }
 
+    Dtype dtype = GetDtype();
+    if (device_type == Device::DeviceType::CPU) {
+        DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
+            BuildSpatialHashTableCPU(
+                    num_points, dataset_points_.GetDataPtr<scalar_t>(),
+                    static_cast<scalar_t>(radius), points_row_splits_.size(),
+                    points_row_splits_.data(), hash_table_splits_.data(),
+                    hash_table_cell_splits_.GetShape()[0],
+                    (uint32_t *)hash_table_cell_splits_.GetDataPtr<int32_t>(),
+                    (uint32_t *)hash_table_index_.GetDataPtr<int32_t>());
+        });
+        return true;
+    }
+
+#ifdef BUILD_CUDA_MODULE
     void *temp_ptr = nullptr;
     size_t temp_size = 0;
 
-    Dtype dtype = GetDtype();
     DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
         BuildSpatialHashTableCUDA(
                 temp_ptr, temp_size, dataset_points_.GetShape()[1],
@@ -106,17 +121,12 @@ bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
                 (uint32_t *)static_cast<int32_t *>(
                         hash_table_index_.GetDataPtr()));
     });
-    return true;
-#else
-    utility::LogError(
-            "FixedRadiusIndex::SetTensorData BUILD_CUDA_MODULE is OFF. Please "
-            "compile Open3d with BUILD_CUDA_MODULE=ON.");
 #endif
+    return true;
 };
 
 std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
         const Tensor &query_points, double radius) const {
-#ifdef BUILD_CUDA_MODULE
     // Check dtype.
     query_points.AssertDtype(GetDtype());
 
@@ -130,63 +140,92 @@ std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
         utility::LogError(
                 "[FixedRadiusIndex::SearchRadius] radius should be positive.");
     }
+    if (radius != radius_) {
+        utility::LogError(
+                "[FixedRadiusIndex::SearchRadius] radius {} does not match "
+                "the radius {} of the index.",
+                radius, radius_);
+    }
     Tensor query_points_ = query_points.Contiguous();
     int64_t num_query_points = query_points_.GetShape()[0];
     std::vector<int64_t> queries_row_splits({0, num_query_points});
 
-    void *temp_ptr = nullptr;
-    size_t temp_size = 0;
-
     Dtype dtype = GetDtype();
     Tensor neighbors_index;
     Tensor neighbors_distance;
     Tensor neighbors_row_splits = Tensor({num_query_points + 1}, Dtype::Int64,
                                          dataset_points_.GetDevice());
 
-    DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
-        NeighborSearchAllocator<scalar_t> output_allocator(
-                dataset_points_.GetDevice());
-        FixedRadiusSearchCUDA(
-                temp_ptr, temp_size, neighbors_row_splits.GetDataPtr<int64_t>(),
-                GetDatasetSize(), dataset_points_.GetDataPtr<scalar_t>(),
-                num_query_points, query_points_.GetDataPtr<scalar_t>(),
-                static_cast<scalar_t>(radius), points_row_splits_.size(),
-                points_row_splits_.data(), queries_row_splits.size(),
-                queries_row_splits.data(), hash_table_splits_.data(),
-                hash_table_cell_splits_.GetShape()[0],
-                (uint32_t *)hash_table_cell_splits_.GetDataPtr<int32_t>(),
-                (uint32_t *)hash_table_index_.GetDataPtr<int32_t>(),
-                output_allocator);
-
-        Tensor temp_tensor = Tensor::Empty({int64_t(temp_size)}, Dtype::UInt8,
-                                           dataset_points_.GetDevice());
-        temp_ptr = temp_tensor.GetDataPtr();
-
-        FixedRadiusSearchCUDA(
-                temp_ptr, temp_size, neighbors_row_splits.GetDataPtr<int64_t>(),
-                GetDatasetSize(), dataset_points_.GetDataPtr<scalar_t>(),
-                num_query_points, query_points_.GetDataPtr<scalar_t>(),
-                static_cast<scalar_t>(radius), points_row_splits_.size(),
-                points_row_splits_.data(), queries_row_splits.size(),
-                queries_row_splits.data(), hash_table_splits_.data(),
-                hash_table_cell_splits_.GetShape()[0],
-                (uint32_t *)hash_table_cell_splits_.GetDataPtr<int32_t>(),
-                (uint32_t *)hash_table_index_.GetDataPtr<int32_t>(),
-                output_allocator);
-
-        neighbors_index = output_allocator.NeighborsIndex().To(Dtype::Int64);
-        neighbors_distance = output_allocator.NeighborsDistance();
-    });
+    if (GetDevice().GetType() == Device::DeviceType::CPU) {
+        DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
+            NeighborSearchAllocator<scalar_t> output_allocator(
+                    dataset_points_.GetDevice());
+            FixedRadiusSearchCPU(
+                    neighbors_row_splits.GetDataPtr<int64_t>(),
+                    GetDatasetSize(), dataset_points_.GetDataPtr<scalar_t>(),
+                    num_query_points, query_points_.GetDataPtr<scalar_t>(),
+                    static_cast<scalar_t>(radius), points_row_splits_.size(),
+                    points_row_splits_.data(), queries_row_splits.size(),
+                    queries_row_splits.data(), hash_table_splits_.data(),
+                    hash_table_cell_splits_.GetShape()[0],
+                    (uint32_t *)hash_table_cell_splits_.GetDataPtr<int32_t>(),
+                    (uint32_t *)hash_table_index_.GetDataPtr<int32_t>(),
+                    output_allocator);
+
+            neighbors_index =
+                    output_allocator.NeighborsIndex().To(Dtype::Int64);
+            neighbors_distance = output_allocator.NeighborsDistance();
+        });
+    } else {
+#ifdef BUILD_CUDA_MODULE
+        void *temp_ptr = nullptr;
+        size_t temp_size = 0;
+
+        DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
+            NeighborSearchAllocator<scalar_t> output_allocator(
+                    dataset_points_.GetDevice());
+            FixedRadiusSearchCUDA(
+                    temp_ptr, temp_size,
+                    neighbors_row_splits.GetDataPtr<int64_t>(),
+                    GetDatasetSize(), dataset_points_.GetDataPtr<scalar_t>(),
+                    num_query_points, query_points_.GetDataPtr<scalar_t>(),
+                    static_cast<scalar_t>(radius), points_row_splits_.size(),
+                    points_row_splits_.data(), queries_row_splits.size(),
+                    queries_row_splits.data(), hash_table_splits_.data(),
+                    hash_table_cell_splits_.GetShape()[0],
+                    (uint32_t *)hash_table_cell_splits_.GetDataPtr<int32_t>(),
+                    (uint32_t *)hash_table_index_.GetDataPtr<int32_t>(),
+                    output_allocator);
+
+            Tensor temp_tensor =
+                    Tensor::Empty({int64_t(temp_size)}, Dtype::UInt8,
+                                  dataset_points_.GetDevice());
+            temp_ptr = temp_tensor.GetDataPtr();
+
+            FixedRadiusSearchCUDA(
+                    temp_ptr, temp_size,
+                    neighbors_row_splits.GetDataPtr<int64_t>(),
+                    GetDatasetSize(), dataset_points_.GetDataPtr<scalar_t>(),
+                    num_query_points, query_points_.GetDataPtr<scalar_t>(),
+                    static_cast<scalar_t>(radius), points_row_splits_.size(),
+                    points_row_splits_.data(), queries_row_splits.size(),
+                    queries_row_splits.data(), hash_table_splits_.data(),
+                    hash_table_cell_splits_.GetShape()[0],
+                    (uint32_t *)hash_table_cell_splits_.GetDataPtr<int32_t>(),
+                    (uint32_t *)hash_table_index_.GetDataPtr<int32_t>(),
+                    output_allocator);
+
+            neighbors_index =
+                    output_allocator.NeighborsIndex().To(Dtype::Int64);
+            neighbors_distance = output_allocator.NeighborsDistance();
+        });
+#endif
+    }
 
     Tensor num_neighbors =
             neighbors_row_splits.Slice(0, 1, num_query_points + 1)
                     .Sub(neighbors_row_splits.Slice(0, 0, num_query_points));
     return std::make_tuple(neighbors_index, neighbors_distance, num_neighbors);
-#else
-    utility::LogError(
-            "FixedRadiusIndex::SearchRadius BUILD_CUDA_MODULE is OFF. Please "
-            "compile Open3d with BUILD_CUDA_MODULE=ON.");
-#endif
 };
 
 }  // namespace nns
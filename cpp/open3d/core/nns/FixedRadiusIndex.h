@@ -77,7 +77,7 @@ public:
     ///
     /// \param query_points Query points. Must be 2D, with shape {n, d}, same
     /// dtype with dataset_points.
-    /// \param radius Radius.
+    /// \param radius Radius. Must be the radius the index has been built with.
     /// \return Tuple of Tensors, (indices, distances, num_neighbors):
     /// - indicecs: Tensor of shape {total_num_neighbors,}, dtype Int64.
     /// - distances: Tensor of shape {total_num_neighbors,}, same dtype with
@@ -92,10 +92,14 @@ public:
         utility::LogError("FixedRadiusIndex::SearchHybrid not implemented.");
     }
 
-    const double hash_table_size_factor = 1 / 32;
+    /// Returns the radius the index has been built with.
+    double GetRadius() const { return radius_; }
+
+    const double hash_table_size_factor = 1.0 / 32;
     const int64_t max_hash_tabls_size = 10000;
 
 protected:
+    double radius_ = 0;
     std::vector<int64_t> points_row_splits_;
     std::vector<uint32_t> hash_table_splits_;
     std::vector<uint32_t> out_hash_table_splits_;
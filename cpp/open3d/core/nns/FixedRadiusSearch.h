@@ -202,6 +202,43 @@ void FixedRadiusSearchCUDA(void* temp,
                            const uint32_t* const hash_table_index,
                            NeighborSearchAllocator<T>& output_allocator);
 
+/// Builds a spatial hash table for a fixed radius search of 3D points on the
+/// CPU. The arguments are the same as for BuildSpatialHashTableCUDA except
+/// that there is no temporary memory and all pointers point to host memory.
+template <class TReal, class TIndex>
+void BuildSpatialHashTableCPU(const size_t num_points,
+                              const TReal* const points,
+                              const TReal radius,
+                              const size_t points_row_splits_size,
+                              const int64_t* points_row_splits,
+                              const TIndex* hash_table_splits,
+                              const size_t hash_table_cell_splits_size,
+                              TIndex* hash_table_cell_splits,
+                              TIndex* hash_table_index);
+
+/// Fixed radius search on the CPU using the hash table built with
+/// BuildSpatialHashTableCPU. The arguments are the same as for
+/// FixedRadiusSearchCUDA except that there is no temporary memory and all
+/// pointers point to host memory. The search uses the L2 metric and always
+/// returns the squared distances. The neighbors of each query point are
+/// sorted by distance.
+template <class T>
+void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
+                          size_t num_points,
+                          const T* const points,
+                          size_t num_queries,
+                          const T* const queries,
+                          const T radius,
+                          const size_t points_row_splits_size,
+                          const int64_t* const points_row_splits,
+                          const size_t queries_row_splits_size,
+                          const int64_t* const queries_row_splits,
+                          const uint32_t* const hash_table_splits,
+                          size_t hash_table_cell_splits_size,
+                          const uint32_t* const hash_table_cell_splits,
+                          const uint32_t* const hash_table_index,
+                          NeighborSearchAllocator<T>& output_allocator);
+
 }  // namespace nns
 }  // namespace core
 }  // namespace open3d
@@ -0,0 +1,335 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "open3d/core/Atomic.h"
+#include "open3d/core/nns/FixedRadiusSearch.h"
+#include "open3d/core/nns/NeighborSearchCommon.h"
+#include "open3d/utility/MiniVec.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+namespace {
+
+template <class T>
+using Vec3 = utility::MiniVec<T, 3>;
+
+/// Number of hash cells that have to be visited for a query: the cell of the
+/// query and the cells of the 8 corners of the box with half extent radius.
+constexpr int kMaxBinsToVisit = 9;
+
+/// Collects the sorted, unique hash cells that may contain neighbors of \p pos
+/// and returns their number.
+template <class T>
+inline int ComputeBinsToVisit(const Vec3<T>& pos,
+                              const T radius,
+                              const T inv_voxel_size,
+                              const size_t hash_table_size,
+                              const size_t first_cell_idx,
+                              size_t* bins_to_visit) {
+    int num_bins = 0;
+    bins_to_visit[num_bins++] =
+            first_cell_idx +
+            SpatialHash(ComputeVoxelIndex(pos, inv_voxel_size)) %
+                    hash_table_size;
+    for (int dz = -1; dz <= 1; dz += 2) {
+        for (int dy = -1; dy <= 1; dy += 2) {
+            for (int dx = -1; dx <= 1; dx += 2) {
+                Vec3<T> p = pos + radius * Vec3<T>(T(dx), T(dy), T(dz));
+                bins_to_visit[num_bins++] =
+                        first_cell_idx +
+                        SpatialHash(ComputeVoxelIndex(p, inv_voxel_size)) %
+                                hash_table_size;
+            }
+        }
+    }
+    std::sort(bins_to_visit, bins_to_visit + num_bins);
+    return int(std::unique(bins_to_visit, bins_to_visit + num_bins) -
+               bins_to_visit);
+}
+
+template <class T>
+inline T SquaredDistance(const Vec3<T>& p, const T* const q) {
+    T dx = p[0] - q[0];
+    T dy = p[1] - q[1];
+    T dz = p[2] - q[2];
+    return dx * dx + dy * dy + dz * dz;
+}
+
+}  // namespace
+
+template <class TReal, class TIndex>
+void BuildSpatialHashTableCPU(const size_t num_points,
+                              const TReal* const points,
+                              const TReal radius,
+                              const size_t points_row_splits_size,
+                              const int64_t* points_row_splits,
+                              const TIndex* hash_table_splits,
+                              const size_t hash_table_cell_splits_size,
+                              TIndex* hash_table_cell_splits,
+                              TIndex* hash_table_index) {
+    const int batch_size = points_row_splits_size - 1;
+    const TReal voxel_size = 2 * radius;
+    const TReal inv_voxel_size = 1 / voxel_size;
+
+    memset(&hash_table_cell_splits[0], 0,
+           sizeof(TIndex) * hash_table_cell_splits_size);
+
+    // Compute number of points that map to each hash.
+    for (int b = 0; b < batch_size; ++b) {
+        const size_t hash_table_size =
+                hash_table_splits[b + 1] - hash_table_splits[b];
+        const size_t first_cell_idx = hash_table_splits[b];
+        tbb::parallel_for(
+                tbb::blocked_range<int64_t>(points_row_splits[b],
+                                            points_row_splits[b + 1]),
+                [&](const tbb::blocked_range<int64_t>& r) {
+                    for (int64_t i = r.begin(); i != r.end(); ++i) {
+                        Vec3<TReal> pos(points + 3 * i);
+                        size_t hash = SpatialHash(ComputeVoxelIndex(
+                                              pos, inv_voxel_size)) %
+                                      hash_table_size;
+                        // Note the +1 because we want the first element to
+                        // be 0.
+                        AtomicFetchAddRelaxed(
+                                &hash_table_cell_splits[first_cell_idx + hash +
+                                                        1],
+                                1);
+                    }
+                });
+    }
+    utility::InclusivePrefixSum(
+            &hash_table_cell_splits[0],
+            &hash_table_cell_splits[hash_table_cell_splits_size],
+            &hash_table_cell_splits[0]);
+
+    // Compute the indices for hash_table_index.
+    std::vector<TIndex> count_tmp(hash_table_cell_splits_size - 1, 0);
+    for (int b = 0; b < batch_size; ++b) {
+        const size_t hash_table_size =
+                hash_table_splits[b + 1] - hash_table_splits[b];
+        const size_t first_cell_idx = hash_table_splits[b];
+        tbb::parallel_for(
+                tbb::blocked_range<int64_t>(points_row_splits[b],
+                                            points_row_splits[b + 1]),
+                [&](const tbb::blocked_range<int64_t>& r) {
+                    for (int64_t i = r.begin(); i != r.end(); ++i) {
+                        Vec3<TReal> pos(points + 3 * i);
+                        size_t cell =
+                                first_cell_idx +
+                                SpatialHash(ComputeVoxelIndex(
+                                        pos, inv_voxel_size)) %
+                                        hash_table_size;
+                        hash_table_index[hash_table_cell_splits[cell] +
+                                         AtomicFetchAddRelaxed(
+                                                 &count_tmp[cell], 1)] = i;
+                    }
+                });
+    }
+}
+
+template <class T>
+void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
+                          size_t num_points,
+                          const T* const points,
+                          size_t num_queries,
+                          const T* const queries,
+                          const T radius,
+                          const size_t points_row_splits_size,
+                          const int64_t* const points_row_splits,
+                          const size_t queries_row_splits_size,
+                          const int64_t* const queries_row_splits,
+                          const uint32_t* const hash_table_splits,
+                          size_t hash_table_cell_splits_size,
+                          const uint32_t* const hash_table_cell_splits,
+                          const uint32_t* const hash_table_index,
+                          NeighborSearchAllocator<T>& output_allocator) {
+    const int batch_size = points_row_splits_size - 1;
+
+    // Return empty output arrays if there are no points.
+    if (num_points == 0 || num_queries == 0) {
+        std::fill(query_neighbors_row_splits,
+                  query_neighbors_row_splits + num_queries + 1, 0);
+        int32_t* indices_ptr;
+        output_allocator.AllocIndices(&indices_ptr, 0);
+        T* distances_ptr;
+        output_allocator.AllocDistances(&distances_ptr, 0);
+        return;
+    }
+
+    // Use squared radius to avoid sqrt.
+    const T threshold = radius * radius;
+    const T voxel_size = 2 * radius;
+    const T inv_voxel_size = 1 / voxel_size;
+
+    // Count the neighbors of each query point. Note the +1 for the prefix sum.
+    for (int b = 0; b < batch_size; ++b) {
+        const size_t hash_table_size =
+                hash_table_splits[b + 1] - hash_table_splits[b];
+        const size_t first_cell_idx = hash_table_splits[b];
+        tbb::parallel_for(
+                tbb::blocked_range<int64_t>(queries_row_splits[b],
+                                            queries_row_splits[b + 1]),
+                [&](const tbb::blocked_range<int64_t>& r) {
+                    size_t bins_to_visit[kMaxBinsToVisit];
+                    for (int64_t i = r.begin(); i != r.end(); ++i) {
+                        Vec3<T> pos(queries + 3 * i);
+                        int num_bins = ComputeBinsToVisit(
+                                pos, radius, inv_voxel_size, hash_table_size,
+                                first_cell_idx, bins_to_visit);
+                        int64_t neighbors_count = 0;
+                        for (int k = 0; k < num_bins; ++k) {
+                            const size_t bin = bins_to_visit[k];
+                            for (uint32_t j = hash_table_cell_splits[bin];
+                                 j < hash_table_cell_splits[bin + 1]; ++j) {
+                                const uint32_t idx = hash_table_index[j];
+                                if (SquaredDistance(pos, points + 3 * idx) <=
+                                    threshold) {
+                                    ++neighbors_count;
+                                }
+                            }
+                        }
+                        query_neighbors_row_splits[i + 1] = neighbors_count;
+                    }
+                });
+    }
+    query_neighbors_row_splits[0] = 0;
+    utility::InclusivePrefixSum(query_neighbors_row_splits + 1,
+                                query_neighbors_row_splits + num_queries + 1,
+                                query_neighbors_row_splits + 1);
+    const size_t num_indices = query_neighbors_row_splits[num_queries];
+
+    int32_t* indices_ptr;
+    output_allocator.AllocIndices(&indices_ptr, num_indices);
+    T* distances_ptr;
+    output_allocator.AllocDistances(&distances_ptr, num_indices);
+
+    // Write the neighbors of each query point, sorted by distance like the
+    // KDTree based radius search.
+    for (int b = 0; b < batch_size; ++b) {
+        const size_t hash_table_size =
+                hash_table_splits[b + 1] - hash_table_splits[b];
+        const size_t first_cell_idx = hash_table_splits[b];
+        tbb::parallel_for(
+                tbb::blocked_range<int64_t>(queries_row_splits[b],
+                                            queries_row_splits[b + 1]),
+                [&](const tbb::blocked_range<int64_t>& r) {
+                    size_t bins_to_visit[kMaxBinsToVisit];
+                    std::vector<std::pair<T, int32_t>> neighbors;
+                    for (int64_t i = r.begin(); i != r.end(); ++i) {
+                        Vec3<T> pos(queries + 3 * i);
+                        int num_bins = ComputeBinsToVisit(
+                                pos, radius, inv_voxel_size, hash_table_size,
+                                first_cell_idx, bins_to_visit);
+                        neighbors.clear();
+                        for (int k = 0; k < num_bins; ++k) {
+                            const size_t bin = bins_to_visit[k];
+                            for (uint32_t j = hash_table_cell_splits[bin];
+                                 j < hash_table_cell_splits[bin + 1]; ++j) {
+                                const uint32_t idx = hash_table_index[j];
+                                T dist = SquaredDistance(pos, points + 3 * idx);
+                                if (dist <= threshold) {
+                                    neighbors.emplace_back(dist, int32_t(idx));
+                                }
+                            }
+                        }
+                        std::sort(neighbors.begin(), neighbors.end());
+                        const int64_t offset = query_neighbors_row_splits[i];
+                        for (size_t k = 0; k < neighbors.size(); ++k) {
+                            distances_ptr[offset + k] = neighbors[k].first;
+                            indices_ptr[offset + k] = neighbors[k].second;
+                        }
+                    }
+                });
+    }
+}
+
+template void BuildSpatialHashTableCPU(
+        const size_t num_points,
+        const float* const points,
+        const float radius,
+        const size_t points_row_splits_size,
+        const int64_t* points_row_splits,
+        const uint32_t* hash_table_splits,
+        const size_t hash_table_cell_splits_size,
+        uint32_t* hash_table_cell_splits,
+        uint32_t* hash_table_index);
+
+template void BuildSpatialHashTableCPU(
+        const size_t num_points,
+        const double* const points,
+        const double radius,
+        const size_t points_row_splits_size,
+        const int64_t* points_row_splits,
+        const uint32_t* hash_table_splits,
+        const size_t hash_table_cell_splits_size,
+        uint32_t* hash_table_cell_splits,
+        uint32_t* hash_table_index);
+
+template void FixedRadiusSearchCPU(
+        int64_t* query_neighbors_row_splits,
+        size_t num_points,
+        const float* const points,
+        size_t num_queries,
+        const float* const queries,
+        const float radius,
+        const size_t points_row_splits_size,
+        const int64_t* const points_row_splits,
+        const size_t queries_row_splits_size,
+        const int64_t* const queries_row_splits,
+        const uint32_t* const hash_table_splits,
+        size_t hash_table_cell_splits_size,
+        const uint32_t* const hash_table_cell_splits,
+        const uint32_t* const hash_table_index,
+        NeighborSearchAllocator<float>& output_allocator);
+
+template void FixedRadiusSearchCPU(
+        int64_t* query_neighbors_row_splits,
+        size_t num_points,
+        const double* const points,
+        size_t num_queries,
+        const double* const queries,
+        const double radius,
+        const size_t points_row_splits_size,
+        const int64_t* const points_row_splits,
+        const size_t queries_row_splits_size,
+        const int64_t* const queries_row_splits,
+        const uint32_t* const hash_table_splits,
+        size_t hash_table_cell_splits_size,
+        const uint32_t* const hash_table_cell_splits,
+        const uint32_t* const hash_table_index,
+        NeighborSearchAllocator<double>& output_allocator);
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include <tbb/parallel_for.h>
 
+#include <atomic>
 #include <nanoflann.hpp>
 
 #include "open3d/core/CoreUtil.h"
@@ -79,51 +80,48 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
     }
 
     int64_t num_query_points = query_points.GetShape()[0];
+    int dimension = GetDimension();
     Dtype dtype = GetDtype();
-
-    Tensor indices;
-    Tensor distances;
+    // Every query returns min(knn, dataset_size) neighbors.
+    int64_t num_neighbors =
+            std::min(static_cast<int64_t>(knn),
+                     static_cast<int64_t>(GetDatasetSize()));
+
+    Tensor query_contiguous = query_points.Contiguous();
+    Tensor indices({num_query_points, num_neighbors}, Dtype::Int64);
+    Tensor distances({num_query_points, num_neighbors}, dtype);
     DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
-        Tensor batch_indices =
-                Tensor::Full({num_query_points, knn}, -1, Dtype::Int64);
-        Tensor batch_distances =
-                Tensor::Full({num_query_points, knn}, -1, dtype);
-
         auto holder = static_cast<NanoFlannIndexHolder<L2, scalar_t> *>(
                 holder_.get());
+        const scalar_t *query_ptr = query_contiguous.GetDataPtr<scalar_t>();
+        int64_t *indices_ptr = indices.GetDataPtr<int64_t>();
+        scalar_t *distances_ptr = distances.GetDataPtr<scalar_t>();
+        std::atomic<bool> valid(true);
 
-        // Parallel search.
+        // Parallel search, writing straight into the output buffers.
         tbb::parallel_for(
-                tbb::blocked_range<size_t>(0, num_query_points),
-                [&](const tbb::blocked_range<size_t> &r) {
-                    for (size_t i = r.begin(); i != r.end(); ++i) {
-                        auto single_indices = static_cast<int64_t *>(
-                                batch_indices[i].GetDataPtr());
-                        auto single_distances = static_cast<scalar_t *>(
-                                batch_distances[i].GetDataPtr());
-
-                        // search
-                        holder->index_->knnSearch(
-                                static_cast<scalar_t *>(
-                                        query_points[i].GetDataPtr()),
-                                static_cast<size_t>(knn), single_indices,
-                                single_distances);
+                tbb::blocked_range<int64_t>(0, num_query_points),
+                [&](const tbb::blocked_range<int64_t> &r) {
+                    nanoflann::SearchParams params;
+                    for (int64_t i = r.begin(); i != r.end(); ++i) {
+                        nanoflann::KNNResultSet<scalar_t, int64_t> result_set(
+                                num_neighbors);
+                        result_set.init(indices_ptr + i * num_neighbors,
+                                        distances_ptr + i * num_neighbors);
+                        holder->index_->findNeighbors(
+                                result_set, query_ptr + i * dimension, params);
+                        if (static_cast<int64_t>(result_set.size()) !=
+                            num_neighbors) {
+                            valid = false;
+                        }
                     }
                 });
         // Check if the number of neighbors are same.
-        Tensor check_valid =
-                batch_indices.Ge(0).To(Dtype::Int64).Sum({-1}, false);
-        int64_t num_neighbors = check_valid[0].Item<int64_t>();
-        if (check_valid.Ne(num_neighbors).Any()) {
+        if (!valid) {
             utility::LogError(
                     "[NanoFlannIndex::SearchKnn] The number of neighbors are "
                     "different. Something went wrong.");
         }
-        // Slice non-zero items.
-        indices = batch_indices.Slice(1, 0, num_neighbors)
-                          .View({num_query_points, num_neighbors});
-        distances = batch_distances.Slice(1, 0, num_neighbors)
-                            .View({num_query_points, num_neighbors});
     });
     return std::make_pair(indices, distances);
 };
@@ -139,74 +137,88 @@ std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchRadius(
     query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
     radii.AssertShape({num_query_points});
 
+    int dimension = GetDimension();
     Dtype dtype = GetDtype();
     Tensor indices;
     Tensor distances;
-    Tensor num_neighbors;
+    Tensor num_neighbors({num_query_points}, Dtype::Int64);
 
-    DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
-        std::vector<std::vector<size_t>> batch_indices(num_query_points);
-        std::vector<std::vector<scalar_t>> batch_distances(num_query_points);
-        std::vector<int64_t> batch_nums;
+    // Check if the raii has negative values.
+    Tensor below_zero = radii.Le(0);
+    if (below_zero.Any()) {
+        utility::LogError(
+                "[NanoFlannIndex::SearchRadius] radius should be "
+                "larger than 0.");
+    }
 
+    Tensor query_contiguous = query_points.Contiguous();
+    Tensor radii_contiguous = radii.Contiguous();
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
         auto holder = static_cast<NanoFlannIndexHolder<L2, scalar_t> *>(
                 holder_.get());
-
+        const scalar_t *query_ptr = query_contiguous.GetDataPtr<scalar_t>();
+        const scalar_t *radii_ptr = radii_contiguous.GetDataPtr<scalar_t>();
+        int64_t *num_neighbors_ptr = num_neighbors.GetDataPtr<int64_t>();
+
+        // Queries are split into fixed chunks. Each chunk collects its
+        // results in its own buffer, the buffers are then copied to their
+        // offsets in the output tensors.
+        const int64_t chunk_size = 1024;
+        const int64_t num_chunks =
+                (num_query_points + chunk_size - 1) / chunk_size;
+        std::vector<std::vector<std::pair<int64_t, scalar_t>>> chunk_matches(
+                num_chunks);
         nanoflann::SearchParams params;
 
-        // Check if the raii has negative values.
-        Tensor below_zero = radii.Le(0);
-        if (below_zero.Any()) {
-            utility::LogError(
-                    "[NanoFlannIndex::SearchRadius] radius should be "
-                    "larger than 0.");
-        }
-
         // Parallel search.
         tbb::parallel_for(
-                tbb::blocked_range<size_t>(0, num_query_points),
-                [&](const tbb::blocked_range<size_t> &r) {
+                tbb::blocked_range<int64_t>(0, num_chunks, 1),
+                [&](const tbb::blocked_range<int64_t> &r) {
                     std::vector<std::pair<int64_t, scalar_t>> ret_matches;
-                    for (size_t i = r.begin(); i != r.end(); ++i) {
-                        scalar_t radius = radii[i].Item<scalar_t>();
-
-                        size_t num_results = holder->index_->radiusSearch(
-                                static_cast<scalar_t *>(
-                                        query_points[i].GetDataPtr()),
-                                radius * radius, ret_matches, params);
-                        ret_matches.resize(num_results);
-                        std::vector<size_t> single_indices;
-                        std::vector<scalar_t> single_distances;
-                        for (auto it = ret_matches.begin();
-                             it < ret_matches.end(); it++) {
-                            single_indices.push_back(it->first);
-                            single_distances.push_back(it->second);
+                    for (int64_t chunk = r.begin(); chunk != r.end();
+                         ++chunk) {
+                        const int64_t begin = chunk * chunk_size;
+                        const int64_t end = std::min(begin + chunk_size,
+                                                     num_query_points);
+                        for (int64_t i = begin; i < end; ++i) {
+                            scalar_t radius = radii_ptr[i];
+                            size_t num_results = holder->index_->radiusSearch(
+                                    query_ptr + i * dimension, radius * radius,
+                                    ret_matches, params);
+                            num_neighbors_ptr[i] =
+                                    static_cast<int64_t>(num_results);
+                            chunk_matches[chunk].insert(
+                                    chunk_matches[chunk].end(),
+                                    ret_matches.begin(),
+                                    ret_matches.begin() + num_results);
                         }
-                        batch_indices[i] = single_indices;
-                        batch_distances[i] = single_distances;
                     }
                 });
 
-        // Flatten.
-        std::vector<int64_t> batch_indices2;
-        std::vector<scalar_t> batch_distances2;
-        for (auto i = 0; i < num_query_points; i++) {
-            batch_indices2.insert(batch_indices2.end(),
-                                  batch_indices[i].begin(),
-                                  batch_indices[i].end());
-            batch_distances2.insert(batch_distances2.end(),
-                                    batch_distances[i].begin(),
-                                    batch_distances[i].end());
-            batch_nums.push_back(batch_indices[i].size());
-        }
         // Make result Tensors.
-        int64_t total_nums = 0;
-        for (auto &s : batch_nums) {
-            total_nums += s;
+        std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
+        for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+            chunk_offsets[chunk + 1] =
+                    chunk_offsets[chunk] + chunk_matches[chunk].size();
         }
-        indices = Tensor(batch_indices2, {total_nums}, Dtype::Int64);
-        distances = Tensor(batch_distances2, {total_nums}, dtype);
-        num_neighbors = Tensor(batch_nums, {num_query_points}, Dtype::Int64);
+        int64_t total_nums = chunk_offsets[num_chunks];
+        indices = Tensor({total_nums}, Dtype::Int64);
+        distances = Tensor({total_nums}, dtype);
+        int64_t *indices_ptr = indices.GetDataPtr<int64_t>();
+        scalar_t *distances_ptr = distances.GetDataPtr<scalar_t>();
+        tbb::parallel_for(
+                tbb::blocked_range<int64_t>(0, num_chunks, 1),
+                [&](const tbb::blocked_range<int64_t> &r) {
+                    for (int64_t chunk = r.begin(); chunk != r.end();
+                         ++chunk) {
+                        int64_t offset = chunk_offsets[chunk];
+                        for (const auto &match : chunk_matches[chunk]) {
+                            indices_ptr[offset] = match.first;
+                            distances_ptr[offset] = match.second;
+                            ++offset;
+                        }
+                    }
+                });
     });
     return std::make_tuple(indices, distances, num_neighbors);
 };
@@ -248,18 +260,20 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchHybrid(
     Tensor distances;
     std::tie(indices, distances) = SearchKnn(query_points, max_knn);
 
+    // Invalidate neighbors outside of the radius in place.
     Dtype dtype = GetDtype();
     DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
-        Tensor invalid = distances.Gt(radius);
-        Tensor invalid_indices =
-                Tensor(std::vector<int64_t>({-1}), {1}, indices.GetDtype(),
-                       indices.GetDevice());
-        Tensor invalid_distances =
-                Tensor(std::vector<scalar_t>({-1}), {1}, distances.GetDtype(),
-                       distances.GetDevice());
-
-        indices.SetItem(TensorKey::IndexTensor(invalid), invalid_indices);
-        distances.SetItem(TensorKey::IndexTensor(invalid), invalid_distances);
+        int64_t *indices_ptr = indices.GetDataPtr<int64_t>();
+        scalar_t *distances_ptr = distances.GetDataPtr<scalar_t>();
+        tbb::parallel_for(tbb::blocked_range<int64_t>(0, indices.NumElements()),
+                          [&](const tbb::blocked_range<int64_t> &r) {
+                              for (int64_t i = r.begin(); i != r.end(); ++i) {
+                                  if (distances_ptr[i] > radius) {
+                                      indices_ptr[i] = -1;
+                                      distances_ptr[i] = -1;
+                                  }
+                              }
+                          });
     });
 
     return std::make_pair(indices, distances);
@@ -75,6 +75,12 @@ bool NearestNeighborSearch::FixedRadiusIndex(utility::optional<double> radius) {
 #endif
 
     } else {
+        if (radius.has_value()) {
+            fixed_radius_index_.reset(new nns::FixedRadiusIndex());
+            return fixed_radius_index_->SetTensorData(dataset_points_,
+                                                      radius.value());
+        }
+        fixed_radius_index_.reset();
         return SetIndex();
     }
 }
@@ -111,6 +117,15 @@ std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
 
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
         const Tensor& query_points, double radius) {
+    // The hash table cell size is derived from the radius of the index, so
+    // the index only answers queries with that radius.
+    if (fixed_radius_index_ && fixed_radius_index_->GetRadius() != radius) {
+        utility::LogError(
+                "[NearestNeighborSearch::FixedRadiusSearch] radius {} differs "
+                "from the radius {} of the index. Call FixedRadiusIndex() "
+                "with the new radius to rebuild the index.",
+                radius, fixed_radius_index_->GetRadius());
+    }
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
         if (fixed_radius_index_) {
             return fixed_radius_index_->SearchRadius(query_points, radius);
@@ -120,7 +135,9 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
                     "set.");
         }
     } else {
-        if (nanoflann_index_) {
+        if (fixed_radius_index_) {
+            return fixed_radius_index_->SearchRadius(query_points, radius);
+        } else if (nanoflann_index_) {
             return nanoflann_index_->SearchRadius(query_points, radius);
         } else {
             utility::LogError(
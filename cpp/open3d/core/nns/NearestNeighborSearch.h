@@ -68,7 +68,9 @@ public:
     /// Set index for fixed-radius search.
     ///
     /// \param radius optional radius parameter. required for gpu fixed radius
-    /// index. \return Returns true if building index success, otherwise false.
+    /// index. On CPU, a spatial hash table is built for the given radius,
+    /// otherwise a KDTree index is used.
+    /// \return Returns true if building index success, otherwise false.
     bool FixedRadiusIndex(utility::optional<double> radius = {});
 
     /// Set index for hybrid search.
@@ -89,7 +91,11 @@ public:
     ///
     /// \param query_points Data points for querying. Must be 2D, with shape {n,
     /// d}.
-    /// \param radius Radius.
+    /// \param radius Radius. With a hash table index, it must be the radius
+    /// given to FixedRadiusIndex. Searching with another radius requires
+    /// calling FixedRadiusIndex again, which rebuilds the index in O(N). A
+    /// KDTree index, built on CPU when FixedRadiusIndex gets no radius,
+    /// accepts any radius.
     /// \return Tuple of Tensors, (indices, distances, num_neighbors):
     /// - indicecs: Tensor of shape {total_number_of_neighbors,}, with dtype
     /// Int64.
@@ -319,28 +319,42 @@ void PointCloud::EstimateNormals(
     }
     KDTreeFlann kdtree;
     kdtree.SetGeometry(*this);
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)points_.size(); i++) {
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        Eigen::Vector3d normal;
-        if (kdtree.Search(points_[i], search_param, indices, distance2) >= 3) {
-            normal = ComputeNormal(*this, indices, fast_normal_computation);
-            if (normal.norm() == 0.0) {
-                if (has_normal) {
-                    normal = normals_[i];
-                } else {
-                    normal = Eigen::Vector3d(0.0, 0.0, 1.0);
+    kdtree.SearchBatchBlocked(
+            points_, search_param,
+            [&](int64_t block_begin, int64_t block_end,
+                const std::vector<int> &nbs, const std::vector<double> &,
+                const std::vector<int64_t> &nbs_offsets) {
+#pragma omp parallel
+                {
+                    std::vector<int> indices;
+#pragma omp for schedule(static)
+                    for (int64_t i = block_begin; i < block_end; i++) {
+                        const int64_t nb_begin = nbs_offsets[i - block_begin];
+                        const int64_t nb_end =
+                                nbs_offsets[i - block_begin + 1];
+                        Eigen::Vector3d normal;
+                        if (nb_end - nb_begin >= 3) {
+                            indices.assign(nbs.begin() + nb_begin,
+                                           nbs.begin() + nb_end);
+                            normal = ComputeNormal(*this, indices,
+                                                   fast_normal_computation);
+                            if (normal.norm() == 0.0) {
+                                if (has_normal) {
+                                    normal = normals_[i];
+                                } else {
+                                    normal = Eigen::Vector3d(0.0, 0.0, 1.0);
+                                }
+                            }
+                            if (has_normal && normal.dot(normals_[i]) < 0.0) {
+                                normal *= -1.0;
+                            }
+                            normals_[i] = normal;
+                        } else {
+                            normals_[i] = Eigen::Vector3d(0.0, 0.0, 1.0);
+                        }
+                    }
                 }
-            }
-            if (has_normal && normal.dot(normals_[i]) < 0.0) {
-                normal *= -1.0;
-            }
-            normals_[i] = normal;
-        } else {
-            normals_[i] = Eigen::Vector3d(0.0, 0.0, 1.0);
-        }
-    }
+            });
 }
 
 void PointCloud::OrientNormalsToAlignWithDirection(
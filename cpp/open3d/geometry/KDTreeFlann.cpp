@@ -41,12 +41,36 @@
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+/// Per-thread scratch buffers for searches in the single precision index,
+/// which need the query and the distances converted from and to double.
+struct FloatSearchBuffers {
+    std::vector<float> query;
+    std::vector<float> distance2;
+    std::vector<std::vector<int>> radius_indices =
+            std::vector<std::vector<int>>(1);
+    std::vector<std::vector<float>> radius_distance2 =
+            std::vector<std::vector<float>>(1);
+};
+
+FloatSearchBuffers &GetFloatSearchBuffers() {
+    static thread_local FloatSearchBuffers buffers;
+    return buffers;
+}
+
+}  // namespace
+
 KDTreeFlann::KDTreeFlann() {}
 
 KDTreeFlann::KDTreeFlann(const Eigen::MatrixXd &data) { SetMatrixData(data); }
 
 KDTreeFlann::KDTreeFlann(const Geometry &geometry) { SetGeometry(geometry); }
 
+KDTreeFlann::KDTreeFlann(const Geometry &geometry, DataStorage storage) {
+    SetGeometry(geometry, storage);
+}
+
 KDTreeFlann::KDTreeFlann(const pipelines::registration::Feature &feature) {
     SetFeature(feature);
 }
@@ -54,23 +78,37 @@ KDTreeFlann::KDTreeFlann(const pipelines::registration::Feature &feature) {
 KDTreeFlann::~KDTreeFlann() {}
 
 bool KDTreeFlann::SetMatrixData(const Eigen::MatrixXd &data) {
+    return SetMatrixData(data, DataStorage::Copy);
+}
+
+bool KDTreeFlann::SetMatrixData(const Eigen::MatrixXd &data,
+                                DataStorage storage) {
     return SetRawData(Eigen::Map<const Eigen::MatrixXd>(
-            data.data(), data.rows(), data.cols()));
+                              data.data(), data.rows(), data.cols()),
+                      storage);
 }
 
 bool KDTreeFlann::SetGeometry(const Geometry &geometry) {
+    return SetGeometry(geometry, DataStorage::Copy);
+}
+
+bool KDTreeFlann::SetGeometry(const Geometry &geometry, DataStorage storage) {
     switch (geometry.GetGeometryType()) {
-        case Geometry::GeometryType::PointCloud:
-            return SetRawData(Eigen::Map<const Eigen::MatrixXd>(
-                    (const double *)((const PointCloud &)geometry)
-                            .points_.data(),
-                    3, ((const PointCloud &)geometry).points_.size()));
+        case Geometry::GeometryType::PointCloud: {
+            const auto &points = ((const PointCloud &)geometry).points_;
+            return SetRawData(
+                    Eigen::Map<const Eigen::MatrixXd>(
+                            (const double *)points.data(), 3, points.size()),
+                    storage);
+        }
         case Geometry::GeometryType::TriangleMesh:
-        case Geometry::GeometryType::HalfEdgeTriangleMesh:
+        case Geometry::GeometryType::HalfEdgeTriangleMesh: {
+            const auto &vertices = ((const TriangleMesh &)geometry).vertices_;
             return SetRawData(Eigen::Map<const Eigen::MatrixXd>(
-                    (const double *)((const TriangleMesh &)geometry)
-                            .vertices_.data(),
-                    3, ((const TriangleMesh &)geometry).vertices_.size()));
+                                      (const double *)vertices.data(), 3,
+                                      vertices.size()),
+                              storage);
+        }
         case Geometry::GeometryType::Image:
         case Geometry::GeometryType::Unspecified:
         default:
@@ -116,10 +154,13 @@ int KDTreeFlann::SearchKNN(const T &query,
     // This is optimized code for heavily repeated search.
     // Other flann::Index::knnSearch() implementations lose performance due to
     // memory allocation/deallocation.
-    if (data_.empty() || dataset_size_ <= 0 ||
-        size_t(query.rows()) != dimension_ || knn < 0) {
+    if (dataset_size_ <= 0 || size_t(query.rows()) != dimension_ ||
+        knn < 0) {
         return -1;
     }
+    if (flann_index_float_) {
+        return SearchKNNFloat(query.data(), knn, indices, distance2);
+    }
     flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
     indices.resize(knn);
     distance2.resize(knn);
@@ -141,10 +182,12 @@ int KDTreeFlann::SearchRadius(const T &query,
     // Since max_nn is not given, we let flann to do its own memory management.
     // Other flann::Index::radiusSearch() implementations lose performance due
     // to memory management and CPU caching.
-    if (data_.empty() || dataset_size_ <= 0 ||
-        size_t(query.rows()) != dimension_) {
+    if (dataset_size_ <= 0 || size_t(query.rows()) != dimension_) {
         return -1;
     }
+    if (flann_index_float_) {
+        return SearchRadiusFloat(query.data(), radius, -1, indices, distance2);
+    }
     flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
     flann::SearchParams param(-1, 0.0);
     param.max_neighbors = -1;
@@ -167,10 +210,14 @@ int KDTreeFlann::SearchHybrid(const T &query,
     // It is also the recommended setting for search.
     // Other flann::Index::radiusSearch() implementations lose performance due
     // to memory allocation/deallocation.
-    if (data_.empty() || dataset_size_ <= 0 ||
-        size_t(query.rows()) != dimension_ || max_nn < 0) {
+    if (dataset_size_ <= 0 || size_t(query.rows()) != dimension_ ||
+        max_nn < 0) {
         return -1;
     }
+    if (flann_index_float_) {
+        return SearchRadiusFloat(query.data(), radius, max_nn, indices,
+                                 distance2);
+    }
     flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
     flann::SearchParams param(-1, 0.0);
     param.max_neighbors = max_nn;
@@ -186,21 +233,231 @@ int KDTreeFlann::SearchHybrid(const T &query,
     return k;
 }
 
-bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
+bool KDTreeFlann::SearchBatch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                              const KDTreeSearchParam &param,
+                              std::vector<int> &indices,
+                              std::vector<double> &distance2,
+                              std::vector<int64_t> &offsets) const {
+    const int64_t num_queries = queries.cols();
+    if (dataset_size_ <= 0 || size_t(queries.rows()) != dimension_) {
+        indices.clear();
+        distance2.clear();
+        offsets.assign(num_queries + 1, 0);
+        return false;
+    }
+
+    // Queries are processed in fixed-size chunks, each chunk writing into its
+    // own buffers, so that the buffers can be concatenated in query order
+    // afterwards.
+    const int64_t chunk_size = 1024;
+    const int64_t num_chunks = (num_queries + chunk_size - 1) / chunk_size;
+    std::vector<std::vector<int>> chunk_indices(num_chunks);
+    std::vector<std::vector<double>> chunk_distance2(num_chunks);
+    offsets.assign(num_queries + 1, 0);
+    const bool is_radius_search =
+            flann_index_ &&
+            param.GetSearchType() == KDTreeSearchParam::SearchType::Radius;
+#pragma omp parallel
+    {
+        // Per-thread scratch buffers, reused across queries.
+        std::vector<int> query_indices;
+        std::vector<double> query_distance2;
+        std::vector<std::vector<int>> radius_indices(1);
+        std::vector<std::vector<double>> radius_distance2(1);
+#pragma omp for schedule(dynamic)
+        for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+            const int64_t begin = chunk * chunk_size;
+            const int64_t end = std::min(begin + chunk_size, num_queries);
+            for (int64_t i = begin; i < end; ++i) {
+                const double *query_ptr = queries.col(i).data();
+                const int *result_indices = nullptr;
+                const double *result_distance2 = nullptr;
+                int k = 0;
+                if (is_radius_search) {
+                    // Unlike SearchRadius(), keep flann's result vectors
+                    // alive across queries to reuse their memory.
+                    const double radius =
+                            ((const KDTreeSearchParamRadius &)param).radius_;
+                    flann::Matrix<double> query_flann((double *)query_ptr, 1,
+                                                      dimension_);
+                    flann::SearchParams flann_param(-1, 0.0);
+                    flann_param.max_neighbors = -1;
+                    k = flann_index_->radiusSearch(
+                            query_flann, radius_indices, radius_distance2,
+                            float(radius * radius), flann_param);
+                    result_indices = radius_indices[0].data();
+                    result_distance2 = radius_distance2[0].data();
+                } else {
+                    k = Search(Eigen::Map<const Eigen::VectorXd>(query_ptr,
+                                                                 dimension_),
+                               param, query_indices, query_distance2);
+                    result_indices = query_indices.data();
+                    result_distance2 = query_distance2.data();
+                }
+                k = std::max(k, 0);
+                offsets[i + 1] = k;
+                chunk_indices[chunk].insert(chunk_indices[chunk].end(),
+                                            result_indices, result_indices + k);
+                chunk_distance2[chunk].insert(chunk_distance2[chunk].end(),
+                                              result_distance2,
+                                              result_distance2 + k);
+            }
+        }
+    }
+    for (int64_t i = 0; i < num_queries; ++i) {
+        offsets[i + 1] += offsets[i];
+    }
+    indices.resize(offsets[num_queries]);
+    distance2.resize(offsets[num_queries]);
+#pragma omp parallel for schedule(static)
+    for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+        const int64_t begin = offsets[chunk * chunk_size];
+        std::copy(chunk_indices[chunk].begin(), chunk_indices[chunk].end(),
+                  indices.begin() + begin);
+        std::copy(chunk_distance2[chunk].begin(), chunk_distance2[chunk].end(),
+                  distance2.begin() + begin);
+    }
+    return true;
+}
+
+bool KDTreeFlann::SearchBatch(const std::vector<Eigen::Vector3d> &queries,
+                              const KDTreeSearchParam &param,
+                              std::vector<int> &indices,
+                              std::vector<double> &distance2,
+                              std::vector<int64_t> &offsets) const {
+    return SearchBatch(Eigen::Map<const Eigen::MatrixXd>(
+                               (const double *)queries.data(), 3,
+                               queries.size()),
+                       param, indices, distance2, offsets);
+}
+
+void KDTreeFlann::SearchBatchBlocked(
+        const std::vector<Eigen::Vector3d> &queries,
+        const KDTreeSearchParam &param,
+        const std::function<void(int64_t,
+                                 int64_t,
+                                 const std::vector<int> &,
+                                 const std::vector<double> &,
+                                 const std::vector<int64_t> &)> &func,
+        int64_t block_size /* = 65536 */) const {
+    const int64_t num_queries = int64_t(queries.size());
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    std::vector<int64_t> offsets;
+    for (int64_t block_begin = 0; block_begin < num_queries;
+         block_begin += block_size) {
+        const int64_t block_end =
+                std::min(block_begin + block_size, num_queries);
+        SearchBatch(Eigen::Map<const Eigen::MatrixXd>(
+                            queries[block_begin].data(), 3,
+                            block_end - block_begin),
+                    param, indices, distance2, offsets);
+        func(block_begin, block_end, indices, distance2, offsets);
+    }
+}
+
+int KDTreeFlann::SearchKNNFloat(const double *query,
+                                int knn,
+                                std::vector<int> &indices,
+                                std::vector<double> &distance2) const {
+    FloatSearchBuffers &buffers = GetFloatSearchBuffers();
+    buffers.query.assign(query, query + dimension_);
+    buffers.distance2.resize(knn);
+    indices.resize(knn);
+    flann::Matrix<float> query_flann(buffers.query.data(), 1, dimension_);
+    flann::Matrix<int> indices_flann(indices.data(), 1, knn);
+    flann::Matrix<float> dists_flann(buffers.distance2.data(), 1, knn);
+    int k = flann_index_float_->knnSearch(query_flann, indices_flann,
+                                          dists_flann, knn,
+                                          flann::SearchParams(-1, 0.0));
+    indices.resize(k);
+    distance2.assign(buffers.distance2.begin(), buffers.distance2.begin() + k);
+    return k;
+}
+
+int KDTreeFlann::SearchRadiusFloat(const double *query,
+                                   double radius,
+                                   int max_nn,
+                                   std::vector<int> &indices,
+                                   std::vector<double> &distance2) const {
+    FloatSearchBuffers &buffers = GetFloatSearchBuffers();
+    buffers.query.assign(query, query + dimension_);
+    flann::Matrix<float> query_flann(buffers.query.data(), 1, dimension_);
+    flann::SearchParams param(-1, 0.0);
+    param.max_neighbors = max_nn;
+    int k = 0;
+    if (max_nn < 0) {
+        k = flann_index_float_->radiusSearch(
+                query_flann, buffers.radius_indices, buffers.radius_distance2,
+                float(radius * radius), param);
+        indices = buffers.radius_indices[0];
+        distance2.assign(buffers.radius_distance2[0].begin(),
+                         buffers.radius_distance2[0].end());
+    } else {
+        buffers.distance2.resize(max_nn);
+        indices.resize(max_nn);
+        flann::Matrix<int> indices_flann(indices.data(), 1, max_nn);
+        flann::Matrix<float> dists_flann(buffers.distance2.data(), 1, max_nn);
+        k = flann_index_float_->radiusSearch(query_flann, indices_flann,
+                                             dists_flann,
+                                             float(radius * radius), param);
+        indices.resize(k);
+        distance2.assign(buffers.distance2.begin(),
+                         buffers.distance2.begin() + k);
+    }
+    return k;
+}
+
+bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data,
+                             DataStorage storage) {
+    flann_index_.reset();
+    flann_dataset_.reset();
+    flann_index_float_.reset();
+    flann_dataset_float_.reset();
+    data_.clear();
+    data_.shrink_to_fit();
+    data_float_.clear();
+    data_float_.shrink_to_fit();
     dimension_ = data.rows();
     dataset_size_ = data.cols();
     if (dimension_ == 0 || dataset_size_ == 0) {
         utility::LogWarning("[KDTreeFlann::SetRawData] Failed due to no data.");
         return false;
     }
-    data_.resize(dataset_size_ * dimension_);
-    memcpy(data_.data(), data.data(),
-           dataset_size_ * dimension_ * sizeof(double));
-    flann_dataset_.reset(new flann::Matrix<double>((double *)data_.data(),
-                                                   dataset_size_, dimension_));
-    flann_index_.reset(new flann::Index<flann::L2<double>>(
-            *flann_dataset_, flann::KDTreeSingleIndexParams(15)));
-    flann_index_->buildIndex();
+    const size_t num_values = dataset_size_ * dimension_;
+    switch (storage) {
+        case DataStorage::Copy:
+            data_.resize(num_values);
+            memcpy(data_.data(), data.data(), num_values * sizeof(double));
+            flann_dataset_.reset(new flann::Matrix<double>(
+                    data_.data(), dataset_size_, dimension_));
+            flann_index_.reset(new flann::Index<flann::L2<double>>(
+                    *flann_dataset_, flann::KDTreeSingleIndexParams(15)));
+            flann_index_->buildIndex();
+            break;
+        case DataStorage::Reference:
+            // Without reordering, flann searches the points through pointers
+            // into the original data instead of keeping its own copy.
+            flann_dataset_.reset(new flann::Matrix<double>(
+                    (double *)data.data(), dataset_size_, dimension_));
+            flann_index_.reset(new flann::Index<flann::L2<double>>(
+                    *flann_dataset_,
+                    flann::KDTreeSingleIndexParams(15, false)));
+            flann_index_->buildIndex();
+            break;
+        case DataStorage::Float:
+            data_float_.resize(num_values);
+#pragma omp parallel for schedule(static)
+            for (int64_t i = 0; i < int64_t(num_values); ++i) {
+                data_float_[i] = float(data.data()[i]);
+            }
+            flann_dataset_float_.reset(new flann::Matrix<float>(
+                    data_float_.data(), dataset_size_, dimension_));
+            flann_index_float_.reset(new flann::Index<flann::L2<float>>(
+                    *flann_dataset_float_, flann::KDTreeSingleIndexParams(15)));
+            flann_index_float_->buildIndex();
+            break;
+    }
     return true;
 }
 
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -52,6 +53,24 @@ namespace geometry {
 ///
 /// \brief KDTree with FLANN for nearest neighbor search.
 class KDTreeFlann {
+public:
+    /// \enum DataStorage
+    ///
+    /// \brief How the KDTree stores the data points it is built on.
+    enum class DataStorage {
+        /// Copies the data into the KDTree.
+        Copy,
+        /// Indexes the data in place, without any copy. The data must outlive
+        /// the KDTree and must not be modified or reallocated while the KDTree
+        /// is in use. Uses the least memory, but searches are slower since
+        /// the points are not stored in tree order.
+        Reference,
+        /// Copies the data converted to single precision. This halves the
+        /// memory of the copies, and distances are computed in single
+        /// precision.
+        Float,
+    };
+
 public:
     /// \brief Default Constructor.
     KDTreeFlann();
@@ -65,6 +84,11 @@ public:
     KDTreeFlann(const Geometry &geometry);
     /// \brief Parameterized Constructor.
     ///
+    /// \param geometry Provides geometry from which KDTree is constructed.
+    /// \param storage How the points of the geometry are stored.
+    KDTreeFlann(const Geometry &geometry, DataStorage storage);
+    /// \brief Parameterized Constructor.
+    ///
     /// \param feature Provides a set of features from which the KDTree is
     /// constructed.
     KDTreeFlann(const pipelines::registration::Feature &feature);
@@ -77,10 +101,20 @@ public:
     ///
     /// \param data Data points for KDTree Construction.
     bool SetMatrixData(const Eigen::MatrixXd &data);
+    /// Sets the data for the KDTree from a matrix.
+    ///
+    /// \param data Data points for KDTree Construction.
+    /// \param storage How the data points are stored.
+    bool SetMatrixData(const Eigen::MatrixXd &data, DataStorage storage);
     /// Sets the data for the KDTree from geometry.
     ///
     /// \param geometry Geometry for KDTree Construction.
     bool SetGeometry(const Geometry &geometry);
+    /// Sets the data for the KDTree from geometry.
+    ///
+    /// \param geometry Geometry for KDTree Construction.
+    /// \param storage How the points of the geometry are stored.
+    bool SetGeometry(const Geometry &geometry, DataStorage storage);
     /// Sets the data for the KDTree from the feature data.
     ///
     /// \param feature Set of features for KDTree construction.
@@ -111,17 +145,85 @@ public:
                      std::vector<int> &indices,
                      std::vector<double> &distance2) const;
 
+    /// \brief Searches the neighbors of a batch of query points in parallel.
+    ///
+    /// The results are stored in CSR format: the neighbors of query i are
+    /// indices[offsets[i]] to indices[offsets[i + 1] - 1], and their squared
+    /// distances are stored at the same positions in \p distance2. Queries
+    /// for which the search fails have no neighbors.
+    ///
+    /// \param queries Query points, one per column.
+    /// \param param Search parameters, as for Search().
+    /// \param indices Flattened neighbor indices of all queries.
+    /// \param distance2 Flattened squared distances of all queries.
+    /// \param offsets Start of the neighbors of each query, of size
+    /// queries.cols() + 1.
+    /// \return False if the KDTree is empty or the dimension of the queries
+    /// does not match the data.
+    bool SearchBatch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                     const KDTreeSearchParam &param,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2,
+                     std::vector<int64_t> &offsets) const;
+
+    /// \brief Searches the neighbors of a batch of 3D query points in
+    /// parallel, see SearchBatch().
+    bool SearchBatch(const std::vector<Eigen::Vector3d> &queries,
+                     const KDTreeSearchParam &param,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2,
+                     std::vector<int64_t> &offsets) const;
+
+    /// \brief Searches the neighbors of a set of 3D query points one block of
+    /// queries at a time, which bounds the memory of the search results.
+    ///
+    /// After the search of each block, \p func(block_begin, block_end,
+    /// indices, distance2, offsets) is called with the SearchBatch() results
+    /// of queries block_begin to block_end - 1.
+    ///
+    /// \param queries Query points.
+    /// \param param Search parameters, as for Search().
+    /// \param func Function called with the results of each block.
+    /// \param block_size Number of queries searched at a time.
+    void SearchBatchBlocked(
+            const std::vector<Eigen::Vector3d> &queries,
+            const KDTreeSearchParam &param,
+            const std::function<void(int64_t,
+                                     int64_t,
+                                     const std::vector<int> &,
+                                     const std::vector<double> &,
+                                     const std::vector<int64_t> &)> &func,
+            int64_t block_size = 65536) const;
+
 private:
     /// \brief Sets the KDTree data from the data provided by the other methods.
     ///
     /// Internal method that sets all the members of KDTree by data provided by
     /// features, geometry, etc.
-    bool SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data);
+    bool SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data,
+                    DataStorage storage);
+
+    /// Searches the single precision index, see SearchKNN().
+    int SearchKNNFloat(const double *query,
+                       int knn,
+                       std::vector<int> &indices,
+                       std::vector<double> &distance2) const;
+
+    /// Searches the single precision index, see SearchRadius() and
+    /// SearchHybrid(). A negative \p max_nn returns all neighbors.
+    int SearchRadiusFloat(const double *query,
+                          double radius,
+                          int max_nn,
+                          std::vector<int> &indices,
+                          std::vector<double> &distance2) const;
 
 protected:
     std::vector<double> data_;
+    std::vector<float> data_float_;
     std::unique_ptr<flann::Matrix<double>> flann_dataset_;
     std::unique_ptr<flann::Index<flann::L2<double>>> flann_index_;
+    std::unique_ptr<flann::Matrix<float>> flann_dataset_float_;
+    std::unique_ptr<flann::Index<flann::L2<float>>> flann_index_float_;
     size_t dimension_ = 0;
     size_t dataset_size_ = 0;
 };
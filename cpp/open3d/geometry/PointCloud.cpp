@@ -28,6 +28,7 @@
 
 #include <Eigen/Dense>
 #include <numeric>
+#include <tbb/parallel_sort.h>
 
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/KDTreeFlann.h"
@@ -242,18 +243,9 @@ public:
     Eigen::Vector3d color_;
 };
 
-class point_cubic_id {
-public:
-    size_t point_id;
-    int cubic_id;
-};
-
 class AccumulatedPointForTrace : public AccumulatedPoint {
 public:
-    void AddPoint(const PointCloud &cloud,
-                  size_t index,
-                  int cubic_index,
-                  bool approximate_class) {
+    void AddPoint(const PointCloud &cloud, int index, bool approximate_class) {
         point_ += cloud.points_[index];
         if (cloud.HasNormals()) {
             if (!std::isnan(cloud.normals_[index](0)) &&
@@ -273,10 +265,6 @@ public:
                 color_ += cloud.colors_[index];
             }
         }
-        point_cubic_id new_id;
-        new_id.point_id = index;
-        new_id.cubic_id = cubic_index;
-        original_id.push_back(new_id);
         num_of_points_++;
     }
 
@@ -292,13 +280,55 @@ public:
         return Eigen::Vector3d(max_class, max_class, max_class);
     }
 
-    std::vector<point_cubic_id> GetOriginalID() { return original_id; }
-
 private:
-    // original point cloud id in higher resolution + its cubic id
-    std::vector<point_cubic_id> original_id;
     std::unordered_map<int, int> classes;
 };
+
+/// Groups the points by the voxel they fall into. The points of the i-th
+/// voxel are point_indices[voxel_offsets[i]] to
+/// point_indices[voxel_offsets[i + 1] - 1], in increasing order. Voxels are
+/// sorted by their (x, y, z) index, so the grouping does not depend on the
+/// number of threads.
+void GroupPointsByVoxel(const std::vector<Eigen::Vector3d> &points,
+                        const Eigen::Vector3d &voxel_min_bound,
+                        double voxel_size,
+                        std::vector<int> &point_indices,
+                        std::vector<int64_t> &voxel_offsets) {
+    struct VoxelPoint {
+        int voxel[3];
+        int index;
+
+        bool operator<(const VoxelPoint &other) const {
+            if (voxel[0] != other.voxel[0]) return voxel[0] < other.voxel[0];
+            if (voxel[1] != other.voxel[1]) return voxel[1] < other.voxel[1];
+            if (voxel[2] != other.voxel[2]) return voxel[2] < other.voxel[2];
+            return index < other.index;
+        }
+    };
+
+    const int num_points = int(points.size());
+    std::vector<VoxelPoint> voxel_points(num_points);
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < num_points; i++) {
+        Eigen::Vector3d ref_coord = (points[i] - voxel_min_bound) / voxel_size;
+        voxel_points[i] = {{int(floor(ref_coord(0))), int(floor(ref_coord(1))),
+                            int(floor(ref_coord(2)))},
+                           i};
+    }
+    tbb::parallel_sort(voxel_points.begin(), voxel_points.end());
+
+    point_indices.resize(num_points);
+    voxel_offsets.clear();
+    for (int i = 0; i < num_points; i++) {
+        point_indices[i] = voxel_points[i].index;
+        if (i == 0 ||
+            !std::equal(voxel_points[i].voxel, voxel_points[i].voxel + 3,
+                        voxel_points[i - 1].voxel)) {
+            voxel_offsets.push_back(i);
+        }
+    }
+    voxel_offsets.push_back(num_points);
+}
 }  // namespace
 
 std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
@@ -315,27 +345,33 @@ std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPoint,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
+    std::vector<int> point_indices;
+    std::vector<int64_t> voxel_offsets;
+    GroupPointsByVoxel(points_, voxel_min_bound, voxel_size, point_indices,
+                       voxel_offsets);
 
-    Eigen::Vector3d ref_coord;
-    Eigen::Vector3i voxel_index;
-    for (int i = 0; i < (int)points_.size(); i++) {
-        ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                int(floor(ref_coord(2)));
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i);
-    }
+    const int num_voxels = int(voxel_offsets.size()) - 1;
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
+    output->points_.resize(num_voxels);
+    if (has_normals) {
+        output->normals_.resize(num_voxels);
+    }
+    if (has_colors) {
+        output->colors_.resize(num_voxels);
+    }
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < num_voxels; i++) {
+        AccumulatedPoint accpoint;
+        for (int64_t k = voxel_offsets[i]; k < voxel_offsets[i + 1]; k++) {
+            accpoint.AddPoint(*this, point_indices[k]);
+        }
+        output->points_[i] = accpoint.GetAveragePoint();
         if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
+            output->normals_[i] = accpoint.GetAverageNormal();
         }
         if (has_colors) {
-            output->colors_.push_back(accpoint.second.GetAverageColor());
+            output->colors_[i] = accpoint.GetAverageColor();
         }
     }
     utility::LogDebug(
@@ -364,51 +400,55 @@ PointCloud::VoxelDownSampleAndTrace(double voxel_size,
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPointForTrace,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-    int cid_temp[3] = {1, 2, 4};
-    for (size_t i = 0; i < points_.size(); i++) {
-        auto ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        auto voxel_index = Eigen::Vector3i(int(floor(ref_coord(0))),
-                                           int(floor(ref_coord(1))),
-                                           int(floor(ref_coord(2))));
-        int cid = 0;
-        for (int c = 0; c < 3; c++) {
-            if ((ref_coord(c) - voxel_index(c)) >= 0.5) {
-                cid += cid_temp[c];
-            }
-        }
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i, cid,
-                                                     approximate_class);
-    }
+    std::vector<int> point_indices;
+    std::vector<int64_t> voxel_offsets;
+    GroupPointsByVoxel(points_, voxel_min_bound, voxel_size, point_indices,
+                       voxel_offsets);
+
+    const int num_voxels = int(voxel_offsets.size()) - 1;
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
-    int cnt = 0;
-    cubic_id.resize(voxelindex_to_accpoint.size(), 8);
+    output->points_.resize(num_voxels);
+    if (has_normals) {
+        output->normals_.resize(num_voxels);
+    }
+    if (has_colors) {
+        output->colors_.resize(num_voxels);
+    }
+    cubic_id.resize(num_voxels, 8);
     cubic_id.setConstant(-1);
-    std::vector<std::vector<int>> original_indices(
-            voxelindex_to_accpoint.size());
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
+    std::vector<std::vector<int>> original_indices(num_voxels);
+    int cid_temp[3] = {1, 2, 4};
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < num_voxels; i++) {
+        AccumulatedPointForTrace accpoint;
+        original_indices[i].assign(
+                point_indices.begin() + voxel_offsets[i],
+                point_indices.begin() + voxel_offsets[i + 1]);
+        for (int pid : original_indices[i]) {
+            accpoint.AddPoint(*this, pid, approximate_class);
+            // Index of the octant of the voxel the point falls into.
+            Eigen::Vector3d ref_coord =
+                    (points_[pid] - voxel_min_bound) / voxel_size;
+            int cid = 0;
+            for (int c = 0; c < 3; c++) {
+                if ((ref_coord(c) - int(floor(ref_coord(c)))) >= 0.5) {
+                    cid += cid_temp[c];
+                }
+            }
+            cubic_id(i, cid) = pid;
+        }
+        output->points_[i] = accpoint.GetAveragePoint();
         if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
+            output->normals_[i] = accpoint.GetAverageNormal();
         }
         if (has_colors) {
             if (approximate_class) {
-                output->colors_.push_back(accpoint.second.GetMaxClass());
+                output->colors_[i] = accpoint.GetMaxClass();
             } else {
-                output->colors_.push_back(accpoint.second.GetAverageColor());
+                output->colors_[i] = accpoint.GetAverageColor();
             }
         }
-        auto original_id = accpoint.second.GetOriginalID();
-        for (int i = 0; i < (int)original_id.size(); i++) {
-            size_t pid = original_id[i].point_id;
-            int cid = original_id[i].cubic_id;
-            cubic_id(cnt, cid) = int(pid);
-            original_indices[cnt].push_back(int(pid));
-        }
-        cnt++;
     }
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
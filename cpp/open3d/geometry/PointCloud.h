@@ -133,7 +133,8 @@ public:
     /// \brief Function to downsample input pointcloud into output pointcloud
     /// with a voxel.
     ///
-    /// Normals and colors are averaged if they exist.
+    /// Normals and colors are averaged if they exist. The output points are
+    /// sorted by the (x, y, z) index of their voxel.
     ///
     /// \param voxel_size Defines the resolution of the voxel grid,
     /// smaller value leads to denser output point cloud.
@@ -141,7 +142,9 @@ public:
 
     /// \brief Function to downsample using geometry.PointCloud.VoxelDownSample
     ///
-    /// Also records point cloud index before downsampling.
+    /// Also records point cloud index before downsampling. The output points
+    /// are sorted by the (x, y, z) index of their voxel, and the original
+    /// indices of each voxel are in increasing order.
     ///
     /// \param voxel_size Voxel size to downsample into.
     /// \param min_bound Minimum coordinate of voxel boundaries
@@ -25,7 +25,8 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
-#include <unordered_set>
+#include <algorithm>
+#include <atomic>
 
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
@@ -34,74 +35,146 @@
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+/// Lock-free disjoint set over point indices. Roots are always linked under
+/// the smaller index, so the root of a set is its smallest element and
+/// parent_[i] <= i holds at any time. This makes the concurrent Find safe to
+/// compress paths with plain atomic stores.
+class ConcurrentDisjointSet {
+public:
+    explicit ConcurrentDisjointSet(int size) : parent_(size) {
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < size; ++i) {
+            parent_[i].store(i, std::memory_order_relaxed);
+        }
+    }
+
+    int Find(int x) {
+        int parent = parent_[x].load(std::memory_order_relaxed);
+        while (parent != x) {
+            int grand_parent = parent_[parent].load(std::memory_order_relaxed);
+            // Path halving.
+            parent_[x].store(grand_parent, std::memory_order_relaxed);
+            x = parent;
+            parent = grand_parent;
+        }
+        return x;
+    }
+
+    void Union(int x, int y) {
+        while (true) {
+            x = Find(x);
+            y = Find(y);
+            if (x == y) {
+                return;
+            }
+            if (x < y) {
+                std::swap(x, y);
+            }
+            // Link the larger root x under y. Retry if x stopped being a root.
+            int expected = x;
+            if (parent_[x].compare_exchange_strong(expected, y)) {
+                return;
+            }
+        }
+    }
+
+private:
+    std::vector<std::atomic<int>> parent_;
+};
+
+}  // namespace
+
 std::vector<int> PointCloud::ClusterDBSCAN(double eps,
                                            size_t min_points,
                                            bool print_progress) const {
     KDTreeFlann kdtree(*this);
+    const int num_points = int(points_.size());
 
-    // precompute all neighbours
+    // Precompute all neighbours into a CSR layout, one block of points at a
+    // time.
     utility::LogDebug("Precompute Neighbours");
+    const int64_t block_size = 65536;
     utility::ConsoleProgressBar progress_bar(
-            points_.size(), "Precompute Neighbours", print_progress);
-    std::vector<std::vector<int>> nbs(points_.size());
-#pragma omp parallel for schedule(static)
-    for (int idx = 0; idx < int(points_.size()); ++idx) {
-        std::vector<double> dists2;
-        kdtree.SearchRadius(points_[idx], eps, nbs[idx], dists2);
-
-#pragma omp critical
-        { ++progress_bar; }
-    }
+            (num_points + block_size - 1) / block_size,
+            "Precompute Neighbours", print_progress);
+    std::vector<int> nbs;
+    std::vector<int64_t> nbs_offsets(1, 0);
+    nbs_offsets.reserve(num_points + 1);
+    kdtree.SearchBatchBlocked(
+            points_, KDTreeSearchParamRadius(eps),
+            [&](int64_t, int64_t, const std::vector<int> &block_nbs,
+                const std::vector<double> &,
+                const std::vector<int64_t> &block_offsets) {
+                const int64_t base = nbs_offsets.back();
+                for (size_t i = 1; i < block_offsets.size(); ++i) {
+                    nbs_offsets.push_back(base + block_offsets[i]);
+                }
+                nbs.insert(nbs.end(), block_nbs.begin(), block_nbs.end());
+                ++progress_bar;
+            },
+            block_size);
     utility::LogDebug("Done Precompute Neighbours");
 
-    // set all labels to undefined (-2)
+    auto is_core = [&nbs_offsets, min_points](int idx) {
+        return size_t(nbs_offsets[idx + 1] - nbs_offsets[idx]) >= min_points;
+    };
+
+    // Merge the core points of each density-connected component.
     utility::LogDebug("Compute Clusters");
-    progress_bar.reset(points_.size(), "Clustering", print_progress);
-    std::vector<int> labels(points_.size(), -2);
-    int cluster_label = 0;
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        if (labels[idx] != -2) {  // label is not undefined
+    progress_bar.reset(3, "Clustering", print_progress);
+    ConcurrentDisjointSet core_sets(num_points);
+    const int chunk_size = 4096;
+#pragma omp parallel for schedule(dynamic, chunk_size)
+    for (int idx = 0; idx < num_points; ++idx) {
+        if (!is_core(idx)) {
             continue;
         }
-
-        // check density
-        if (nbs[idx].size() < min_points) {
-            labels[idx] = -1;
-            continue;
+        for (int64_t k = nbs_offsets[idx]; k < nbs_offsets[idx + 1]; ++k) {
+            int nb = nbs[k];
+            if (nb < idx && is_core(nb)) {
+                core_sets.Union(idx, nb);
+            }
         }
+    }
+    ++progress_bar;
 
-        std::unordered_set<int> nbs_next(nbs[idx].begin(), nbs[idx].end());
-        std::unordered_set<int> nbs_visited;
-        nbs_visited.insert(int(idx));
-
-        labels[idx] = cluster_label;
-        ++progress_bar;
-        while (!nbs_next.empty()) {
-            int nb = *nbs_next.begin();
-            nbs_next.erase(nbs_next.begin());
-            nbs_visited.insert(nb);
+    // Each component is rooted at its smallest core point. Numbering the roots
+    // in index order reproduces the labels of a sequential DBSCAN that starts
+    // a new cluster at every unvisited core point.
+    std::vector<int> labels(num_points, -1);
+    int cluster_label = 0;
+    for (int idx = 0; idx < num_points; ++idx) {
+        if (is_core(idx) && core_sets.Find(idx) == idx) {
+            labels[idx] = cluster_label++;
+        }
+    }
+    ++progress_bar;
 
-            if (labels[nb] == -1) {  // noise label
-                labels[nb] = cluster_label;
-                ++progress_bar;
-            }
-            if (labels[nb] != -2) {  // not undefined label
-                continue;
-            }
-            labels[nb] = cluster_label;
-            ++progress_bar;
-
-            if (nbs[nb].size() >= min_points) {
-                for (int qnb : nbs[nb]) {
-                    if (nbs_visited.count(qnb) == 0) {
-                        nbs_next.insert(qnb);
-                    }
+    // Core points take the label of their root. Border points join the
+    // first cluster (i.e. the smallest label) among their core neighbours,
+    // all other points are noise.
+    std::vector<int> root_labels(labels);
+#pragma omp parallel for schedule(static)
+    for (int idx = 0; idx < num_points; ++idx) {
+        if (is_core(idx)) {
+            labels[idx] = root_labels[core_sets.Find(idx)];
+            continue;
+        }
+        int label = -1;
+        for (int64_t k = nbs_offsets[idx]; k < nbs_offsets[idx + 1]; ++k) {
+            int nb = nbs[k];
+            if (is_core(nb)) {
+                int nb_label = root_labels[core_sets.Find(nb)];
+                if (label == -1 || nb_label < label) {
+                    label = nb_label;
                 }
             }
         }
-
-        cluster_label++;
+        labels[idx] = label;
     }
+    ++progress_bar;
 
     utility::LogDebug("Done Compute Clusters: {:d}", cluster_label);
     return labels;
@@ -0,0 +1,297 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/file_format/ASCIIValueReader.h"
+
+#include <algorithm>
+#include <clocale>
+#include <cstdlib>
+#include <cstring>
+#ifdef __APPLE__
+#include <xlocale.h>
+#endif
+
+namespace open3d {
+namespace io {
+
+namespace {
+
+/// Number of bytes of lines parsed by one task.
+constexpr int64_t kBytesPerChunk = 16384;
+/// Bounds on how often ReadValues() reports its progress.
+constexpr int64_t kMaxProgressSteps = 100;
+constexpr int64_t kBytesPerProgressStep = 65536;
+/// Largest significand and power of ten for which the conversion of a decimal
+/// number with a single floating point operation is exact.
+constexpr uint64_t kMaxExactSignificand = uint64_t(1) << 53;
+constexpr int kMaxExactExponent = 22;
+/// Significand digits that fit in a uint64_t.
+constexpr int kMaxSignificandDigits = 19;
+
+inline bool IsSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+/// Converts the null terminated \p str with strtod() in the "C" locale, so that
+/// the decimal point is '.' whatever the global locale is.
+double StrToDoubleCLocale(const char *str, char **str_end) {
+#ifdef _WIN32
+    static const _locale_t c_locale = _create_locale(LC_ALL, "C");
+    return _strtod_l(str, str_end, c_locale);
+#else
+    static const locale_t c_locale = newlocale(LC_ALL_MASK, "C", locale_t(0));
+    return strtod_l(str, str_end, c_locale);
+#endif
+}
+
+/// Parses the number at the beginning of [begin, end) with strtod() from a
+/// null terminated copy. Returns the end of the number, or nullptr if there is
+/// no number.
+const char *ParseNumberSlow(const char *begin, const char *end, double &value) {
+    char buffer[128];
+    const size_t size = std::min(size_t(end - begin), sizeof(buffer) - 1);
+    std::memcpy(buffer, begin, size);
+    buffer[size] = '\0';
+    char *number_end;
+    value = StrToDoubleCLocale(buffer, &number_end);
+    if (number_end == buffer) {
+        return nullptr;
+    }
+    return begin + (number_end - buffer);
+}
+
+/// Parses the number at the beginning of [begin, end). Returns the end of the
+/// number, or nullptr if there is no number.
+///
+/// Decimal numbers with few significant digits and a small exponent, which is
+/// what point cloud exports contain, are converted exactly with a single
+/// floating point operation. The others are left to strtod() in the "C"
+/// locale.
+const char *ParseNumber(const char *begin, const char *end, double &value) {
+    static const double powers_of_ten[] = {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+            1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+            1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    const char *p = begin;
+    bool is_negative = false;
+    if (p != end && (*p == '-' || *p == '+')) {
+        is_negative = *p == '-';
+        ++p;
+    }
+    uint64_t significand = 0;
+    int num_digits = 0;
+    int exponent = 0;
+    bool has_digits = false;
+    for (; p != end && IsDigit(*p); ++p) {
+        if (num_digits == kMaxSignificandDigits) {
+            return ParseNumberSlow(begin, end, value);
+        }
+        significand = significand * 10 + uint64_t(*p - '0');
+        num_digits += significand != 0;
+        has_digits = true;
+    }
+    if (p != end && *p == '.') {
+        for (++p; p != end && IsDigit(*p); ++p) {
+            if (num_digits == kMaxSignificandDigits) {
+                return ParseNumberSlow(begin, end, value);
+            }
+            significand = significand * 10 + uint64_t(*p - '0');
+            num_digits += significand != 0;
+            exponent--;
+            has_digits = true;
+        }
+    }
+    // Infinities, NaNs and hexadecimal numbers.
+    if (!has_digits || (p != end && (*p == 'x' || *p == 'X'))) {
+        return ParseNumberSlow(begin, end, value);
+    }
+    if (p != end && (*p == 'e' || *p == 'E')) {
+        const char *q = p + 1;
+        bool is_exponent_negative = false;
+        if (q != end && (*q == '-' || *q == '+')) {
+            is_exponent_negative = *q == '-';
+            ++q;
+        }
+        // Without digits, the 'e' is not part of the number.
+        if (q != end && IsDigit(*q)) {
+            int number = 0;
+            for (; q != end && IsDigit(*q); ++q) {
+                number = std::min(number * 10 + (*q - '0'), 100000);
+            }
+            exponent += is_exponent_negative ? -number : number;
+            p = q;
+        }
+    }
+    if (significand == 0) {
+        value = is_negative ? -0.0 : 0.0;
+        return p;
+    }
+    if (significand > kMaxExactSignificand || exponent < -kMaxExactExponent ||
+        exponent > kMaxExactExponent) {
+        return ParseNumberSlow(begin, end, value);
+    }
+    double result = double(significand);
+    if (exponent < 0) {
+        result /= powers_of_ten[-exponent];
+    } else {
+        result *= powers_of_ten[exponent];
+    }
+    value = is_negative ? -result : result;
+    return p;
+}
+
+/// Parses the first num_values numbers of the line [begin, end) into values.
+/// Returns false if the line does not start with num_values numbers.
+bool ParseValues(const char *begin,
+                 const char *end,
+                 int num_values,
+                 double *values) {
+    const char *p = begin;
+    for (int i = 0; i < num_values; ++i) {
+        while (p != end && IsSpace(*p)) {
+            ++p;
+        }
+        if (p == end || (p = ParseNumber(p, end, values[i])) == nullptr) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Appends the rows of the lines in [begin, end) to values.
+void ParseLines(const char *begin,
+                const char *end,
+                int num_values,
+                std::vector<double> &values) {
+    std::vector<double> row(num_values);
+    while (begin < end) {
+        const char *line_end = static_cast<const char *>(
+                std::memchr(begin, '\n', size_t(end - begin)));
+        if (line_end == nullptr) {
+            line_end = end;
+        }
+        if (ParseValues(begin, line_end, num_values, row.data())) {
+            values.insert(values.end(), row.begin(), row.end());
+        }
+        begin = line_end + 1;
+    }
+}
+
+}  // namespace
+
+bool ASCIIValueReader::Open(const std::string &filename) {
+    return file_.Open(filename);
+}
+
+bool ASCIIValueReader::ParseLine(const char *line,
+                                 int num_values,
+                                 double *values) {
+    return ParseValues(line, line + std::strlen(line), num_values, values);
+}
+
+std::string ASCIIValueReader::ReadLine(int64_t &pos) const {
+    const char *data = file_.GetData();
+    const int64_t size = file_.GetFileSize();
+    if (data == nullptr || pos < 0 || pos >= size) {
+        pos = size;
+        return std::string();
+    }
+    const char *line_begin = data + pos;
+    const char *line_end = static_cast<const char *>(
+            std::memchr(line_begin, '\n', size_t(size - pos)));
+    if (line_end == nullptr) {
+        line_end = data + size;
+    }
+    pos = std::min(size, int64_t(line_end - data) + 1);
+    if (line_end != line_begin && *(line_end - 1) == '\r') {
+        --line_end;
+    }
+    return std::string(line_begin, line_end);
+}
+
+std::vector<double> ASCIIValueReader::ReadValues(
+        int num_values,
+        int64_t begin,
+        const std::function<void(int64_t)> &update_progress) const {
+    const char *data = file_.GetData();
+    const int64_t size = file_.GetFileSize();
+    if (data == nullptr || num_values <= 0 || begin < 0 || begin >= size) {
+        return std::vector<double>();
+    }
+
+    // Split the lines into chunks of about kBytesPerChunk bytes, each of them
+    // but the last ending with a line break.
+    std::vector<int64_t> chunk_begins(1, begin);
+    while (chunk_begins.back() + kBytesPerChunk < size) {
+        const int64_t pos = chunk_begins.back() + kBytesPerChunk;
+        const char *line_end = static_cast<const char *>(
+                std::memchr(data + pos, '\n', size_t(size - pos)));
+        if (line_end == nullptr || line_end + 1 == data + size) {
+            break;
+        }
+        chunk_begins.push_back(int64_t(line_end - data) + 1);
+    }
+    chunk_begins.push_back(size);
+    const int64_t num_chunks = int64_t(chunk_begins.size()) - 1;
+
+    // The chunks are parsed in up to kMaxProgressSteps serial steps of at
+    // least kBytesPerProgressStep bytes, each split into parallel tasks.
+    std::vector<std::vector<double>> chunk_values(num_chunks);
+    const int64_t num_steps = std::min(
+            kMaxProgressSteps,
+            (size - begin + kBytesPerProgressStep - 1) / kBytesPerProgressStep);
+    for (int64_t step = 0; step < num_steps; ++step) {
+        const int64_t step_begin = num_chunks * step / num_steps;
+        const int64_t step_end = num_chunks * (step + 1) / num_steps;
+#pragma omp parallel for schedule(dynamic)
+        for (int64_t chunk = step_begin; chunk < step_end; ++chunk) {
+            ParseLines(data + chunk_begins[chunk],
+                       data + chunk_begins[chunk + 1], num_values,
+                       chunk_values[chunk]);
+        }
+        if (update_progress) {
+            update_progress(chunk_begins[step_end]);
+        }
+    }
+
+    std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
+    for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+        chunk_offsets[chunk + 1] =
+                chunk_offsets[chunk] + int64_t(chunk_values[chunk].size());
+    }
+    std::vector<double> values(chunk_offsets.back());
+#pragma omp parallel for schedule(static)
+    for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+        std::copy(chunk_values[chunk].begin(), chunk_values[chunk].end(),
+                  values.begin() + chunk_offsets[chunk]);
+    }
+    return values;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,86 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace io {
+
+/// \class ASCIIValueReader
+///
+/// \brief Bulk reader for text files holding one point per line, such as XYZ,
+/// XYZN, XYZRGB, XYZI and PTS files.
+///
+/// The file is memory mapped and split on line boundaries into chunks, which
+/// are parsed in parallel with a locale independent number parser directly
+/// into contiguous storage, instead of going through fgets() and sscanf() line
+/// by line.
+class ASCIIValueReader {
+public:
+    /// Maps the file for reading.
+    bool Open(const std::string &filename);
+
+    /// Returns the last encountered error for this file.
+    std::string GetError() { return file_.GetError(); }
+
+    /// Returns the file size in bytes.
+    int64_t GetFileSize() const { return file_.GetFileSize(); }
+
+    /// Returns the line starting at byte offset pos, without the line break,
+    /// and moves pos to the beginning of the next line.
+    std::string ReadLine(int64_t &pos) const;
+
+    /// Parses the lines from byte offset begin to the end of the file. Every
+    /// line starting with num_values whitespace separated numbers gives one
+    /// row of num_values values, further values on the line are ignored.
+    /// Other lines are skipped, as sscanf() based parsing would.
+    /// \param update_progress Called from the calling thread with the byte
+    /// offset in the file up to which the lines have been parsed.
+    std::vector<double> ReadValues(
+            int num_values,
+            int64_t begin = 0,
+            const std::function<void(int64_t)> &update_progress =
+                    nullptr) const;
+
+    /// Parses the first num_values numbers of the null terminated line into
+    /// values, with the parser of ReadValues(), for readers that go through the
+    /// file line by line. Returns false if the line does not start with
+    /// num_values numbers.
+    static bool ParseLine(const char *line, int num_values, double *values);
+
+private:
+    utility::filesystem::MappedFile file_;
+};
+
+}  // namespace io
+}  // namespace open3d
@@ -26,12 +26,14 @@
 
 #include <liblzf/lzf.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
 #include <sstream>
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/file_format/PCDHeader.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -47,40 +49,6 @@ namespace open3d {
 namespace {
 using namespace io;
 
-enum PCDDataType {
-    PCD_DATA_ASCII = 0,
-    PCD_DATA_BINARY = 1,
-    PCD_DATA_BINARY_COMPRESSED = 2
-};
-
-struct PCLPointField {
-public:
-    std::string name;
-    int size;
-    char type;
-    int count;
-    // helper variable
-    int count_offset;
-    int offset;
-};
-
-struct PCDHeader {
-public:
-    std::string version;
-    std::vector<PCLPointField> fields;
-    int width;
-    int height;
-    int points;
-    PCDDataType datatype;
-    std::string viewpoint;
-    // helper variables
-    int elementnum;
-    int pointsize;
-    bool has_points;
-    bool has_normals;
-    bool has_colors;
-};
-
 bool CheckHeader(PCDHeader &header) {
     if (header.points <= 0 || header.pointsize <= 0) {
         utility::LogWarning("[CheckHeader] PCD has no data.");
@@ -131,112 +99,6 @@ bool CheckHeader(PCDHeader &header) {
     return true;
 }
 
-bool ReadPCDHeader(FILE *file, PCDHeader &header) {
-    char line_buffer[DEFAULT_IO_BUFFER_SIZE];
-    size_t specified_channel_count = 0;
-
-    while (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
-        std::string line(line_buffer);
-        if (line == "") {
-            continue;
-        }
-        std::vector<std::string> st;
-        utility::SplitString(st, line, "\t\r\n ");
-        std::stringstream sstream(line);
-        sstream.imbue(std::locale::classic());
-        std::string line_type;
-        sstream >> line_type;
-        if (line_type.substr(0, 1) == "#") {
-        } else if (line_type.substr(0, 7) == "VERSION") {
-            if (st.size() >= 2) {
-                header.version = st[1];
-            }
-        } else if (line_type.substr(0, 6) == "FIELDS" ||
-                   line_type.substr(0, 7) == "COLUMNS") {
-            specified_channel_count = st.size() - 1;
-            if (specified_channel_count == 0) {
-                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
-                return false;
-            }
-            header.fields.resize(specified_channel_count);
-            int count_offset = 0, offset = 0;
-            for (size_t i = 0; i < specified_channel_count;
-                 i++, count_offset += 1, offset += 4) {
-                header.fields[i].name = st[i + 1];
-                header.fields[i].size = 4;
-                header.fields[i].type = 'F';
-                header.fields[i].count = 1;
-                header.fields[i].count_offset = count_offset;
-                header.fields[i].offset = offset;
-            }
-            header.elementnum = count_offset;
-            header.pointsize = offset;
-        } else if (line_type.substr(0, 4) == "SIZE") {
-            if (specified_channel_count != st.size() - 1) {
-                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
-                return false;
-            }
-            int offset = 0, col_type = 0;
-            for (size_t i = 0; i < specified_channel_count;
-                 i++, offset += col_type) {
-                sstream >> col_type;
-                header.fields[i].size = col_type;
-                header.fields[i].offset = offset;
-            }
-            header.pointsize = offset;
-        } else if (line_type.substr(0, 4) == "TYPE") {
-            if (specified_channel_count != st.size() - 1) {
-                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
-                return false;
-            }
-            for (size_t i = 0; i < specified_channel_count; i++) {
-                header.fields[i].type = st[i + 1].c_str()[0];
-            }
-        } else if (line_type.substr(0, 5) == "COUNT") {
-            if (specified_channel_count != st.size() - 1) {
-                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
-                return false;
-            }
-            int count_offset = 0, offset = 0, col_count = 0;
-            for (size_t i = 0; i < specified_channel_count; i++) {
-                sstream >> col_count;
-                header.fields[i].count = col_count;
-                header.fields[i].count_offset = count_offset;
-                header.fields[i].offset = offset;
-                count_offset += col_count;
-                offset += col_count * header.fields[i].size;
-            }
-            header.elementnum = count_offset;
-            header.pointsize = offset;
-        } else if (line_type.substr(0, 5) == "WIDTH") {
-            sstream >> header.width;
-        } else if (line_type.substr(0, 6) == "HEIGHT") {
-            sstream >> header.height;
-            header.points = header.width * header.height;
-        } else if (line_type.substr(0, 9) == "VIEWPOINT") {
-            if (st.size() >= 2) {
-                header.viewpoint = st[1];
-            }
-        } else if (line_type.substr(0, 6) == "POINTS") {
-            sstream >> header.points;
-        } else if (line_type.substr(0, 4) == "DATA") {
-            header.datatype = PCD_DATA_ASCII;
-            if (st.size() >= 2) {
-                if (st[1].substr(0, 17) == "binary_compressed") {
-                    header.datatype = PCD_DATA_BINARY_COMPRESSED;
-                } else if (st[1].substr(0, 6) == "binary") {
-                    header.datatype = PCD_DATA_BINARY;
-                }
-            }
-            break;
-        }
-    }
-    if (!CheckHeader(header)) {
-        return false;
-    }
-    return true;
-}
-
 double UnpackBinaryPCDElement(const char *data_ptr,
                               const char type,
                               const int size) {
@@ -333,6 +195,25 @@ Eigen::Vector3d UnpackASCIIPCDColor(const char *data_ptr,
     }
 }
 
+/// Calls func(i) for i in [0, num_points) in parallel. This is done in up to
+/// 100 steps of at least 1000 points, after each of which the progress is
+/// reported.
+template <typename Func>
+void ParallelForInSteps(int num_points,
+                        utility::CountingProgressReporter &reporter,
+                        const Func &func) {
+    const int num_steps = std::min(100, (num_points + 999) / 1000);
+    for (int step = 0; step < num_steps; step++) {
+        const int begin = int(int64_t(num_points) * step / num_steps);
+        const int end = int(int64_t(num_points) * (step + 1) / num_steps);
+#pragma omp parallel for schedule(static)
+        for (int i = begin; i < end; i++) {
+            func(i);
+        }
+        reporter.Update(end);
+    }
+}
+
 bool ReadPCDData(FILE *file,
                  const PCDHeader &header,
                  geometry::PointCloud &pointcloud,
@@ -403,49 +284,48 @@ bool ReadPCDData(FILE *file,
             }
         }
     } else if (header.datatype == PCD_DATA_BINARY) {
-        std::unique_ptr<char[]> buffer(new char[header.pointsize]);
-        for (int i = 0; i < header.points; i++) {
-            if (fread(buffer.get(), header.pointsize, 1, file) != 1) {
-                utility::LogWarning(
-                        "[ReadPCDData] Failed to read data record.");
-                pointcloud.Clear();
-                return false;
-            }
+        // All records are read at once and unpacked in parallel.
+        const size_t data_size = size_t(header.points) * header.pointsize;
+        std::unique_ptr<char[]> data(new char[data_size]);
+        if (fread(data.get(), 1, data_size, file) != data_size) {
+            utility::LogWarning("[ReadPCDData] Failed to read data record.");
+            pointcloud.Clear();
+            return false;
+        }
+        ParallelForInSteps(header.points, reporter, [&](int i) {
+            const char *record = data.get() + size_t(i) * header.pointsize;
             for (const auto &field : header.fields) {
                 if (field.name == "x") {
                     pointcloud.points_[i](0) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
+                            UnpackBinaryPCDElement(record + field.offset,
                                                    field.type, field.size);
                 } else if (field.name == "y") {
                     pointcloud.points_[i](1) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
+                            UnpackBinaryPCDElement(record + field.offset,
                                                    field.type, field.size);
                 } else if (field.name == "z") {
                     pointcloud.points_[i](2) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
+                            UnpackBinaryPCDElement(record + field.offset,
                                                    field.type, field.size);
                 } else if (field.name == "normal_x") {
                     pointcloud.normals_[i](0) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
+                            UnpackBinaryPCDElement(record + field.offset,
                                                    field.type, field.size);
                 } else if (field.name == "normal_y") {
                     pointcloud.normals_[i](1) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
+                            UnpackBinaryPCDElement(record + field.offset,
                                                    field.type, field.size);
                 } else if (field.name == "normal_z") {
                     pointcloud.normals_[i](2) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
+                            UnpackBinaryPCDElement(record + field.offset,
                                                    field.type, field.size);
                 } else if (field.name == "rgb" || field.name == "rgba") {
                     pointcloud.colors_[i] =
-                            UnpackBinaryPCDColor(buffer.get() + field.offset,
+                            UnpackBinaryPCDColor(record + field.offset,
                                                  field.type, field.size);
                 }
             }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
-        }
+        });
     } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
         double reporter_total = 100.0;
         reporter.SetTotal(int(reporter_total));
@@ -491,42 +371,49 @@ bool ReadPCDData(FILE *file,
                     double(base_ptr - buffer.get()) / uncompressed_size;
             reporter.Update(int(reporter_total * (progress + .2)));
             if (field.name == "x") {
+#pragma omp parallel for schedule(static)
                 for (int i = 0; i < header.points; i++) {
                     pointcloud.points_[i](0) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
                 }
             } else if (field.name == "y") {
+#pragma omp parallel for schedule(static)
                 for (int i = 0; i < header.points; i++) {
                     pointcloud.points_[i](1) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
                 }
             } else if (field.name == "z") {
+#pragma omp parallel for schedule(static)
                 for (int i = 0; i < header.points; i++) {
                     pointcloud.points_[i](2) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
                 }
             } else if (field.name == "normal_x") {
+#pragma omp parallel for schedule(static)
                 for (int i = 0; i < header.points; i++) {
                     pointcloud.normals_[i](0) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
                 }
             } else if (field.name == "normal_y") {
+#pragma omp parallel for schedule(static)
                 for (int i = 0; i < header.points; i++) {
                     pointcloud.normals_[i](1) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
                 }
             } else if (field.name == "normal_z") {
+#pragma omp parallel for schedule(static)
                 for (int i = 0; i < header.points; i++) {
                     pointcloud.normals_[i](2) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
                 }
             } else if (field.name == "rgb" || field.name == "rgba") {
+#pragma omp parallel for schedule(static)
                 for (int i = 0; i < header.points; i++) {
                     pointcloud.colors_[i] = UnpackBinaryPCDColor(
                             base_ptr + i * field.size * field.count, field.type,
@@ -591,50 +478,6 @@ bool GenerateHeader(const geometry::PointCloud &pointcloud,
     return true;
 }
 
-bool WritePCDHeader(FILE *file, const PCDHeader &header) {
-    fprintf(file, "# .PCD v%s - Point Cloud Data file format\n",
-            header.version.c_str());
-    fprintf(file, "VERSION %s\n", header.version.c_str());
-    fprintf(file, "FIELDS");
-    for (const auto &field : header.fields) {
-        fprintf(file, " %s", field.name.c_str());
-    }
-    fprintf(file, "\n");
-    fprintf(file, "SIZE");
-    for (const auto &field : header.fields) {
-        fprintf(file, " %d", field.size);
-    }
-    fprintf(file, "\n");
-    fprintf(file, "TYPE");
-    for (const auto &field : header.fields) {
-        fprintf(file, " %c", field.type);
-    }
-    fprintf(file, "\n");
-    fprintf(file, "COUNT");
-    for (const auto &field : header.fields) {
-        fprintf(file, " %d", field.count);
-    }
-    fprintf(file, "\n");
-    fprintf(file, "WIDTH %d\n", header.width);
-    fprintf(file, "HEIGHT %d\n", header.height);
-    fprintf(file, "VIEWPOINT 0 0 0 1 0 0 0\n");
-    fprintf(file, "POINTS %d\n", header.points);
-
-    switch (header.datatype) {
-        case PCD_DATA_BINARY:
-            fprintf(file, "DATA binary\n");
-            break;
-        case PCD_DATA_BINARY_COMPRESSED:
-            fprintf(file, "DATA binary_compressed\n");
-            break;
-        case PCD_DATA_ASCII:
-        default:
-            fprintf(file, "DATA ascii\n");
-            break;
-    }
-    return true;
-}
-
 float ConvertRGBToFloat(const Eigen::Vector3d &color) {
     auto rgb = utility::ColorToUint8(color);
     std::uint8_t rgba[4] = {rgb(2), rgb(1), rgb(0), 0};
@@ -670,29 +513,29 @@ bool WritePCDData(FILE *file,
             }
         }
     } else if (header.datatype == PCD_DATA_BINARY) {
-        std::unique_ptr<float[]> data(new float[header.elementnum]);
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+        const size_t elementnum = size_t(header.elementnum);
+        std::unique_ptr<float[]> data(
+                new float[elementnum * pointcloud.points_.size()]);
+        ParallelForInSteps(header.points, reporter, [&](int i) {
+            float *record = data.get() + elementnum * i;
             const auto &point = pointcloud.points_[i];
-            data[0] = (float)point(0);
-            data[1] = (float)point(1);
-            data[2] = (float)point(2);
+            record[0] = (float)point(0);
+            record[1] = (float)point(1);
+            record[2] = (float)point(2);
             int idx = 3;
             if (has_normal) {
                 const auto &normal = pointcloud.normals_[i];
-                data[idx + 0] = (float)normal(0);
-                data[idx + 1] = (float)normal(1);
-                data[idx + 2] = (float)normal(2);
+                record[idx + 0] = (float)normal(0);
+                record[idx + 1] = (float)normal(1);
+                record[idx + 2] = (float)normal(2);
                 idx += 3;
             }
             if (has_color) {
                 const auto &color = pointcloud.colors_[i];
-                data[idx] = ConvertRGBToFloat(color);
+                record[idx] = ConvertRGBToFloat(color);
             }
-            fwrite(data.get(), sizeof(float), header.elementnum, file);
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
-        }
+        });
+        fwrite(data.get(), sizeof(float), elementnum * header.points, file);
     } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
         double report_total = double(pointcloud.points_.size() * 2);
         // 0%-50% packing into buffer
@@ -704,7 +547,7 @@ bool WritePCDData(FILE *file,
                 (std::uint32_t)(header.elementnum * header.points);
         std::unique_ptr<float[]> buffer(new float[buffer_size]);
         std::unique_ptr<float[]> buffer_compressed(new float[buffer_size * 2]);
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+        ParallelForInSteps(header.points, reporter, [&](int i) {
             const auto &point = pointcloud.points_[i];
             buffer[0 * strip_size + i] = (float)point(0);
             buffer[1 * strip_size + i] = (float)point(1);
@@ -721,10 +564,7 @@ bool WritePCDData(FILE *file,
                 const auto &color = pointcloud.colors_[i];
                 buffer[idx * strip_size + i] = ConvertRGBToFloat(color);
             }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
-        }
+        });
         std::uint32_t buffer_size_in_bytes = buffer_size * sizeof(float);
         std::uint32_t size_compressed =
                 lzf_compress(buffer.get(), buffer_size_in_bytes,
@@ -762,7 +602,7 @@ bool ReadPointCloudFromPCD(const std::string &filename,
                             filename);
         return false;
     }
-    if (!ReadPCDHeader(file, header)) {
+    if (!ReadPCDHeader(file, header) || !CheckHeader(header)) {
         utility::LogWarning("Read PCD failed: unable to parse header.");
         fclose(file);
         return false;
@@ -31,6 +31,7 @@
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/io/TriangleMeshIO.h"
 #include "open3d/io/VoxelGridIO.h"
+#include "open3d/io/file_format/PLYBinaryReader.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/ProgressReporters.h"
 
@@ -109,6 +110,70 @@ int ReadColorCallback(p_ply_argument argument) {
     return 1;
 }
 
+/// Reads the vertices through PLYBinaryReader. Returns false if the file is
+/// not covered by it or has only some of the x, y, z, normal or color
+/// properties, so that rply reads it as before.
+bool ReadVerticesInBulk(const std::string &filename,
+                        geometry::PointCloud &pointcloud,
+                        const ReadPointCloudOption &params) {
+    PLYBinaryReader reader;
+    if (!reader.Open(filename)) {
+        return false;
+    }
+    // Finds either all or none of the given properties.
+    auto find_properties = [&reader](const std::vector<std::string> &names,
+                                     std::vector<int> &indices) {
+        indices.clear();
+        for (const std::string &name : names) {
+            int index = reader.FindProperty(name);
+            if (index >= 0) {
+                indices.push_back(index);
+            }
+        }
+        return indices.empty() || indices.size() == names.size();
+    };
+    std::vector<int> point_indices, normal_indices, color_indices;
+    if (!find_properties({"x", "y", "z"}, point_indices) ||
+        point_indices.empty() ||
+        !find_properties({"nx", "ny", "nz"}, normal_indices) ||
+        !find_properties({"red", "green", "blue"}, color_indices)) {
+        return false;
+    }
+
+    const int64_t num_vertices = reader.GetNumVertices();
+    const int64_t num_reads = 1 + int64_t(!normal_indices.empty()) +
+                              int64_t(!color_indices.empty());
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(num_vertices * num_reads);
+    int64_t num_read = 0;
+    auto update_progress = [&](int64_t count) {
+        reporter.Update(num_read + count);
+    };
+
+    pointcloud.Clear();
+    pointcloud.points_.resize(num_vertices);
+    reader.ReadProperties(point_indices, pointcloud.points_[0].data(),
+                          update_progress);
+    num_read += num_vertices;
+    if (!normal_indices.empty()) {
+        pointcloud.normals_.resize(num_vertices);
+        reader.ReadProperties(normal_indices, pointcloud.normals_[0].data(),
+                              update_progress);
+        num_read += num_vertices;
+    }
+    if (!color_indices.empty()) {
+        pointcloud.colors_.resize(num_vertices);
+        reader.ReadProperties(color_indices, pointcloud.colors_[0].data(),
+                              update_progress);
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < num_vertices; i++) {
+            pointcloud.colors_[i] /= 255.0;
+        }
+    }
+    reporter.Finish();
+    return true;
+}
+
 }  // namespace ply_pointcloud_reader
 
 namespace ply_trianglemesh_reader {
@@ -398,6 +463,10 @@ bool ReadPointCloudFromPLY(const std::string &filename,
                            const ReadPointCloudOption &params) {
     using namespace ply_pointcloud_reader;
 
+    if (ReadVerticesInBulk(filename, pointcloud, params)) {
+        return true;
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}",
@@ -24,10 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cstdio>
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/file_format/ASCIIValueReader.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -44,59 +46,54 @@ bool ReadPointCloudFromPTS(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        ASCIIValueReader reader;
+        if (!reader.Open(filename)) {
             utility::LogWarning("Read PTS failed: unable to open file: {}",
                                 filename);
             return false;
         }
         size_t num_of_pts = 0;
-        int num_of_fields = 0;
-        const char *line_buffer;
-        if ((line_buffer = file.ReadLine())) {
-            sscanf(line_buffer, "%zu", &num_of_pts);
+        int64_t pos = 0;
+        if (pos < reader.GetFileSize()) {
+            sscanf(reader.ReadLine(pos).c_str(), "%zu", &num_of_pts);
         }
         if (num_of_pts <= 0) {
             utility::LogWarning("Read PTS failed: unable to read header.");
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(num_of_pts);
+        reporter.SetTotal(reader.GetFileSize());
 
         pointcloud.Clear();
-        size_t idx = 0;
-        while (idx < num_of_pts && (line_buffer = file.ReadLine())) {
-            if (num_of_fields == 0) {
-                std::vector<std::string> st;
-                utility::SplitString(st, line_buffer, " ");
-                num_of_fields = (int)st.size();
-                if (num_of_fields < 3) {
-                    utility::LogWarning(
-                            "Read PTS failed: insufficient data fields.");
-                    return false;
-                }
-                pointcloud.points_.resize(num_of_pts);
-                if (num_of_fields >= 7) {
-                    // X Y Z I R G B
-                    pointcloud.colors_.resize(num_of_pts);
-                }
+        if (pos < reader.GetFileSize()) {
+            // The first point decides between X Y Z and X Y Z I R G B.
+            int64_t first_point_pos = pos;
+            std::vector<std::string> st;
+            utility::SplitString(st, reader.ReadLine(first_point_pos), " ");
+            const int num_of_fields = (int)st.size();
+            if (num_of_fields < 3) {
+                utility::LogWarning(
+                        "Read PTS failed: insufficient data fields.");
+                return false;
             }
-            double x, y, z;
-            int i, r, g, b;
-            if (num_of_fields < 7) {
-                if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                    pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                }
-            } else {
-                if (sscanf(line_buffer, "%lf %lf %lf %d %d %d %d", &x, &y, &z,
-                           &i, &r, &g, &b) == 7) {
-                    pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                    pointcloud.colors_[idx] = utility::ColorToDouble(r, g, b);
-                }
+            const int num_values = num_of_fields >= 7 ? 7 : 3;
+            const std::vector<double> values = reader.ReadValues(
+                    num_values, pos,
+                    [&](int64_t offset) { reporter.Update(offset); });
+            const int64_t num_points = std::min(
+                    int64_t(values.size()) / num_values, int64_t(num_of_pts));
+            pointcloud.points_.resize(num_points);
+            if (num_values == 7) {
+                pointcloud.colors_.resize(num_points);
             }
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
+#pragma omp parallel for schedule(static)
+            for (int64_t i = 0; i < num_points; i++) {
+                const double *row = values.data() + num_values * i;
+                pointcloud.points_[i] = Eigen::Vector3d(row[0], row[1], row[2]);
+                if (num_values == 7) {
+                    pointcloud.colors_[i] = utility::ColorToDouble(
+                            int(row[4]), int(row[5]), int(row[6]));
+                }
             }
         }
         reporter.Finish();
@@ -0,0 +1,194 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/file_format/PCDHeader.h"
+
+#include <locale>
+#include <sstream>
+
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Helper.h"
+
+// References for PCD file IO
+// http://pointclouds.org/documentation/tutorials/pcd_file_format.html
+// https://github.com/PointCloudLibrary/pcl/blob/master/io/src/pcd_io.cpp
+
+namespace open3d {
+namespace io {
+
+bool ReadPCDHeader(FILE *file, PCDHeader &header) {
+    char line_buffer[DEFAULT_IO_BUFFER_SIZE];
+    size_t specified_channel_count = 0;
+
+    while (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
+        std::string line(line_buffer);
+        if (line == "") {
+            continue;
+        }
+        std::vector<std::string> st;
+        utility::SplitString(st, line, "\t\r\n ");
+        std::stringstream sstream(line);
+        sstream.imbue(std::locale::classic());
+        std::string line_type;
+        sstream >> line_type;
+        if (line_type.substr(0, 1) == "#") {
+        } else if (line_type.substr(0, 7) == "VERSION") {
+            if (st.size() >= 2) {
+                header.version = st[1];
+            }
+        } else if (line_type.substr(0, 6) == "FIELDS" ||
+                   line_type.substr(0, 7) == "COLUMNS") {
+            specified_channel_count = st.size() - 1;
+            if (specified_channel_count == 0) {
+                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+                return false;
+            }
+            header.fields.resize(specified_channel_count);
+            int count_offset = 0, offset = 0;
+            for (size_t i = 0; i < specified_channel_count;
+                 i++, count_offset += 1, offset += 4) {
+                header.fields[i].name = st[i + 1];
+                header.fields[i].size = 4;
+                header.fields[i].type = 'F';
+                header.fields[i].count = 1;
+                header.fields[i].count_offset = count_offset;
+                header.fields[i].offset = offset;
+            }
+            header.elementnum = count_offset;
+            header.pointsize = offset;
+        } else if (line_type.substr(0, 4) == "SIZE") {
+            if (specified_channel_count != st.size() - 1) {
+                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+                return false;
+            }
+            int offset = 0, col_type = 0;
+            for (size_t i = 0; i < specified_channel_count;
+                 i++, offset += col_type) {
+                sstream >> col_type;
+                header.fields[i].size = col_type;
+                header.fields[i].offset = offset;
+            }
+            header.pointsize = offset;
+        } else if (line_type.substr(0, 4) == "TYPE") {
+            if (specified_channel_count != st.size() - 1) {
+                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+                return false;
+            }
+            for (size_t i = 0; i < specified_channel_count; i++) {
+                header.fields[i].type = st[i + 1].c_str()[0];
+            }
+        } else if (line_type.substr(0, 5) == "COUNT") {
+            if (specified_channel_count != st.size() - 1) {
+                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+                return false;
+            }
+            int count_offset = 0, offset = 0, col_count = 0;
+            for (size_t i = 0; i < specified_channel_count; i++) {
+                sstream >> col_count;
+                header.fields[i].count = col_count;
+                header.fields[i].count_offset = count_offset;
+                header.fields[i].offset = offset;
+                count_offset += col_count;
+                offset += col_count * header.fields[i].size;
+            }
+            header.elementnum = count_offset;
+            header.pointsize = offset;
+        } else if (line_type.substr(0, 5) == "WIDTH") {
+            sstream >> header.width;
+        } else if (line_type.substr(0, 6) == "HEIGHT") {
+            sstream >> header.height;
+            header.points = header.width * header.height;
+        } else if (line_type.substr(0, 9) == "VIEWPOINT") {
+            if (st.size() >= 2) {
+                header.viewpoint = st[1];
+            }
+        } else if (line_type.substr(0, 6) == "POINTS") {
+            sstream >> header.points;
+        } else if (line_type.substr(0, 4) == "DATA") {
+            header.datatype = PCD_DATA_ASCII;
+            if (st.size() >= 2) {
+                if (st[1].substr(0, 17) == "binary_compressed") {
+                    header.datatype = PCD_DATA_BINARY_COMPRESSED;
+                } else if (st[1].substr(0, 6) == "binary") {
+                    header.datatype = PCD_DATA_BINARY;
+                }
+            }
+            break;
+        }
+    }
+    if (header.points <= 0 || header.pointsize <= 0 || header.fields.empty()) {
+        utility::LogWarning("[ReadPCDHeader] PCD has no data.");
+        return false;
+    }
+    return true;
+}
+
+bool WritePCDHeader(FILE *file, const PCDHeader &header, int count_width) {
+    fprintf(file, "# .PCD v%s - Point Cloud Data file format\n",
+            header.version.c_str());
+    fprintf(file, "VERSION %s\n", header.version.c_str());
+    fprintf(file, "FIELDS");
+    for (const auto &field : header.fields) {
+        fprintf(file, " %s", field.name.c_str());
+    }
+    fprintf(file, "\n");
+    fprintf(file, "SIZE");
+    for (const auto &field : header.fields) {
+        fprintf(file, " %d", field.size);
+    }
+    fprintf(file, "\n");
+    fprintf(file, "TYPE");
+    for (const auto &field : header.fields) {
+        fprintf(file, " %c", field.type);
+    }
+    fprintf(file, "\n");
+    fprintf(file, "COUNT");
+    for (const auto &field : header.fields) {
+        fprintf(file, " %d", field.count);
+    }
+    fprintf(file, "\n");
+    fprintf(file, "WIDTH %0*d\n", count_width, header.width);
+    fprintf(file, "HEIGHT %d\n", header.height);
+    fprintf(file, "VIEWPOINT 0 0 0 1 0 0 0\n");
+    fprintf(file, "POINTS %0*d\n", count_width, header.points);
+
+    switch (header.datatype) {
+        case PCD_DATA_BINARY:
+            fprintf(file, "DATA binary\n");
+            break;
+        case PCD_DATA_BINARY_COMPRESSED:
+            fprintf(file, "DATA binary_compressed\n");
+            break;
+        case PCD_DATA_ASCII:
+        default:
+            fprintf(file, "DATA ascii\n");
+            break;
+    }
+    return true;
+}
+
+}  // namespace io
+}  // namespace open3d
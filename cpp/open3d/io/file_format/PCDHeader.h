@@ -0,0 +1,84 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace open3d {
+namespace io {
+
+enum PCDDataType {
+    PCD_DATA_ASCII = 0,
+    PCD_DATA_BINARY = 1,
+    PCD_DATA_BINARY_COMPRESSED = 2
+};
+
+/// Field of a PCD file, as declared by the FIELDS, SIZE, TYPE and COUNT lines.
+struct PCLPointField {
+public:
+    std::string name;
+    int size = 4;
+    char type = 'F';
+    int count = 1;
+    // helper variable
+    int count_offset = 0;
+    int offset = 0;
+};
+
+/// Header of a PCD file. Used by the io and t::io PCD readers and writers.
+struct PCDHeader {
+public:
+    std::string version;
+    std::vector<PCLPointField> fields;
+    int width = 0;
+    int height = 0;
+    int points = 0;
+    PCDDataType datatype = PCD_DATA_ASCII;
+    std::string viewpoint;
+    // helper variables
+    int elementnum = 0;
+    int pointsize = 0;
+    bool has_points = false;
+    bool has_normals = false;
+    bool has_colors = false;
+};
+
+/// Reads the header of a PCD file, up to and including the DATA line. Returns
+/// false if the header is malformed or declares no data.
+bool ReadPCDHeader(FILE *file, PCDHeader &header);
+
+/// Writes the header of a PCD file, up to and including the DATA line. WIDTH
+/// and POINTS are zero-padded to count_width digits, so that a header written
+/// before the number of points is known can be rewritten in place.
+bool WritePCDHeader(FILE *file,
+                    const PCDHeader &header,
+                    int count_width = 0);
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,354 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/file_format/PLYBinaryReader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <unordered_map>
+
+#include "open3d/core/Float16.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace io {
+
+namespace {
+
+/// Number of vertices decoded by one task.
+constexpr int64_t kVerticesPerChunk = 16384;
+/// Bounds on how often ReadProperties() reports its progress.
+constexpr int64_t kMaxProgressSteps = 100;
+constexpr int64_t kVerticesPerProgressStep = 1000;
+
+bool IsLittleEndianHost() {
+    const uint16_t value = 1;
+    return *reinterpret_cast<const uint8_t *>(&value) == 1;
+}
+
+bool GetScalarType(const std::string &name,
+                   PLYBinaryReader::ScalarType &type,
+                   int64_t &size) {
+    using ScalarType = PLYBinaryReader::ScalarType;
+    static const std::unordered_map<std::string,
+                                    std::pair<ScalarType, int64_t>>
+            name_to_type = {
+                    {"int8", {ScalarType::Int8, 1}},
+                    {"char", {ScalarType::Int8, 1}},
+                    {"uint8", {ScalarType::UInt8, 1}},
+                    {"uchar", {ScalarType::UInt8, 1}},
+                    {"int16", {ScalarType::Int16, 2}},
+                    {"short", {ScalarType::Int16, 2}},
+                    {"uint16", {ScalarType::UInt16, 2}},
+                    {"ushort", {ScalarType::UInt16, 2}},
+                    {"int32", {ScalarType::Int32, 4}},
+                    {"int", {ScalarType::Int32, 4}},
+                    {"uint32", {ScalarType::UInt32, 4}},
+                    {"uint", {ScalarType::UInt32, 4}},
+                    {"float32", {ScalarType::Float32, 4}},
+                    {"float", {ScalarType::Float32, 4}},
+                    {"float64", {ScalarType::Float64, 8}},
+                    {"double", {ScalarType::Float64, 8}}};
+    auto it = name_to_type.find(name);
+    if (it == name_to_type.end()) {
+        return false;
+    }
+    type = it->second.first;
+    size = it->second.second;
+    return true;
+}
+
+/// Decodes the property at offset of the records [begin, end) into every
+/// stride-th value of data.
+template <typename T, typename S>
+void DecodeProperty(const char *records,
+                    int64_t record_size,
+                    int64_t offset,
+                    int64_t begin,
+                    int64_t end,
+                    int64_t stride,
+                    T *data) {
+    const char *record = records + begin * record_size + offset;
+    for (int64_t i = begin; i < end; ++i, record += record_size) {
+        S value;
+        std::memcpy(&value, record, sizeof(S));
+        data[i * stride] = static_cast<T>(value);
+    }
+}
+
+}  // namespace
+
+bool PLYBinaryReader::Open(const std::string &filename) {
+    properties_.clear();
+    num_vertices_ = 0;
+    record_size_ = 0;
+    vertex_offset_ = 0;
+    if (!IsLittleEndianHost() || !file_.Open(filename)) {
+        return false;
+    }
+    const char *data = file_.GetData();
+    const int64_t size = file_.GetFileSize();
+    if (data == nullptr) {
+        return false;
+    }
+
+    // Parse the header line by line. Only the elements up to the vertex
+    // element matter, they must all have fixed size records.
+    bool is_binary_little_endian = false;
+    bool found_vertex = false;
+    bool is_vertex = false;
+    // Whether all properties of the current element are supported scalars.
+    bool is_fixed_size = true;
+    int64_t element_count = 0;
+    int64_t element_record_size = 0;
+    int64_t offset = 0;
+    int64_t pos = 0;
+    int line_index = 0;
+    while (true) {
+        const char *line_end = static_cast<const char *>(
+                std::memchr(data + pos, '\n', size_t(size - pos)));
+        if (line_end == nullptr) {
+            return false;
+        }
+        std::istringstream line(
+                std::string(data + pos, line_end - (data + pos)));
+        pos = line_end - data + 1;
+        std::string keyword;
+        line >> keyword;
+        if (line_index++ == 0) {
+            if (keyword != "ply") {
+                return false;
+            }
+            continue;
+        }
+        if (keyword == "format") {
+            std::string format;
+            line >> format;
+            if (format != "binary_little_endian") {
+                return false;
+            }
+            is_binary_little_endian = true;
+        } else if (keyword == "element" || keyword == "end_header") {
+            // Close the previous element.
+            if (!found_vertex) {
+                if (!is_fixed_size) {
+                    return false;
+                } else if (is_vertex) {
+                    found_vertex = true;
+                    num_vertices_ = element_count;
+                    record_size_ = element_record_size;
+                } else {
+                    offset += element_count * element_record_size;
+                }
+            }
+            if (keyword == "end_header") {
+                break;
+            }
+            std::string name;
+            line >> name >> element_count;
+            is_vertex = !found_vertex && name == "vertex";
+            is_fixed_size = true;
+            element_record_size = 0;
+        } else if (keyword == "property") {
+            std::string type_name, name;
+            line >> type_name >> name;
+            ScalarType type;
+            int64_t type_size;
+            if (!GetScalarType(type_name, type, type_size)) {
+                // List properties have a variable size.
+                is_fixed_size = false;
+                continue;
+            }
+            if (is_vertex) {
+                properties_.push_back({name, type, element_record_size});
+            }
+            element_record_size += type_size;
+        }
+    }
+    vertex_offset_ = pos + offset;
+    return is_binary_little_endian && found_vertex && num_vertices_ > 0 &&
+           vertex_offset_ + num_vertices_ * record_size_ <= size;
+}
+
+int PLYBinaryReader::FindProperty(const std::string &name) const {
+    for (size_t i = 0; i < properties_.size(); ++i) {
+        if (properties_[i].name_ == name) {
+            return int(i);
+        }
+    }
+    return -1;
+}
+
+template <typename T>
+void PLYBinaryReader::ReadProperties(
+        const std::vector<int> &property_indices,
+        int64_t begin_vertex,
+        int64_t end_vertex,
+        T *data,
+        const std::function<void(int64_t)> &update_progress) const {
+    if (begin_vertex < 0 || end_vertex > num_vertices_ ||
+        begin_vertex > end_vertex) {
+        utility::LogError("Invalid vertex range [{}, {}) of {} vertices.",
+                          begin_vertex, end_vertex, num_vertices_);
+    }
+    const char *records =
+            file_.GetData() + vertex_offset_ + begin_vertex * record_size_;
+    const int64_t num_vertices = end_vertex - begin_vertex;
+    const int64_t stride = int64_t(property_indices.size());
+    // The vertices are decoded in up to kMaxProgressSteps serial steps of at
+    // least kVerticesPerProgressStep vertices, each split into parallel chunks.
+    const int64_t num_steps = std::min(
+            kMaxProgressSteps,
+            (num_vertices + kVerticesPerProgressStep - 1) /
+                    kVerticesPerProgressStep);
+    for (int64_t step = 0; step < num_steps; ++step) {
+        const int64_t step_begin = num_vertices * step / num_steps;
+        const int64_t step_end = num_vertices * (step + 1) / num_steps;
+        const int64_t num_chunks =
+                (step_end - step_begin + kVerticesPerChunk - 1) /
+                kVerticesPerChunk;
+#pragma omp parallel for schedule(static)
+        for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+            const int64_t begin = step_begin + chunk * kVerticesPerChunk;
+            const int64_t end = std::min(begin + kVerticesPerChunk, step_end);
+            for (int64_t j = 0; j < stride; ++j) {
+                const Property &property = properties_[property_indices[j]];
+                const int64_t offset = property.offset_;
+                T *column = data + j;
+                switch (property.type_) {
+                    case ScalarType::Int8:
+                        DecodeProperty<T, int8_t>(records, record_size_,
+                                                  offset, begin, end, stride,
+                                                  column);
+                        break;
+                    case ScalarType::UInt8:
+                        DecodeProperty<T, uint8_t>(records, record_size_,
+                                                   offset, begin, end, stride,
+                                                   column);
+                        break;
+                    case ScalarType::Int16:
+                        DecodeProperty<T, int16_t>(records, record_size_,
+                                                   offset, begin, end, stride,
+                                                   column);
+                        break;
+                    case ScalarType::UInt16:
+                        DecodeProperty<T, uint16_t>(records, record_size_,
+                                                    offset, begin, end, stride,
+                                                    column);
+                        break;
+                    case ScalarType::Int32:
+                        DecodeProperty<T, int32_t>(records, record_size_,
+                                                   offset, begin, end, stride,
+                                                   column);
+                        break;
+                    case ScalarType::UInt32:
+                        DecodeProperty<T, uint32_t>(records, record_size_,
+                                                    offset, begin, end, stride,
+                                                    column);
+                        break;
+                    case ScalarType::Float32:
+                        DecodeProperty<T, float>(records, record_size_,
+                                                 offset, begin, end, stride,
+                                                 column);
+                        break;
+                    case ScalarType::Float64:
+                        DecodeProperty<T, double>(records, record_size_,
+                                                  offset, begin, end, stride,
+                                                  column);
+                        break;
+                }
+            }
+        }
+        if (update_progress) {
+            update_progress(step_end);
+        }
+    }
+}
+
+template void PLYBinaryReader::ReadProperties<float>(
+        const std::vector<int> &property_indices,
+        int64_t begin_vertex,
+        int64_t end_vertex,
+        float *data,
+        const std::function<void(int64_t)> &update_progress) const;
+template void PLYBinaryReader::ReadProperties<double>(
+        const std::vector<int> &property_indices,
+        int64_t begin_vertex,
+        int64_t end_vertex,
+        double *data,
+        const std::function<void(int64_t)> &update_progress) const;
+template void PLYBinaryReader::ReadProperties<int32_t>(
+        const std::vector<int> &property_indices,
+        int64_t begin_vertex,
+        int64_t end_vertex,
+        int32_t *data,
+        const std::function<void(int64_t)> &update_progress) const;
+template void PLYBinaryReader::ReadProperties<int64_t>(
+        const std::vector<int> &property_indices,
+        int64_t begin_vertex,
+        int64_t end_vertex,
+        int64_t *data,
+        const std::function<void(int64_t)> &update_progress) const;
+template void PLYBinaryReader::ReadProperties<uint8_t>(
+        const std::vector<int> &property_indices,
+        int64_t begin_vertex,
+        int64_t end_vertex,
+        uint8_t *data,
+        const std::function<void(int64_t)> &update_progress) const;
+template void PLYBinaryReader::ReadProperties<uint16_t>(
+        const std::vector<int> &property_indices,
+        int64_t begin_vertex,
+        int64_t end_vertex,
+        uint16_t *data,
+        const std::function<void(int64_t)> &update_progress) const;
+template void PLYBinaryReader::ReadProperties<int8_t>(
+        const std::vector<int> &property_indices,
+        int64_t begin_vertex,
+        int64_t end_vertex,
+        int8_t *data,
+        const std::function<void(int64_t)> &update_progress) const;
+template void PLYBinaryReader::ReadProperties<int16_t>(
+        const std::vector<int> &property_indices,
+        int64_t begin_vertex,
+        int64_t end_vertex,
+        int16_t *data,
+        const std::function<void(int64_t)> &update_progress) const;
+template void PLYBinaryReader::ReadProperties<uint32_t>(
+        const std::vector<int> &property_indices,
+        int64_t begin_vertex,
+        int64_t end_vertex,
+        uint32_t *data,
+        const std::function<void(int64_t)> &update_progress) const;
+template void PLYBinaryReader::ReadProperties<core::Float16>(
+        const std::vector<int> &property_indices,
+        int64_t begin_vertex,
+        int64_t end_vertex,
+        core::Float16 *data,
+        const std::function<void(int64_t)> &update_progress) const;
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,120 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace io {
+
+/// \class PLYBinaryReader
+///
+/// \brief Bulk reader for the vertex element of binary little endian PLY
+/// files.
+///
+/// The file is memory mapped and the fixed size vertex records are decoded in
+/// parallel chunks directly into contiguous storage, instead of going through
+/// one rply callback per value. Open() fails for files that are not covered
+/// (ASCII or big endian data, list properties in or before the vertex
+/// element), and the caller falls back to rply.
+class PLYBinaryReader {
+public:
+    enum class ScalarType {
+        Int8,
+        UInt8,
+        Int16,
+        UInt16,
+        Int32,
+        UInt32,
+        Float32,
+        Float64
+    };
+
+    struct Property {
+        std::string name_;
+        ScalarType type_;
+        /// Byte offset of the property in a vertex record.
+        int64_t offset_;
+    };
+
+public:
+    /// Maps the file and parses its header. Returns false if the vertex
+    /// element cannot be read by this reader.
+    bool Open(const std::string &filename);
+
+    /// Returns the number of vertices.
+    int64_t GetNumVertices() const { return num_vertices_; }
+
+    /// Returns the properties of the vertex element, in file order.
+    const std::vector<Property> &GetProperties() const { return properties_; }
+
+    /// Returns the index of the vertex property with the given name, or -1.
+    int FindProperty(const std::string &name) const;
+
+    /// Decodes the given vertex properties into data, as GetNumVertices()
+    /// rows of property_indices.size() values converted to T.
+    /// \param update_progress Called from the calling thread with the number
+    /// of vertices decoded so far.
+    template <typename T>
+    void ReadProperties(const std::vector<int> &property_indices,
+                        T *data,
+                        const std::function<void(int64_t)> &update_progress =
+                                nullptr) const {
+        ReadProperties(property_indices, 0, num_vertices_, data,
+                       update_progress);
+    }
+
+    /// Decodes the given vertex properties of the vertices
+    /// [begin_vertex, end_vertex) into data, as end_vertex - begin_vertex rows.
+    /// Only the pages of the file holding these vertices are touched, so that
+    /// files larger than the memory can be read piece by piece.
+    /// \param update_progress Called from the calling thread with the number
+    /// of vertices of the range decoded so far.
+    template <typename T>
+    void ReadProperties(const std::vector<int> &property_indices,
+                        int64_t begin_vertex,
+                        int64_t end_vertex,
+                        T *data,
+                        const std::function<void(int64_t)> &update_progress =
+                                nullptr) const;
+
+private:
+    utility::filesystem::MappedFile file_;
+    std::vector<Property> properties_;
+    int64_t num_vertices_ = 0;
+    int64_t record_size_ = 0;
+    /// Byte offset of the first vertex record in the file.
+    int64_t vertex_offset_ = 0;
+};
+
+}  // namespace io
+}  // namespace open3d
@@ -26,7 +26,7 @@
 
 #include "open3d/pipelines/integration/ScalableTSDFVolume.h"
 
-#include <unordered_set>
+#include <algorithm>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/integration/MarchingCubesConst.h"
@@ -37,6 +37,24 @@ namespace open3d {
 namespace pipelines {
 namespace integration {
 
+namespace {
+
+/// Mesh extracted from one volume unit by ScalableTSDFVolume's marching cubes.
+struct MarchingCubesUnit {
+    /// Vertices created by this unit.
+    std::vector<Eigen::Vector3d> vertices_;
+    std::vector<Eigen::Vector3d> vertex_colors_;
+    /// Triangles of this unit. A vertex index i >= 0 refers to vertices_[i],
+    /// and i < 0 to foreign_vertices_[-i - 1].
+    std::vector<Eigen::Vector3i> triangles_;
+    /// Maps each edge used by the cubes of this unit to its vertex index.
+    std::unordered_map<int, int> edge_to_vertex_;
+    /// Vertices created by other units, as (unit order, edge in that unit).
+    std::vector<std::pair<int, int>> foreign_vertices_;
+};
+
+}  // namespace
+
 ScalableTSDFVolume::ScalableTSDFVolume(double voxel_length,
                                        double sdf_trunc,
                                        TSDFVolumeColorType color_type,
@@ -88,129 +106,182 @@ void ScalableTSDFVolume::Integrate(
                 intrinsic.height_);
     }
 
-    auto depth2cameradistance =
-            geometry::Image::CreateDepthToCameraDistanceMultiplierFloatImage(
-                    intrinsic);
+    // The multiplier image only depends on the intrinsic, which rarely
+    // changes between frames.
+    if (!depth_to_camera_distance_multiplier_ ||
+        intrinsic.width_ != multiplier_intrinsic_.width_ ||
+        intrinsic.height_ != multiplier_intrinsic_.height_ ||
+        intrinsic.intrinsic_matrix_ !=
+                multiplier_intrinsic_.intrinsic_matrix_) {
+        depth_to_camera_distance_multiplier_ = geometry::Image::
+                CreateDepthToCameraDistanceMultiplierFloatImage(intrinsic);
+        multiplier_intrinsic_ = intrinsic;
+    }
     auto pointcloud = geometry::PointCloud::CreateFromDepthImage(
             image.depth_, intrinsic, extrinsic, 1000.0, 1000.0,
             depth_sampling_stride_);
-    std::unordered_set<Eigen::Vector3i, utility::hash_eigen<Eigen::Vector3i>>
-            touched_volume_units_;
-    for (const auto &point : pointcloud->points_) {
-        auto min_bound = LocateVolumeUnit(
-                point - Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        auto max_bound = LocateVolumeUnit(
-                point + Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        for (auto x = min_bound(0); x <= max_bound(0); x++) {
-            for (auto y = min_bound(1); y <= max_bound(1); y++) {
-                for (auto z = min_bound(2); z <= max_bound(2); z++) {
-                    auto loc = Eigen::Vector3i(x, y, z);
-                    if (touched_volume_units_.find(loc) ==
-                        touched_volume_units_.end()) {
-                        touched_volume_units_.insert(loc);
-                        auto volume = OpenVolumeUnit(Eigen::Vector3i(x, y, z));
-                        volume->IntegrateWithDepthToCameraDistanceMultiplier(
-                                image, intrinsic, extrinsic,
-                                *depth2cameradistance);
+
+    // Collect the volume units touched by the truncation band of each point.
+    // The units are sorted so that they are opened in a deterministic order.
+    struct UnitIndex {
+        int index[3];
+
+        bool operator<(const UnitIndex &other) const {
+            return std::lexicographical_compare(index, index + 3, other.index,
+                                                other.index + 3);
+        }
+        bool operator==(const UnitIndex &other) const {
+            return std::equal(index, index + 3, other.index);
+        }
+    };
+    std::vector<UnitIndex> touched_units;
+#pragma omp parallel
+    {
+        std::vector<UnitIndex> touched_units_local;
+#pragma omp for schedule(static) nowait
+        for (int i = 0; i < int(pointcloud->points_.size()); i++) {
+            const Eigen::Vector3d &point = pointcloud->points_[i];
+            auto min_bound = LocateVolumeUnit(
+                    point -
+                    Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
+            auto max_bound = LocateVolumeUnit(
+                    point +
+                    Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
+            for (auto x = min_bound(0); x <= max_bound(0); x++) {
+                for (auto y = min_bound(1); y <= max_bound(1); y++) {
+                    for (auto z = min_bound(2); z <= max_bound(2); z++) {
+                        touched_units_local.push_back({{x, y, z}});
                     }
                 }
             }
         }
+        std::sort(touched_units_local.begin(), touched_units_local.end());
+        touched_units_local.erase(std::unique(touched_units_local.begin(),
+                                              touched_units_local.end()),
+                                  touched_units_local.end());
+#pragma omp critical
+        {
+            touched_units.insert(touched_units.end(),
+                                 touched_units_local.begin(),
+                                 touched_units_local.end());
+        }
+    }
+    std::sort(touched_units.begin(), touched_units.end());
+    touched_units.erase(std::unique(touched_units.begin(), touched_units.end()),
+                        touched_units.end());
+
+    std::vector<UniformTSDFVolume *> volumes(touched_units.size());
+    for (size_t i = 0; i < touched_units.size(); i++) {
+        volumes[i] = OpenVolumeUnit(Eigen::Vector3i(touched_units[i].index[0],
+                                                    touched_units[i].index[1],
+                                                    touched_units[i].index[2]))
+                             .get();
+    }
+
+    // Integrate all touched units in a single parallel loop over their
+    // slices.
+    const int num_slices = int(volumes.size()) * volume_unit_resolution_;
+#pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < num_slices; i++) {
+        int x = i % volume_unit_resolution_;
+        volumes[i / volume_unit_resolution_]->IntegrateSlices(
+                image, intrinsic, extrinsic,
+                *depth_to_camera_distance_multiplier_, x, x + 1);
     }
 }
 
 std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
     auto pointcloud = std::make_shared<geometry::PointCloud>();
     double half_voxel_length = voxel_length_ * 0.5;
-    float w0, w1, f0, f1;
-    Eigen::Vector3f c0, c1;
+    std::vector<const VolumeUnit *> units;
     for (const auto &unit : volume_units_) {
         if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
-            for (int x = 0; x < volume0.resolution_; x++) {
-                for (int y = 0; y < volume0.resolution_; y++) {
-                    for (int z = 0; z < volume0.resolution_; z++) {
-                        Eigen::Vector3i idx0(x, y, z);
-                        w0 = volume0.voxels_[volume0.IndexOf(idx0)].weight_;
-                        f0 = volume0.voxels_[volume0.IndexOf(idx0)].tsdf_;
-                        if (color_type_ != TSDFVolumeColorType::NoColor)
-                            c0 = volume0.voxels_[volume0.IndexOf(idx0)]
-                                         .color_.cast<float>();
-                        if (w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f) {
-                            Eigen::Vector3d p0 =
-                                    Eigen::Vector3d(half_voxel_length +
-                                                            voxel_length_ * x,
-                                                    half_voxel_length +
-                                                            voxel_length_ * y,
-                                                    half_voxel_length +
-                                                            voxel_length_ * z) +
-                                    index0.cast<double>() * volume_unit_length_;
-                            for (int i = 0; i < 3; i++) {
-                                Eigen::Vector3d p1 = p0;
-                                Eigen::Vector3i idx1 = idx0;
-                                Eigen::Vector3i index1 = index0;
-                                p1(i) += voxel_length_;
-                                idx1(i) += 1;
-                                if (idx1(i) < volume0.resolution_) {
-                                    w1 = volume0.voxels_[volume0.IndexOf(idx1)]
+            units.push_back(&unit.second);
+        }
+    }
+
+    // Volume units are extracted in parallel into their own point clouds,
+    // which are concatenated in the iteration order of volume_units_.
+    std::vector<geometry::PointCloud> unit_pointclouds(units.size());
+#pragma omp parallel for schedule(dynamic)
+    for (int k = 0; k < int(units.size()); k++) {
+        float w0, w1, f0, f1;
+        Eigen::Vector3f c0, c1;
+        auto &unit_pointcloud = unit_pointclouds[k];
+        const auto &volume0 = *units[k]->volume_;
+        const auto &index0 = units[k]->index_;
+        for (int x = 0; x < volume0.resolution_; x++) {
+            for (int y = 0; y < volume0.resolution_; y++) {
+                for (int z = 0; z < volume0.resolution_; z++) {
+                    Eigen::Vector3i idx0(x, y, z);
+                    w0 = volume0.voxels_[volume0.IndexOf(idx0)].weight_;
+                    f0 = volume0.voxels_[volume0.IndexOf(idx0)].tsdf_;
+                    if (color_type_ != TSDFVolumeColorType::NoColor)
+                        c0 = volume0.voxels_[volume0.IndexOf(idx0)]
+                                     .color_.cast<float>();
+                    if (w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f) {
+                        Eigen::Vector3d p0 =
+                                Eigen::Vector3d(
+                                        half_voxel_length + voxel_length_ * x,
+                                        half_voxel_length + voxel_length_ * y,
+                                        half_voxel_length + voxel_length_ * z) +
+                                index0.cast<double>() * volume_unit_length_;
+                        for (int i = 0; i < 3; i++) {
+                            Eigen::Vector3d p1 = p0;
+                            Eigen::Vector3i idx1 = idx0;
+                            Eigen::Vector3i index1 = index0;
+                            p1(i) += voxel_length_;
+                            idx1(i) += 1;
+                            if (idx1(i) < volume0.resolution_) {
+                                w1 = volume0.voxels_[volume0.IndexOf(idx1)]
+                                             .weight_;
+                                f1 = volume0.voxels_[volume0.IndexOf(idx1)]
+                                             .tsdf_;
+                                if (color_type_ != TSDFVolumeColorType::NoColor)
+                                    c1 = volume0.voxels_[volume0.IndexOf(idx1)]
+                                                 .color_.cast<float>();
+                            } else {
+                                idx1(i) -= volume0.resolution_;
+                                index1(i) += 1;
+                                auto unit_itr = volume_units_.find(index1);
+                                if (unit_itr == volume_units_.end()) {
+                                    w1 = 0.0f;
+                                    f1 = 0.0f;
+                                } else {
+                                    const auto &volume1 =
+                                            *unit_itr->second.volume_;
+                                    w1 = volume1.voxels_[volume1.IndexOf(idx1)]
                                                  .weight_;
-                                    f1 = volume0.voxels_[volume0.IndexOf(idx1)]
+                                    f1 = volume1.voxels_[volume1.IndexOf(idx1)]
                                                  .tsdf_;
                                     if (color_type_ !=
                                         TSDFVolumeColorType::NoColor)
-                                        c1 = volume0.voxels_[volume0.IndexOf(
+                                        c1 = volume1.voxels_[volume1.IndexOf(
                                                                      idx1)]
                                                      .color_.cast<float>();
-                                } else {
-                                    idx1(i) -= volume0.resolution_;
-                                    index1(i) += 1;
-                                    auto unit_itr = volume_units_.find(index1);
-                                    if (unit_itr == volume_units_.end()) {
-                                        w1 = 0.0f;
-                                        f1 = 0.0f;
-                                    } else {
-                                        const auto &volume1 =
-                                                *unit_itr->second.volume_;
-                                        w1 = volume1.voxels_[volume1.IndexOf(
-                                                                     idx1)]
-                                                     .weight_;
-                                        f1 = volume1.voxels_[volume1.IndexOf(
-                                                                     idx1)]
-                                                     .tsdf_;
-                                        if (color_type_ !=
-                                            TSDFVolumeColorType::NoColor)
-                                            c1 = volume1.voxels_
-                                                         [volume1.IndexOf(idx1)]
-                                                                 .color_
-                                                                 .cast<float>();
-                                    }
                                 }
-                                if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
-                                    f0 * f1 < 0) {
-                                    float r0 = std::fabs(f0);
-                                    float r1 = std::fabs(f1);
-                                    Eigen::Vector3d p = p0;
-                                    p(i) = (p0(i) * r1 + p1(i) * r0) /
-                                           (r0 + r1);
-                                    pointcloud->points_.push_back(p);
-                                    if (color_type_ ==
-                                        TSDFVolumeColorType::RGB8) {
-                                        pointcloud->colors_.push_back(
-                                                ((c0 * r1 + c1 * r0) /
-                                                 (r0 + r1) / 255.0f)
-                                                        .cast<double>());
-                                    } else if (color_type_ ==
-                                               TSDFVolumeColorType::Gray32) {
-                                        pointcloud->colors_.push_back(
-                                                ((c0 * r1 + c1 * r0) /
-                                                 (r0 + r1))
-                                                        .cast<double>());
-                                    }
-                                    // has_normal
-                                    pointcloud->normals_.push_back(
-                                            GetNormalAt(p));
+                            }
+                            if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
+                                f0 * f1 < 0) {
+                                float r0 = std::fabs(f0);
+                                float r1 = std::fabs(f1);
+                                Eigen::Vector3d p = p0;
+                                p(i) = (p0(i) * r1 + p1(i) * r0) / (r0 + r1);
+                                unit_pointcloud.points_.push_back(p);
+                                if (color_type_ == TSDFVolumeColorType::RGB8) {
+                                    unit_pointcloud.colors_.push_back(
+                                            ((c0 * r1 + c1 * r0) / (r0 + r1) /
+                                             255.0f)
+                                                    .cast<double>());
+                                } else if (color_type_ ==
+                                           TSDFVolumeColorType::Gray32) {
+                                    unit_pointcloud.colors_.push_back(
+                                            ((c0 * r1 + c1 * r0) / (r0 + r1))
+                                                    .cast<double>());
                                 }
+                                // has_normal
+                                unit_pointcloud.normals_.push_back(
+                                        GetNormalAt(p));
                             }
                         }
                     }
@@ -218,6 +289,32 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
             }
         }
     }
+
+    std::vector<size_t> point_offsets(units.size() + 1, 0);
+    for (size_t k = 0; k < units.size(); k++) {
+        point_offsets[k + 1] =
+                point_offsets[k] + unit_pointclouds[k].points_.size();
+    }
+    pointcloud->points_.resize(point_offsets.back());
+    pointcloud->normals_.resize(point_offsets.back());
+    if (color_type_ != TSDFVolumeColorType::NoColor) {
+        pointcloud->colors_.resize(point_offsets.back());
+    }
+#pragma omp parallel for schedule(static)
+    for (int k = 0; k < int(units.size()); k++) {
+        const auto &unit_pointcloud = unit_pointclouds[k];
+        std::copy(unit_pointcloud.points_.begin(),
+                  unit_pointcloud.points_.end(),
+                  pointcloud->points_.begin() + point_offsets[k]);
+        std::copy(unit_pointcloud.normals_.begin(),
+                  unit_pointcloud.normals_.end(),
+                  pointcloud->normals_.begin() + point_offsets[k]);
+        if (pointcloud->HasColors()) {
+            std::copy(unit_pointcloud.colors_.begin(),
+                      unit_pointcloud.colors_.end(),
+                      pointcloud->colors_.begin() + point_offsets[k]);
+        }
+    }
     return pointcloud;
 }
 
@@ -225,149 +322,236 @@ std::shared_ptr<geometry::TriangleMesh>
 ScalableTSDFVolume::ExtractTriangleMesh() {
     // implementation of marching cubes, based on
     // http://paulbourke.net/geometry/polygonise/
+    //
+    // Volume units are processed in parallel, each with its own edge to
+    // vertex table. The vertex on an edge is created by the first unit, in
+    // the iteration order of volume_units_, whose cubes use the edge, and
+    // the units are concatenated in that order. This yields the same mesh,
+    // down to the vertex order, as visiting all units in a single pass.
     auto mesh = std::make_shared<geometry::TriangleMesh>();
     double half_voxel_length = voxel_length_ * 0.5;
-    std::unordered_map<
-            Eigen::Vector4i, int, utility::hash_eigen<Eigen::Vector4i>,
-            std::equal_to<Eigen::Vector4i>,
-            Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
-            edgeindex_to_vertexindex;
-    int edge_to_index[12];
+    const int resolution = volume_unit_resolution_;
+    std::vector<const VolumeUnit *> units;
+    std::unordered_map<Eigen::Vector3i, int,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            unit_to_order;
     for (const auto &unit : volume_units_) {
         if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
-            for (int x = 0; x < volume0.resolution_; x++) {
-                for (int y = 0; y < volume0.resolution_; y++) {
-                    for (int z = 0; z < volume0.resolution_; z++) {
-                        Eigen::Vector3i idx0(x, y, z);
-                        int cube_index = 0;
-                        float w[8];
-                        float f[8];
-                        Eigen::Vector3d c[8];
-                        for (int i = 0; i < 8; i++) {
-                            Eigen::Vector3i index1 = index0;
-                            Eigen::Vector3i idx1 = idx0 + shift[i];
-                            if (idx1(0) < volume_unit_resolution_ &&
-                                idx1(1) < volume_unit_resolution_ &&
-                                idx1(2) < volume_unit_resolution_) {
-                                w[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .weight_;
-                                f[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .tsdf_;
-                                if (color_type_ == TSDFVolumeColorType::RGB8)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>() /
-                                           255.0;
-                                else if (color_type_ ==
-                                         TSDFVolumeColorType::Gray32)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>();
-                            } else {
-                                for (int j = 0; j < 3; j++) {
-                                    if (idx1(j) >= volume_unit_resolution_) {
-                                        idx1(j) -= volume_unit_resolution_;
-                                        index1(j) += 1;
-                                    }
-                                }
-                                auto unit_itr1 = volume_units_.find(index1);
-                                if (unit_itr1 == volume_units_.end()) {
-                                    w[i] = 0.0f;
-                                    f[i] = 0.0f;
-                                } else {
-                                    const auto &volume1 =
-                                            *unit_itr1->second.volume_;
-                                    w[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .weight_;
-                                    f[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .tsdf_;
-                                    if (color_type_ ==
-                                        TSDFVolumeColorType::RGB8)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>() /
-                                               255.0;
-                                    else if (color_type_ ==
-                                             TSDFVolumeColorType::Gray32)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>();
-                                }
-                            }
-                            if (w[i] == 0.0f) {
-                                cube_index = 0;
-                                break;
-                            } else {
-                                if (f[i] < 0.0f) {
-                                    cube_index |= (1 << i);
-                                }
-                            }
+            unit_to_order[unit.first] = int(units.size());
+            units.push_back(&unit.second);
+        }
+    }
+
+    // Gathers the corners of the cube at idx0 of the unit at index0, which
+    // may reach into the neighbouring units. Returns the cube index, or 0 if
+    // a corner has not been observed.
+    auto get_cube = [&](const UniformTSDFVolume &volume0,
+                        const Eigen::Vector3i &index0,
+                        const Eigen::Vector3i &idx0, float *f,
+                        Eigen::Vector3d *c) {
+        int cube_index = 0;
+        for (int i = 0; i < 8; i++) {
+            Eigen::Vector3i index1 = index0;
+            Eigen::Vector3i idx1 = idx0 + shift[i];
+            const geometry::TSDFVoxel *voxel = nullptr;
+            if (idx1(0) < resolution && idx1(1) < resolution &&
+                idx1(2) < resolution) {
+                voxel = &volume0.voxels_[volume0.IndexOf(idx1)];
+            } else {
+                for (int j = 0; j < 3; j++) {
+                    if (idx1(j) >= resolution) {
+                        idx1(j) -= resolution;
+                        index1(j) += 1;
+                    }
+                }
+                auto unit_itr1 = volume_units_.find(index1);
+                if (unit_itr1 != volume_units_.end()) {
+                    const auto &volume1 = *unit_itr1->second.volume_;
+                    voxel = &volume1.voxels_[volume1.IndexOf(idx1)];
+                }
+            }
+            if (voxel == nullptr || voxel->weight_ == 0.0f) {
+                return 0;
+            }
+            f[i] = voxel->tsdf_;
+            if (c != nullptr) {
+                if (color_type_ == TSDFVolumeColorType::RGB8)
+                    c[i] = voxel->color_.cast<double>() / 255.0;
+                else if (color_type_ == TSDFVolumeColorType::Gray32)
+                    c[i] = voxel->color_.cast<double>();
+            }
+            if (f[i] < 0.0f) {
+                cube_index |= (1 << i);
+            }
+        }
+        return cube_index;
+    };
+
+    // Returns the order of the first unit whose cubes use the given edge of
+    // the unit with the given order. An edge is shared by the 4 cubes whose
+    // origins are offset by 0 or -1 along the two other axes, only those in
+    // other units need to be checked.
+    auto find_edge_owner = [&](int order, const Eigen::Vector4i &edge_index) {
+        const Eigen::Vector3i &index0 = units[order]->index_;
+        int owner = order;
+        for (int d = 0; d < 4; d++) {
+            Eigen::Vector3i idx1 = edge_index.head<3>();
+            idx1((edge_index(3) + 1) % 3) -= d & 1;
+            idx1((edge_index(3) + 2) % 3) -= d >> 1;
+            Eigen::Vector3i index1 = index0;
+            for (int j = 0; j < 3; j++) {
+                if (idx1(j) < 0) {
+                    idx1(j) += resolution;
+                    index1(j) -= 1;
+                } else if (idx1(j) >= resolution) {
+                    idx1(j) -= resolution;
+                    index1(j) += 1;
+                }
+            }
+            if (index1 == index0) {
+                continue;
+            }
+            auto order_itr = unit_to_order.find(index1);
+            if (order_itr == unit_to_order.end() ||
+                order_itr->second > owner) {
+                continue;
+            }
+            // The cube uses the edge if all of its corners are observed, as
+            // the sign change along the edge is known.
+            float f[8];
+            const auto &volume1 = *units[order_itr->second]->volume_;
+            if (get_cube(volume1, index1, idx1, f, nullptr) != 0) {
+                owner = order_itr->second;
+            }
+        }
+        return owner;
+    };
+
+    // Index of an edge of the unit, with its origin in [0, resolution]^3.
+    auto edge_key = [resolution](const Eigen::Vector4i &edge_index) {
+        return ((edge_index(0) * (resolution + 1) + edge_index(1)) *
+                        (resolution + 1) +
+                edge_index(2)) *
+                       3 +
+               edge_index(3);
+    };
+
+    std::vector<MarchingCubesUnit> unit_meshes(units.size());
+#pragma omp parallel for schedule(dynamic)
+    for (int k = 0; k < int(units.size()); k++) {
+        const auto &volume0 = *units[k]->volume_;
+        const auto &index0 = units[k]->index_;
+        auto &unit_mesh = unit_meshes[k];
+        int edge_to_index[12];
+        for (int x = 0; x < resolution; x++) {
+            for (int y = 0; y < resolution; y++) {
+                for (int z = 0; z < resolution; z++) {
+                    float f[8];
+                    Eigen::Vector3d c[8];
+                    int cube_index = get_cube(
+                            volume0, index0, Eigen::Vector3i(x, y, z), f, c);
+                    if (cube_index == 0 || cube_index == 255) {
+                        continue;
+                    }
+                    for (int i = 0; i < 12; i++) {
+                        if (!(edge_table[cube_index] & (1 << i))) {
+                            continue;
                         }
-                        if (cube_index == 0 || cube_index == 255) {
+                        Eigen::Vector4i edge_index =
+                                Eigen::Vector4i(x, y, z, 0) + edge_shift[i];
+                        int key = edge_key(edge_index);
+                        auto vertex_itr = unit_mesh.edge_to_vertex_.find(key);
+                        if (vertex_itr != unit_mesh.edge_to_vertex_.end()) {
+                            edge_to_index[i] = vertex_itr->second;
                             continue;
                         }
-                        for (int i = 0; i < 12; i++) {
-                            if (edge_table[cube_index] & (1 << i)) {
-                                Eigen::Vector4i edge_index =
-                                        Eigen::Vector4i(index0(0), index0(1),
-                                                        index0(2), 0) *
-                                                volume_unit_resolution_ +
-                                        Eigen::Vector4i(x, y, z, 0) +
-                                        edge_shift[i];
-                                if (edgeindex_to_vertexindex.find(edge_index) ==
-                                    edgeindex_to_vertexindex.end()) {
-                                    edge_to_index[i] =
-                                            (int)mesh->vertices_.size();
-                                    edgeindex_to_vertexindex[edge_index] =
-                                            (int)mesh->vertices_.size();
-                                    Eigen::Vector3d pt(
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(0),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(1),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(2));
-                                    double f0 = std::abs(
-                                            (double)f[edge_to_vert[i][0]]);
-                                    double f1 = std::abs(
-                                            (double)f[edge_to_vert[i][1]]);
-                                    pt(edge_index(3)) +=
-                                            f0 * voxel_length_ / (f0 + f1);
-                                    mesh->vertices_.push_back(pt);
-                                    if (color_type_ !=
-                                        TSDFVolumeColorType::NoColor) {
-                                        const auto &c0 = c[edge_to_vert[i][0]];
-                                        const auto &c1 = c[edge_to_vert[i][1]];
-                                        mesh->vertex_colors_.push_back(
-                                                (f1 * c0 + f0 * c1) /
-                                                (f0 + f1));
-                                    }
-                                } else {
-                                    edge_to_index[i] = edgeindex_to_vertexindex
-                                            [edge_index];
-                                }
-                            }
+                        int owner = find_edge_owner(k, edge_index);
+                        if (owner != k) {
+                            edge_index.head<3>() +=
+                                    (index0 - units[owner]->index_) *
+                                    resolution;
+                            unit_mesh.foreign_vertices_.emplace_back(
+                                    owner, edge_key(edge_index));
+                            edge_to_index[i] =
+                                    -int(unit_mesh.foreign_vertices_.size());
+                            unit_mesh.edge_to_vertex_[key] = edge_to_index[i];
+                            continue;
                         }
-                        for (int i = 0; tri_table[cube_index][i] != -1;
-                             i += 3) {
-                            mesh->triangles_.push_back(Eigen::Vector3i(
-                                    edge_to_index[tri_table[cube_index][i]],
-                                    edge_to_index[tri_table[cube_index][i + 2]],
-                                    edge_to_index[tri_table[cube_index]
-                                                           [i + 1]]));
+                        edge_to_index[i] = int(unit_mesh.vertices_.size());
+                        unit_mesh.edge_to_vertex_[key] = edge_to_index[i];
+                        edge_index.head<3>() += index0 * resolution;
+                        Eigen::Vector3d pt(
+                                half_voxel_length +
+                                        voxel_length_ * edge_index(0),
+                                half_voxel_length +
+                                        voxel_length_ * edge_index(1),
+                                half_voxel_length +
+                                        voxel_length_ * edge_index(2));
+                        double f0 = std::abs((double)f[edge_to_vert[i][0]]);
+                        double f1 = std::abs((double)f[edge_to_vert[i][1]]);
+                        pt(edge_index(3)) += f0 * voxel_length_ / (f0 + f1);
+                        unit_mesh.vertices_.push_back(pt);
+                        if (color_type_ != TSDFVolumeColorType::NoColor) {
+                            const auto &c0 = c[edge_to_vert[i][0]];
+                            const auto &c1 = c[edge_to_vert[i][1]];
+                            unit_mesh.vertex_colors_.push_back(
+                                    (f1 * c0 + f0 * c1) / (f0 + f1));
                         }
                     }
+                    for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
+                        unit_mesh.triangles_.push_back(Eigen::Vector3i(
+                                edge_to_index[tri_table[cube_index][i]],
+                                edge_to_index[tri_table[cube_index][i + 2]],
+                                edge_to_index[tri_table[cube_index][i + 1]]));
+                    }
                 }
             }
         }
     }
+
+    // Prefix sums of the vertex and triangle counts give the offsets of the
+    // units in the merged mesh.
+    std::vector<int> vertex_offsets(units.size() + 1, 0);
+    std::vector<size_t> triangle_offsets(units.size() + 1, 0);
+    for (size_t k = 0; k < units.size(); k++) {
+        vertex_offsets[k + 1] =
+                vertex_offsets[k] + int(unit_meshes[k].vertices_.size());
+        triangle_offsets[k + 1] =
+                triangle_offsets[k] + unit_meshes[k].triangles_.size();
+    }
+    mesh->vertices_.resize(vertex_offsets.back());
+    if (color_type_ != TSDFVolumeColorType::NoColor) {
+        mesh->vertex_colors_.resize(vertex_offsets.back());
+    }
+    mesh->triangles_.resize(triangle_offsets.back());
+#pragma omp parallel for schedule(dynamic)
+    for (int k = 0; k < int(units.size()); k++) {
+        const auto &unit_mesh = unit_meshes[k];
+        std::copy(unit_mesh.vertices_.begin(), unit_mesh.vertices_.end(),
+                  mesh->vertices_.begin() + vertex_offsets[k]);
+        if (mesh->HasVertexColors()) {
+            std::copy(unit_mesh.vertex_colors_.begin(),
+                      unit_mesh.vertex_colors_.end(),
+                      mesh->vertex_colors_.begin() + vertex_offsets[k]);
+        }
+        std::vector<int> foreign_to_index(unit_mesh.foreign_vertices_.size());
+        for (size_t i = 0; i < foreign_to_index.size(); i++) {
+            int owner = unit_mesh.foreign_vertices_[i].first;
+            int key = unit_mesh.foreign_vertices_[i].second;
+            foreign_to_index[i] =
+                    vertex_offsets[owner] +
+                    unit_meshes[owner].edge_to_vertex_.at(key);
+        }
+        for (size_t i = 0; i < unit_mesh.triangles_.size(); i++) {
+            Eigen::Vector3i &triangle =
+                    mesh->triangles_[triangle_offsets[k] + i];
+            for (int j = 0; j < 3; j++) {
+                int index = unit_mesh.triangles_[i](j);
+                triangle(j) = index >= 0 ? vertex_offsets[k] + index
+                                         : foreign_to_index[-index - 1];
+            }
+        }
+    }
     return mesh;
 }
 
@@ -111,6 +111,11 @@ private:
     Eigen::Vector3d GetNormalAt(const Eigen::Vector3d &p);
 
     double GetTSDFAt(const Eigen::Vector3d &p);
+
+    /// Depth to camera distance multiplier image of the last intrinsic used
+    /// in Integrate().
+    std::shared_ptr<geometry::Image> depth_to_camera_distance_multiplier_;
+    camera::PinholeCameraIntrinsic multiplier_intrinsic_;
 };
 
 }  // namespace integration
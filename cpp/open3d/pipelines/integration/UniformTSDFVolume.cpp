@@ -299,6 +299,20 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic,
         const geometry::Image &depth_to_camera_distance_multiplier) {
+#pragma omp parallel for schedule(static)
+    for (int x = 0; x < resolution_; x++) {
+        IntegrateSlices(image, intrinsic, extrinsic,
+                        depth_to_camera_distance_multiplier, x, x + 1);
+    }
+}
+
+void UniformTSDFVolume::IntegrateSlices(
+        const geometry::RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const geometry::Image &depth_to_camera_distance_multiplier,
+        int x_begin,
+        int x_end) {
     const float fx = static_cast<float>(intrinsic.GetFocalLength().first);
     const float fy = static_cast<float>(intrinsic.GetFocalLength().second);
     const float cx = static_cast<float>(intrinsic.GetPrincipalPoint().first);
@@ -311,13 +325,16 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
     const Eigen::Matrix4f extrinsic_scaled_f = extrinsic_f * voxel_length_f;
     const float safe_width_f = intrinsic.width_ - 0.0001f;
     const float safe_height_f = intrinsic.height_ - 0.0001f;
+    // Direct pointers to the pixels, avoiding Image::PointerAt() calls in the
+    // inner loop.
+    const int width = image.depth_.width_;
+    const float *depth_data = (const float *)image.depth_.data_.data();
+    const float *multiplier_data =
+            (const float *)depth_to_camera_distance_multiplier.data_.data();
+    const uint8_t *rgb_data = (const uint8_t *)image.color_.data_.data();
+    const float *intensity_data = (const float *)image.color_.data_.data();
 
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-    for (int x = 0; x < resolution_; x++) {
+    for (int x = x_begin; x < x_end; x++) {
         for (int y = 0; y < resolution_; y++) {
             Eigen::Vector4f pt_3d_homo(float(half_voxel_length_f +
                                              voxel_length_f * x + origin_(0)),
@@ -344,16 +361,14 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
                 // Skip if negative depth in depth image
                 int u = (int)u_f;
                 int v = (int)v_f;
-                float d = *image.depth_.PointerAt<float>(u, v);
+                const int pixel = v * width + u;
+                float d = depth_data[pixel];
                 if (d <= 0.0f) {
                     continue;
                 }
 
                 int v_ind = IndexOf(x, y, z);
-                float sdf =
-                        (d - pt_camera(2)) *
-                        (*depth_to_camera_distance_multiplier.PointerAt<float>(
-                                u, v));
+                float sdf = (d - pt_camera(2)) * multiplier_data[pixel];
                 if (sdf > -sdf_trunc_f) {
                     // integrate
                     float tsdf = std::min(1.0f, sdf * sdf_trunc_inv_f);
@@ -362,8 +377,7 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
                              tsdf) /
                             (voxels_[v_ind].weight_ + 1.0f);
                     if (color_type_ == TSDFVolumeColorType::RGB8) {
-                        const uint8_t *rgb =
-                                image.color_.PointerAt<uint8_t>(u, v, 0);
+                        const uint8_t *rgb = rgb_data + pixel * 3;
                         Eigen::Vector3d rgb_f(rgb[0], rgb[1], rgb[2]);
                         voxels_[v_ind].color_ =
                                 (voxels_[v_ind].color_ *
@@ -371,8 +385,7 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
                                  rgb_f) /
                                 (voxels_[v_ind].weight_ + 1.0f);
                     } else if (color_type_ == TSDFVolumeColorType::Gray32) {
-                        const float *intensity =
-                                image.color_.PointerAt<float>(u, v, 0);
+                        const float *intensity = intensity_data + pixel;
                         voxels_[v_ind].color_ =
                                 (voxels_[v_ind].color_.array() *
                                          voxels_[v_ind].weight_ +
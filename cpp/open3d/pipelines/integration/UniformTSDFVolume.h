@@ -85,6 +85,18 @@ public:
             const Eigen::Matrix4d &extrinsic,
             const geometry::Image &depth_to_camera_distance_multiplier);
 
+    /// Integrates the voxels with x index in [x_begin, x_end), in the calling
+    /// thread, as IntegrateWithDepthToCameraDistanceMultiplier() does for the
+    /// whole volume. This allows integrating slices of many volumes in a
+    /// single parallel loop.
+    void IntegrateSlices(
+            const geometry::RGBDImage &image,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const geometry::Image &depth_to_camera_distance_multiplier,
+            int x_begin,
+            int x_end);
+
     inline int IndexOf(int x, int y, int z) const {
         return x * resolution_ * resolution_ + y * resolution_ + z;
     }
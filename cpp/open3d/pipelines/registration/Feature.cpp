@@ -70,22 +70,44 @@ static Eigen::Vector4d ComputePairFeatures(const Eigen::Vector3d &p1,
     return result;
 }
 
+// Calls func(i, indices, distance2, num_nbs) in parallel for every point i,
+// where indices and distance2 point to the num_nbs neighbors of point i.
+template <typename func_t>
+static void ParallelForEachNeighborhood(
+        const geometry::PointCloud &input,
+        const geometry::KDTreeFlann &kdtree,
+        const geometry::KDTreeSearchParam &search_param,
+        func_t func) {
+    kdtree.SearchBatchBlocked(
+            input.points_, search_param,
+            [&](int64_t block_begin, int64_t block_end,
+                const std::vector<int> &indices,
+                const std::vector<double> &distance2,
+                const std::vector<int64_t> &offsets) {
+#pragma omp parallel for schedule(static)
+                for (int64_t i = block_begin; i < block_end; i++) {
+                    const int64_t nb_begin = offsets[i - block_begin];
+                    func(int(i), indices.data() + nb_begin,
+                         distance2.data() + nb_begin,
+                         int(offsets[i - block_begin + 1] - nb_begin));
+                }
+            });
+}
+
 static std::shared_ptr<Feature> ComputeSPFHFeature(
         const geometry::PointCloud &input,
         const geometry::KDTreeFlann &kdtree,
         const geometry::KDTreeSearchParam &search_param) {
     auto feature = std::make_shared<Feature>();
     feature->Resize(33, (int)input.points_.size());
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)input.points_.size(); i++) {
+    auto compute_spfh = [&](int i, const int *indices,
+                            const double * /*distance2*/, int num_nbs) {
         const auto &point = input.points_[i];
         const auto &normal = input.normals_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
+        if (num_nbs > 1) {
             // only compute SPFH feature when a point has neighbors
-            double hist_incr = 100.0 / (double)(indices.size() - 1);
-            for (size_t k = 1; k < indices.size(); k++) {
+            double hist_incr = 100.0 / (double)(num_nbs - 1);
+            for (int k = 1; k < num_nbs; k++) {
                 // skip the point itself, compute histogram
                 auto pf = ComputePairFeatures(point, normal,
                                               input.points_[indices[k]],
@@ -104,7 +126,8 @@ static std::shared_ptr<Feature> ComputeSPFHFeature(
                 feature->data_(h_index + 22, i) += hist_incr;
             }
         }
-    }
+    };
+    ParallelForEachNeighborhood(input, kdtree, search_param, compute_spfh);
     return feature;
 }
 
@@ -121,14 +144,11 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
     }
     geometry::KDTreeFlann kdtree(input);
     auto spfh = ComputeSPFHFeature(input, kdtree, search_param);
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)input.points_.size(); i++) {
-        const auto &point = input.points_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
+    auto compute_fpfh = [&](int i, const int *indices, const double *distance2,
+                            int num_nbs) {
+        if (num_nbs > 1) {
             double sum[3] = {0.0, 0.0, 0.0};
-            for (size_t k = 1; k < indices.size(); k++) {
+            for (int k = 1; k < num_nbs; k++) {
                 // skip the point itself
                 double dist = distance2[k];
                 if (dist == 0.0) continue;
@@ -150,7 +170,8 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
                 feature->data_(j, i) += spfh->data_(j, i);
             }
         }
-    }
+    };
+    ParallelForEachNeighborhood(input, kdtree, search_param, compute_fpfh);
     return feature;
 }
 
@@ -206,15 +206,35 @@ static Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
 ///
 /// This function focuses the case that every edge has two nodes (not hyper
 /// graph) so we have two Jacobian matrices from one constraint.
-static std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
-        const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
+///
+/// H is assembled as a sparse matrix of 6x6 blocks. Every edge contributes the
+/// (i, i), (i, j), (j, i) and (j, j) blocks, so the storage is proportional to
+/// the number of edges instead of the square of the number of nodes. The
+/// diagonal blocks of all nodes are always present so that the
+/// Levenberg-Marquardt damping term can be added without changing the
+/// sparsity pattern.
+static std::tuple<Eigen::SparseMatrix<double>, Eigen::VectorXd>
+ComputeLinearSystem(const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
     int n_nodes = (int)pose_graph.nodes_.size();
     int n_edges = (int)pose_graph.edges_.size();
-    Eigen::MatrixXd H(n_nodes * 6, n_nodes * 6);
+    Eigen::SparseMatrix<double> H(n_nodes * 6, n_nodes * 6);
     Eigen::VectorXd b(n_nodes * 6);
-    H.setZero();
     b.setZero();
 
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve((size_t)n_edges * 4 * 36 + (size_t)n_nodes * 6);
+    auto add_block = [&triplets](int row, int col, const Eigen::Matrix6d &m) {
+        for (int c = 0; c < 6; c++) {
+            for (int r = 0; r < 6; r++) {
+                triplets.emplace_back(row + r, col + c, m(r, c));
+            }
+        }
+    };
+
+    for (int iter_node = 0; iter_node < n_nodes * 6; iter_node++) {
+        triplets.emplace_back(iter_node, iter_node, 0.0);
+    }
+
     for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
         const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
         Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
@@ -231,22 +251,64 @@ static std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
 
         int id_i = t.source_node_id_ * 6;
         int id_j = t.target_node_id_ * 6;
-        H.block<6, 6>(id_i, id_i).noalias() +=
-                line_process_iter * JsT_Info * Js;
-        H.block<6, 6>(id_i, id_j).noalias() +=
-                line_process_iter * JsT_Info * Jt;
-        H.block<6, 6>(id_j, id_i).noalias() +=
-                line_process_iter * JtT_Info * Js;
-        H.block<6, 6>(id_j, id_j).noalias() +=
-                line_process_iter * JtT_Info * Jt;
+        add_block(id_i, id_i, line_process_iter * JsT_Info * Js);
+        add_block(id_i, id_j, line_process_iter * JsT_Info * Jt);
+        add_block(id_j, id_i, line_process_iter * JtT_Info * Js);
+        add_block(id_j, id_j, line_process_iter * JtT_Info * Jt);
         b.block<6, 1>(id_i, 0).noalias() -=
                 line_process_iter * eT_Info.transpose() * Js;
         b.block<6, 1>(id_j, 0).noalias() -=
                 line_process_iter * eT_Info.transpose() * Jt;
     }
+    // Duplicated entries (several edges sharing a node) are summed up.
+    H.setFromTriplets(triplets.begin(), triplets.end());
     return std::make_tuple(std::move(H), std::move(b));
 }
 
+/// Function to solve H @ delta == b with the solver selected in \p option.
+static std::tuple<bool, Eigen::VectorXd> SolveLinearSystem(
+        const Eigen::SparseMatrix<double> &H,
+        const Eigen::VectorXd &b,
+        const GlobalOptimizationOption &option) {
+    switch (option.linear_solver_) {
+        case GlobalOptimizationLinearSolver::Dense:
+            return utility::SolveLinearSystemPSD(
+                    Eigen::MatrixXd(H), b, /*prefer_sparse=*/false,
+                    /*check_symmetric=*/false, /*check_det=*/false,
+                    /*check_psd=*/false);
+        case GlobalOptimizationLinearSolver::SparseCholesky: {
+            Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> H_ldlt;
+            H_ldlt.compute(H);
+            if (H_ldlt.info() == Eigen::Success) {
+                Eigen::VectorXd x = H_ldlt.solve(b);
+                if (H_ldlt.info() == Eigen::Success) {
+                    return std::make_tuple(true, std::move(x));
+                }
+            }
+            utility::LogWarning(
+                    "Sparse Cholesky failed, switched to conjugate gradient "
+                    "solver");
+            break;
+        }
+        case GlobalOptimizationLinearSolver::ConjugateGradient:
+            break;
+    }
+
+    Eigen::ConjugateGradient<Eigen::SparseMatrix<double>,
+                             Eigen::Lower | Eigen::Upper>
+            H_cg;
+    H_cg.compute(H);
+    Eigen::VectorXd x = H_cg.solve(b);
+    if (H_cg.info() != Eigen::Success) {
+        utility::LogDebug(
+                "Conjugate gradient did not converge after {:d} iterations, "
+                "error : {:e}",
+                (int)H_cg.iterations(), H_cg.error());
+        return std::make_tuple(false, std::move(x));
+    }
+    return std::make_tuple(true, std::move(x));
+}
+
 static Eigen::VectorXd UpdatePoseVector(const PoseGraph &pose_graph) {
     int n_nodes = (int)pose_graph.nodes_.size();
     Eigen::VectorXd output(n_nodes * 6);
@@ -511,7 +573,7 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
     valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H;
+    Eigen::SparseMatrix<double> H;
     Eigen::VectorXd b;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
@@ -532,10 +594,8 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
         Eigen::VectorXd delta(H.cols());
         bool solver_success = false;
 
-        // Solve H_LM @ delta == b using a sparse solver
-        std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                H, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                /*check_det=*/false, /*check_psd=*/false);
+        // Solve H @ delta == b
+        std::tie(solver_success, delta) = SolveLinearSystem(H, b, option);
 
         stop = stop || CheckRelativeIncrement(delta, x, criteria);
         if (stop) {
@@ -602,8 +662,9 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
     int valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H_I = Eigen::MatrixXd::Identity(n_nodes * 6, n_nodes * 6);
-    Eigen::MatrixXd H;
+    Eigen::SparseMatrix<double> H_I(n_nodes * 6, n_nodes * 6);
+    H_I.setIdentity();
+    Eigen::SparseMatrix<double> H;
     Eigen::VectorXd b;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
@@ -629,14 +690,13 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
         timer_iter.Start();
         int lm_count = 0;
         do {
-            Eigen::MatrixXd H_LM = H + current_lambda * H_I;
+            Eigen::SparseMatrix<double> H_LM = H + current_lambda * H_I;
             Eigen::VectorXd delta(H_LM.cols());
             bool solver_success = false;
 
-            // Solve H_LM @ delta == b using a sparse solver
-            std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                    H_LM, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                    /*check_det=*/false, /*check_psd=*/false);
+            // Solve H_LM @ delta == b
+            std::tie(solver_success, delta) =
+                    SolveLinearSystem(H_LM, b, option);
 
             stop = stop || CheckRelativeIncrement(delta, x, criteria);
             if (!stop) {
@@ -30,6 +30,25 @@ namespace open3d {
 namespace pipelines {
 namespace registration {
 
+/// \enum GlobalOptimizationLinearSolver
+///
+/// \brief Solver used for the normal equations H * delta = b of each
+/// GlobalOptimization iteration.
+///
+/// The Hessian H is always assembled as a sparse matrix of 6x6 blocks, one
+/// block row/column per PoseGraphNode, so its memory grows with the number of
+/// edges. Dense converts H to a dense matrix before solving and is only
+/// suitable for small pose graphs.
+enum class GlobalOptimizationLinearSolver {
+    /// Dense LDLT decomposition.
+    Dense = 0,
+    /// Sparse LDLT (Eigen::SimplicialLDLT) decomposition.
+    SparseCholesky = 1,
+    /// Jacobi-preconditioned conjugate gradient. Preferred for very large
+    /// pose graphs where the Cholesky fill-in becomes too expensive.
+    ConjugateGradient = 2,
+};
+
 /// \class GlobalOptimizationOption
 ///
 /// \brief Option for GlobalOptimization.
@@ -47,14 +66,20 @@ public:
     /// Recommendation: 0.1 for RGBD Odometry, 2.0 for fragment registration.
     /// \param reference_node The pose of this node is unchanged after
     /// optimization.
+    /// \param linear_solver Solver used for the linear system of each
+    /// iteration.
     GlobalOptimizationOption(double max_correspondence_distance = 0.075,
                              double edge_prune_threshold = 0.25,
                              double preference_loop_closure = 1.0,
-                             int reference_node = -1)
+                             int reference_node = -1,
+                             GlobalOptimizationLinearSolver linear_solver =
+                                     GlobalOptimizationLinearSolver::
+                                             SparseCholesky)
         : max_correspondence_distance_(max_correspondence_distance),
           edge_prune_threshold_(edge_prune_threshold),
           preference_loop_closure_(preference_loop_closure),
-          reference_node_(reference_node) {
+          reference_node_(reference_node),
+          linear_solver_(linear_solver) {
         max_correspondence_distance_ = max_correspondence_distance < 0.0
                                                ? 0.075
                                                : max_correspondence_distance;
@@ -83,6 +108,9 @@ public:
     double preference_loop_closure_;
     /// The pose of this node is unchanged after optimization.
     int reference_node_;
+    /// Solver used for the linear system of each iteration. See
+    /// GlobalOptimizationLinearSolver.
+    GlobalOptimizationLinearSolver linear_solver_;
 };
 
 /// \class GlobalOptimizationConvergenceCriteria
@@ -47,31 +47,21 @@ static RegistrationResult GetRegistrationResultAndCorrespondences(
         return result;
     }
 
-    double error2 = 0.0;
+    std::vector<int> indices;
+    std::vector<double> dists;
+    std::vector<int64_t> offsets;
+    target_kdtree.SearchBatch(
+            source.points_,
+            geometry::KDTreeSearchParamHybrid(max_correspondence_distance, 1),
+            indices, dists, offsets);
 
-#pragma omp parallel
-    {
-        double error2_private = 0.0;
-        CorrespondenceSet correspondence_set_private;
-#pragma omp for nowait
-        for (int i = 0; i < (int)source.points_.size(); i++) {
-            std::vector<int> indices(1);
-            std::vector<double> dists(1);
-            const auto &point = source.points_[i];
-            if (target_kdtree.SearchHybrid(point, max_correspondence_distance,
-                                           1, indices, dists) > 0) {
-                error2_private += dists[0];
-                correspondence_set_private.push_back(
-                        Eigen::Vector2i(i, indices[0]));
-            }
-        }
-#pragma omp critical
-        {
-            for (int i = 0; i < (int)correspondence_set_private.size(); i++) {
-                result.correspondence_set_.push_back(
-                        correspondence_set_private[i]);
-            }
-            error2 += error2_private;
+    double error2 = 0.0;
+    result.correspondence_set_.reserve(indices.size());
+    for (int i = 0; i < (int)source.points_.size(); i++) {
+        if (offsets[i + 1] > offsets[i]) {
+            error2 += dists[offsets[i]];
+            result.correspondence_set_.push_back(
+                    Eigen::Vector2i(i, indices[offsets[i]]));
         }
     }
 
@@ -58,7 +58,7 @@ TSDFVoxelGrid::TSDFVoxelGrid(
     int64_t total_bytes = 0;
     if (attr_dtype_map_.count("tsdf") != 0) {
         core::Dtype dtype = attr_dtype_map_.at("tsdf");
-        if (dtype != core::Dtype::Float32) {
+        if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float16) {
             utility::LogWarning(
                     "[TSDFVoxelGrid] unexpected TSDF dtype, please "
                     "implement your own Voxel structure in "
@@ -89,6 +89,16 @@ TSDFVoxelGrid::TSDFVoxelGrid(
         }
         total_bytes += dtype.ByteSize() * 3;
     }
+    // Voxels are dispatched on their byte size, so a Float16 tsdf with any
+    // other weight dtype would be read with the wrong voxel layout.
+    if (attr_dtype_map_.count("tsdf") != 0 &&
+        attr_dtype_map_.at("tsdf") == core::Dtype::Float16 &&
+        (attr_dtype_map_.count("weight") == 0 ||
+         attr_dtype_map_.at("weight") != core::Dtype::UInt16)) {
+        utility::LogError(
+                "[TSDFVoxelGrid] Float16 tsdf is only implemented with UInt16 "
+                "weight.");
+    }
     // Users can add other key/dtype checkers here for potential extensions.
 
     // SDF trunc check, critical for TSDF touch operation that allocates TSDF
@@ -119,6 +119,25 @@ public:
 
     core::Device GetDevice() const { return device_; }
 
+    float GetVoxelSize() const { return voxel_size_; }
+
+    float GetSDFTrunc() const { return sdf_trunc_; }
+
+    int64_t GetBlockResolution() const { return block_resolution_; }
+
+    int64_t GetBlockCount() const { return block_count_; }
+
+    std::unordered_map<std::string, core::Dtype> GetAttrDtypeMap() const {
+        return attr_dtype_map_;
+    }
+
+    /// Returns the hashmap from Int32 block coordinates to the voxels of the
+    /// blocks, as UInt8 values of shape (resolution, resolution, resolution,
+    /// bytes per voxel).
+    std::shared_ptr<core::Hashmap> GetBlockHashmap() const {
+        return block_hashmap_;
+    }
+
 protected:
     /// Return  \addrs and \masks for radius (3) neighbor entries.
     /// We first find all active entries in the hashmap with there coordinates.
@@ -47,6 +47,12 @@
         } else if (BYTESIZE == sizeof(Voxel32f)) {           \
             using voxel_t = Voxel32f;                        \
             return __VA_ARGS__();                            \
+        } else if (BYTESIZE == sizeof(ColoredVoxel16f)) {    \
+            using voxel_t = ColoredVoxel16f;                 \
+            return __VA_ARGS__();                            \
+        } else if (BYTESIZE == sizeof(Voxel16f)) {           \
+            using voxel_t = Voxel16f;                        \
+            return __VA_ARGS__();                            \
         } else {                                             \
             utility::LogError("Unsupported voxel bytesize"); \
         }                                                    \
@@ -174,6 +180,89 @@ struct ColoredVoxel32f {
     }
 };
 
+/// 4-byte voxel structure.
+/// Float16 tsdf and uint16_t weight. The running average is computed in float
+/// and rounded to half precision once per integration.
+struct Voxel16f {
+    static const uint16_t kMaxUint16 = 65535;
+
+    core::Float16 tsdf;
+    uint16_t weight;
+
+    static bool HasColor() { return false; }
+    OPEN3D_HOST_DEVICE float GetTSDF() { return tsdf; }
+    OPEN3D_HOST_DEVICE float GetWeight() { return static_cast<float>(weight); }
+    OPEN3D_HOST_DEVICE float GetR() { return 1.0; }
+    OPEN3D_HOST_DEVICE float GetG() { return 1.0; }
+    OPEN3D_HOST_DEVICE float GetB() { return 1.0; }
+
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf) {
+        float inc_wsum = static_cast<float>(weight) + 1;
+        tsdf = (static_cast<float>(weight) * tsdf + dsdf) / inc_wsum;
+        weight = static_cast<uint16_t>(inc_wsum < static_cast<float>(kMaxUint16)
+                                               ? weight + 1
+                                               : kMaxUint16);
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf,
+                                      float dr,
+                                      float dg,
+                                      float db) {
+        printf("[Voxel16f] should never reach here.\n");
+    }
+};
+
+/// 10-byte voxel structure.
+/// Float16 tsdf with the uint16_t weight and colors of ColoredVoxel16i.
+struct ColoredVoxel16f {
+    static const uint16_t kMaxUint16 = 65535;
+    static constexpr float kColorFactor = 255.0f;
+
+    core::Float16 tsdf;
+    uint16_t weight;
+
+    uint16_t r;
+    uint16_t g;
+    uint16_t b;
+
+    static bool HasColor() { return true; }
+    OPEN3D_HOST_DEVICE float GetTSDF() { return tsdf; }
+    OPEN3D_HOST_DEVICE float GetWeight() { return static_cast<float>(weight); }
+    OPEN3D_HOST_DEVICE float GetR() {
+        return static_cast<float>(r / kColorFactor);
+    }
+    OPEN3D_HOST_DEVICE float GetG() {
+        return static_cast<float>(g / kColorFactor);
+    }
+    OPEN3D_HOST_DEVICE float GetB() {
+        return static_cast<float>(b / kColorFactor);
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf) {
+        float inc_wsum = static_cast<float>(weight) + 1;
+        float inv_wsum = 1.0f / inc_wsum;
+        tsdf = (static_cast<float>(weight) * tsdf + dsdf) * inv_wsum;
+        weight = static_cast<uint16_t>(inc_wsum < static_cast<float>(kMaxUint16)
+                                               ? weight + 1
+                                               : kMaxUint16);
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf,
+                                      float dr,
+                                      float dg,
+                                      float db) {
+        float inc_wsum = static_cast<float>(weight) + 1;
+        float inv_wsum = 1.0f / inc_wsum;
+        tsdf = (weight * tsdf + dsdf) * inv_wsum;
+        r = static_cast<uint16_t>(
+                round((weight * r + dr * kColorFactor) * inv_wsum));
+        g = static_cast<uint16_t>(
+                round((weight * g + dg * kColorFactor) * inv_wsum));
+        b = static_cast<uint16_t>(
+                round((weight * b + db * kColorFactor) * inv_wsum));
+        weight = static_cast<uint16_t>(inc_wsum < static_cast<float>(kMaxUint16)
+                                               ? weight + 1
+                                               : kMaxUint16);
+    }
+};
+
 // Get a voxel in a certain voxel block given the block id with its neighbors.
 template <typename voxel_t>
 inline OPEN3D_DEVICE voxel_t* DeviceGetVoxelAt(
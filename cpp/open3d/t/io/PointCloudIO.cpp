@@ -47,6 +47,8 @@ static const std::unordered_map<
         file_extension_to_pointcloud_read_function{
                 {"xyzi", ReadPointCloudFromXYZI},
                 {"ply", ReadPointCloudFromPLY},
+                {"pcd", ReadPointCloudFromPCD},
+                {"o3dt", ReadPointCloudFromO3DT},
         };
 
 static const std::unordered_map<
@@ -57,6 +59,8 @@ static const std::unordered_map<
         file_extension_to_pointcloud_write_function{
                 {"xyzi", WritePointCloudToXYZI},
                 {"ply", WritePointCloudToPLY},
+                {"pcd", WritePointCloudToPCD},
+                {"o3dt", WritePointCloudToO3DT},
         };
 
 std::shared_ptr<geometry::PointCloud> CreatetPointCloudFromFile(
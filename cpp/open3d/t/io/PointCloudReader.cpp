@@ -0,0 +1,69 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/PointCloudReader.h"
+
+#include <functional>
+#include <unordered_map>
+
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+static const std::unordered_map<
+        std::string,
+        std::function<std::unique_ptr<PointCloudReader>()>>
+        file_extension_to_pointcloud_reader{
+                {"pcd", CreatePointCloudReaderPCD},
+                {"ply", CreatePointCloudReaderPLY},
+                {"xyz", CreatePointCloudReaderXYZ},
+                {"xyzi", CreatePointCloudReaderXYZI},
+        };
+
+std::unique_ptr<PointCloudReader> PointCloudReader::Create(
+        const std::string &filename, const std::string &format) {
+    std::string file_format = format;
+    if (file_format == "auto") {
+        file_format =
+                utility::filesystem::GetFileExtensionInLowerCase(filename);
+    }
+    auto map_itr = file_extension_to_pointcloud_reader.find(file_format);
+    if (map_itr == file_extension_to_pointcloud_reader.end()) {
+        utility::LogError(
+                "Unsupported file format {} for chunked reading of {}",
+                file_format, filename);
+    }
+    std::unique_ptr<PointCloudReader> reader = map_itr->second();
+    reader->Open(filename);
+    return reader;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
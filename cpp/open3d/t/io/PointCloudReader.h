@@ -0,0 +1,94 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class PointCloudReader
+///
+/// \brief Reads a point cloud file in chunks of a bounded number of points.
+///
+/// Unlike ReadPointCloud(), the file is never materialized as a whole, so that
+/// files larger than the memory can be processed chunk by chunk. Binary little
+/// endian PLY, ascii and binary PCD, XYZ and XYZI files are supported.
+class PointCloudReader {
+public:
+    PointCloudReader() {}
+    virtual ~PointCloudReader() {}
+
+    /// Check if the point cloud file is opened.
+    virtual bool IsOpened() const = 0;
+
+    /// Check if all points of the file are read.
+    virtual bool IsEOF() const = 0;
+
+    /// Open a point cloud file.
+    ///
+    /// \param filename Path to the point cloud file.
+    virtual bool Open(const std::string &filename) = 0;
+
+    /// Close the opened point cloud file.
+    virtual void Close() = 0;
+
+    /// Get the total number of points in the file, or -1 if it is only known
+    /// once the file is read to the end.
+    virtual int64_t GetNumPoints() const = 0;
+
+    /// Read the next chunk of the file.
+    ///
+    /// \param chunk_size Maximum number of points of the chunk. All chunks but
+    /// the last one have exactly this number of points.
+    /// \return The point cloud of the chunk, with the same attributes as
+    /// ReadPointCloud() reads, or an empty point cloud if all points are read.
+    virtual geometry::PointCloud NextChunk(int64_t chunk_size) = 0;
+
+    /// Create a reader for the file and open it.
+    ///
+    /// \param filename Path to the point cloud file.
+    /// \param format The format of the file, or "auto" to use its extension.
+    static std::unique_ptr<PointCloudReader> Create(
+            const std::string &filename, const std::string &format = "auto");
+};
+
+std::unique_ptr<PointCloudReader> CreatePointCloudReaderPCD();
+
+std::unique_ptr<PointCloudReader> CreatePointCloudReaderPLY();
+
+std::unique_ptr<PointCloudReader> CreatePointCloudReaderXYZ();
+
+std::unique_ptr<PointCloudReader> CreatePointCloudReaderXYZI();
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
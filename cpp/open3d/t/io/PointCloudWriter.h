@@ -0,0 +1,87 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class PointCloudWriter
+///
+/// \brief Writes a point cloud file from a sequence of chunks.
+///
+/// Together with PointCloudReader, this allows to process point clouds larger
+/// than the memory. Every chunk must have the same attributes, with the same
+/// dtypes, as the first one. PLY files are written as binary little endian,
+/// PCD files as binary. XYZ and XYZI files are supported as well.
+class PointCloudWriter {
+public:
+    PointCloudWriter() {}
+    virtual ~PointCloudWriter() {}
+
+    /// Check if the point cloud file is opened.
+    virtual bool IsOpened() const = 0;
+
+    /// Open a point cloud file for writing.
+    ///
+    /// \param filename Path to the point cloud file.
+    virtual bool Open(const std::string &filename) = 0;
+
+    /// Close the opened point cloud file. Returns false if the file could not
+    /// be completed.
+    virtual bool Close() = 0;
+
+    /// Get the number of points written so far.
+    virtual int64_t GetNumPoints() const = 0;
+
+    /// Append the points of the chunk to the file.
+    virtual bool WriteChunk(const geometry::PointCloud &chunk) = 0;
+
+    /// Create a writer for the file and open it.
+    ///
+    /// \param filename Path to the point cloud file.
+    /// \param format The format of the file, or "auto" to use its extension.
+    static std::unique_ptr<PointCloudWriter> Create(
+            const std::string &filename, const std::string &format = "auto");
+};
+
+std::unique_ptr<PointCloudWriter> CreatePointCloudWriterPCD();
+
+std::unique_ptr<PointCloudWriter> CreatePointCloudWriterPLY();
+
+std::unique_ptr<PointCloudWriter> CreatePointCloudWriterXYZ();
+
+std::unique_ptr<PointCloudWriter> CreatePointCloudWriterXYZI();
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
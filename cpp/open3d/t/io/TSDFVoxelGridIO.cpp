@@ -0,0 +1,136 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/TSDFVoxelGridIO.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/t/io/TensorArchive.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+/// The dtype of each voxel attribute is stored as an empty tensor named after
+/// the attribute with this prefix.
+const std::string kAttrPrefix = "attr_";
+
+}  // namespace
+
+bool ReadTSDFVoxelGrid(const std::string &filename,
+                       geometry::TSDFVoxelGrid &voxelgrid) {
+    std::string type;
+    std::unordered_map<std::string, core::Tensor> tensors;
+    if (!ReadTensorArchive(filename, type, tensors)) {
+        return false;
+    }
+    bool is_voxelgrid = type == "TSDFVoxelGrid";
+    for (const char *name : {"voxel_size", "sdf_trunc", "block_resolution",
+                             "block_count", "block_keys", "block_values"}) {
+        is_voxelgrid = is_voxelgrid && tensors.count(name) != 0;
+    }
+    if (!is_voxelgrid) {
+        utility::LogWarning(
+                "Read TSDFVoxelGrid failed: {} does not hold a TSDFVoxelGrid.",
+                filename);
+        return false;
+    }
+    std::unordered_map<std::string, core::Dtype> attr_dtype_map;
+    for (const auto &it : tensors) {
+        if (it.first.compare(0, kAttrPrefix.size(), kAttrPrefix) == 0) {
+            attr_dtype_map[it.first.substr(kAttrPrefix.size())] =
+                    it.second.GetDtype();
+        }
+    }
+    const core::Tensor &keys = tensors.at("block_keys");
+    const core::Tensor &values = tensors.at("block_values");
+    const int64_t num_blocks = keys.GetLength();
+    geometry::TSDFVoxelGrid cpu_voxelgrid(
+            attr_dtype_map, tensors.at("voxel_size")[0].Item<float>(),
+            tensors.at("sdf_trunc")[0].Item<float>(),
+            tensors.at("block_resolution")[0].Item<int64_t>(),
+            std::max(tensors.at("block_count")[0].Item<int64_t>(), num_blocks),
+            core::Device("CPU:0"));
+    std::shared_ptr<core::Hashmap> hashmap = cpu_voxelgrid.GetBlockHashmap();
+    core::SizeVector value_shape = hashmap->GetValueTensor().GetShape();
+    value_shape[0] = num_blocks;
+    if (keys.GetShape() != core::SizeVector{num_blocks, 3} ||
+        keys.GetDtype() != core::Dtype::Int32 ||
+        values.GetShape() != value_shape ||
+        values.GetDtype() != core::Dtype::UInt8) {
+        utility::LogWarning(
+                "Read TSDFVoxelGrid failed: voxel blocks of {} do not match "
+                "the voxel grid parameters.",
+                filename);
+        return false;
+    }
+    if (num_blocks > 0) {
+        core::Tensor addrs, masks;
+        hashmap->Insert(keys, values, addrs, masks);
+    }
+    voxelgrid = cpu_voxelgrid;
+    return true;
+}
+
+bool WriteTSDFVoxelGrid(const std::string &filename,
+                        const geometry::TSDFVoxelGrid &voxelgrid) {
+    std::shared_ptr<core::Hashmap> hashmap = voxelgrid.GetBlockHashmap();
+    core::Tensor active_addrs;
+    hashmap->GetActiveIndices(active_addrs);
+    core::Tensor active_indices = active_addrs.To(core::Dtype::Int64);
+
+    std::unordered_map<std::string, core::Tensor> tensors{
+            {"voxel_size",
+             core::Tensor(std::vector<float>{voxelgrid.GetVoxelSize()}, {1},
+                          core::Dtype::Float32)},
+            {"sdf_trunc",
+             core::Tensor(std::vector<float>{voxelgrid.GetSDFTrunc()}, {1},
+                          core::Dtype::Float32)},
+            {"block_resolution",
+             core::Tensor(
+                     std::vector<int64_t>{voxelgrid.GetBlockResolution()},
+                     {1}, core::Dtype::Int64)},
+            {"block_count",
+             core::Tensor(std::vector<int64_t>{voxelgrid.GetBlockCount()},
+                          {1}, core::Dtype::Int64)},
+            {"block_keys", hashmap->GetKeyTensor().IndexGet({active_indices})},
+            {"block_values",
+             hashmap->GetValueTensor().IndexGet({active_indices})}};
+    for (const auto &it : voxelgrid.GetAttrDtypeMap()) {
+        tensors.emplace(kAttrPrefix + it.first, core::Tensor({0}, it.second));
+    }
+    return WriteTensorArchive(filename, "TSDFVoxelGrid", tensors);
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
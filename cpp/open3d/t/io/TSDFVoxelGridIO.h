@@ -0,0 +1,54 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+
+#include "open3d/t/geometry/TSDFVoxelGrid.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \brief Reads a TSDFVoxelGrid written by WriteTSDFVoxelGrid().
+///
+/// The voxel blocks are read from the memory mapped tensor archive, see
+/// ReadTensorArchive(), and inserted into the hashmap of a new CPU voxel grid
+/// in a single parallel pass.
+/// \return true if successful.
+bool ReadTSDFVoxelGrid(const std::string &filename,
+                       geometry::TSDFVoxelGrid &voxelgrid);
+
+/// \brief Writes the parameters and the active voxel blocks of a
+/// TSDFVoxelGrid to a tensor archive, see WriteTensorArchive().
+/// \return true if successful.
+bool WriteTSDFVoxelGrid(const std::string &filename,
+                        const geometry::TSDFVoxelGrid &voxelgrid);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
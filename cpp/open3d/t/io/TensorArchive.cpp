@@ -0,0 +1,306 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/TensorArchive.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Blob.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+// File layout, in the byte order of the host that wrote it:
+// - magic, version, byte order mark, type
+// - number of tensors, then for each tensor its name, dtype (code, byte size
+//   and name), shape, and the offset and size of its data in the file
+// - the data of the tensors, each of them starting at a multiple of
+//   kAlignment bytes
+// Strings are stored as their uint32_t length followed by their characters.
+constexpr char kMagic[8] = {'O', '3', 'D', 'T', 'E', 'N', 'S', 'R'};
+constexpr uint32_t kVersion = 1;
+constexpr uint32_t kByteOrderMark = 0x01020304;
+constexpr int64_t kAlignment = 64;
+
+struct TensorEntry {
+    std::string name;
+    core::Dtype dtype;
+    core::SizeVector shape;
+    int64_t offset;
+    int64_t byte_size;
+};
+
+int64_t Align(int64_t offset) {
+    return (offset + kAlignment - 1) / kAlignment * kAlignment;
+}
+
+template <typename T>
+void Append(std::vector<char> &header, const T &value) {
+    const char *bytes = reinterpret_cast<const char *>(&value);
+    header.insert(header.end(), bytes, bytes + sizeof(T));
+}
+
+void AppendString(std::vector<char> &header, const std::string &value) {
+    Append(header, uint32_t(value.size()));
+    header.insert(header.end(), value.begin(), value.end());
+}
+
+std::vector<char> CreateHeader(const std::string &type,
+                               const std::vector<TensorEntry> &entries) {
+    std::vector<char> header(kMagic, kMagic + sizeof(kMagic));
+    Append(header, kVersion);
+    Append(header, kByteOrderMark);
+    AppendString(header, type);
+    Append(header, uint32_t(entries.size()));
+    for (const TensorEntry &entry : entries) {
+        AppendString(header, entry.name);
+        Append(header, uint32_t(entry.dtype.GetDtypeCode()));
+        Append(header, entry.dtype.ByteSize());
+        AppendString(header, entry.dtype.ToString());
+        Append(header, uint32_t(entry.shape.size()));
+        for (int64_t dim : entry.shape) {
+            Append(header, dim);
+        }
+        Append(header, entry.offset);
+        Append(header, entry.byte_size);
+    }
+    return header;
+}
+
+/// Reads the header from the mapped file, failing instead of reading past its
+/// end.
+class HeaderParser {
+public:
+    HeaderParser(const char *data, int64_t size) : data_(data), size_(size) {}
+
+    template <typename T>
+    bool Read(T &value) {
+        if (pos_ + int64_t(sizeof(T)) > size_) {
+            return false;
+        }
+        std::memcpy(&value, data_ + pos_, sizeof(T));
+        pos_ += sizeof(T);
+        return true;
+    }
+
+    bool ReadString(std::string &value) {
+        uint32_t length;
+        if (!Read(length) || pos_ + int64_t(length) > size_) {
+            return false;
+        }
+        value.assign(data_ + pos_, length);
+        pos_ += length;
+        return true;
+    }
+
+    bool ReadEntry(TensorEntry &entry) {
+        uint32_t dtype_code, ndims;
+        int64_t dtype_byte_size;
+        std::string dtype_name;
+        if (!ReadString(entry.name) || !Read(dtype_code) ||
+            !Read(dtype_byte_size) || !ReadString(dtype_name) ||
+            dtype_name.size() >= 16 || !Read(ndims)) {
+            return false;
+        }
+        // Only the known dtypes are accepted, with their exact code, byte
+        // size and name.
+        const core::Dtype dtype(core::Dtype::DtypeCode(dtype_code),
+                                dtype_byte_size, dtype_name);
+        const std::vector<core::Dtype> known_dtypes = {
+                core::Dtype::Float16, core::Dtype::Float32,
+                core::Dtype::Float64, core::Dtype::Int8, core::Dtype::Int16,
+                core::Dtype::Int32, core::Dtype::Int64, core::Dtype::UInt8,
+                core::Dtype::UInt16, core::Dtype::UInt32, core::Dtype::Bool};
+        if (std::find(known_dtypes.begin(), known_dtypes.end(), dtype) ==
+            known_dtypes.end()) {
+            utility::LogWarning(
+                    "Read tensor archive failed: unknown dtype {} of tensor "
+                    "{}.",
+                    dtype_name, entry.name);
+            return false;
+        }
+        entry.dtype = dtype;
+        entry.shape.resize(ndims);
+        for (uint32_t i = 0; i < ndims; i++) {
+            if (!Read(entry.shape[i]) || entry.shape[i] < 0) {
+                return false;
+            }
+        }
+        return Read(entry.offset) && Read(entry.byte_size) &&
+               entry.byte_size ==
+                       entry.shape.NumElements() * dtype_byte_size &&
+               entry.offset >= 0 && entry.offset + entry.byte_size <= size_;
+    }
+
+private:
+    const char *data_;
+    int64_t size_;
+    int64_t pos_ = 0;
+};
+
+}  // namespace
+
+bool ReadTensorArchive(const std::string &filename,
+                       std::string &type,
+                       std::unordered_map<std::string, core::Tensor> &tensors) {
+    tensors.clear();
+    // The mapping is shared by the blobs of the tensors.
+    auto file = std::make_shared<utility::filesystem::MappedFile>();
+    if (!file->Open(filename, /*copy_on_write=*/true)) {
+        utility::LogWarning(
+                "Read tensor archive failed: unable to open file: {}",
+                filename);
+        return false;
+    }
+    HeaderParser parser(file->GetData(), file->GetFileSize());
+    char magic[sizeof(kMagic)];
+    uint32_t version, byte_order_mark, num_entries;
+    if (!parser.Read(magic) ||
+        std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+        !parser.Read(version) || !parser.Read(byte_order_mark) ||
+        !parser.ReadString(type) || !parser.Read(num_entries)) {
+        utility::LogWarning(
+                "Read tensor archive failed: {} is not a tensor archive.",
+                filename);
+        return false;
+    }
+    if (version != kVersion || byte_order_mark != kByteOrderMark) {
+        utility::LogWarning(
+                "Read tensor archive failed: unsupported version or byte "
+                "order in {}.",
+                filename);
+        return false;
+    }
+    std::vector<TensorEntry> entries(num_entries);
+    for (TensorEntry &entry : entries) {
+        if (!parser.ReadEntry(entry)) {
+            utility::LogWarning(
+                    "Read tensor archive failed: corrupted header in {}.",
+                    filename);
+            return false;
+        }
+    }
+
+    for (const TensorEntry &entry : entries) {
+        void *data_ptr = file->GetMutableData() + entry.offset;
+        auto blob = std::make_shared<core::Blob>(core::Device("CPU:0"),
+                                                 data_ptr, [file](void *) {});
+        tensors[entry.name] = core::Tensor(
+                entry.shape, core::shape_util::DefaultStrides(entry.shape),
+                data_ptr, entry.dtype, blob);
+    }
+    return true;
+}
+
+bool WriteTensorArchive(
+        const std::string &filename,
+        const std::string &type,
+        const std::unordered_map<std::string, core::Tensor> &tensors) {
+    // Sorted by name, so that the same tensors always give the same file.
+    std::map<std::string, core::Tensor> contiguous_tensors;
+    for (const auto &it : tensors) {
+        contiguous_tensors.emplace(
+                it.first,
+                it.second.To(core::Device("CPU:0")).Contiguous());
+    }
+    std::vector<TensorEntry> entries;
+    for (const auto &it : contiguous_tensors) {
+        const core::Tensor &tensor = it.second;
+        const int64_t byte_size =
+                tensor.NumElements() * tensor.GetDtype().ByteSize();
+        entries.push_back({it.first, tensor.GetDtype(), tensor.GetShape(), 0,
+                           byte_size});
+    }
+    // The header size does not depend on the offsets.
+    int64_t offset = Align(int64_t(CreateHeader(type, entries).size()));
+    for (TensorEntry &entry : entries) {
+        entry.offset = offset;
+        offset = Align(offset + entry.byte_size);
+    }
+    const std::vector<char> header = CreateHeader(type, entries);
+
+    // Tensors read from an existing archive at filename may still be views of
+    // its mapping, which must not be truncated. The archive is therefore
+    // written to a temporary file that replaces the existing one afterwards.
+    const std::string tmp_filename = filename + ".tmp";
+    FILE *file = utility::filesystem::FOpen(tmp_filename, "wb");
+    if (file == nullptr) {
+        utility::LogWarning(
+                "Write tensor archive failed: unable to open file: {}",
+                tmp_filename);
+        return false;
+    }
+    bool success = fwrite(header.data(), 1, header.size(), file) ==
+                   header.size();
+    int64_t pos = int64_t(header.size());
+    const std::vector<char> padding(kAlignment, 0);
+    auto entry = entries.begin();
+    for (const auto &it : contiguous_tensors) {
+        if (!success) {
+            break;
+        }
+        const size_t padding_size = size_t(entry->offset - pos);
+        success = fwrite(padding.data(), 1, padding_size, file) ==
+                          padding_size &&
+                  fwrite(it.second.GetDataPtr(), 1, size_t(entry->byte_size),
+                         file) == size_t(entry->byte_size);
+        pos = entry->offset + entry->byte_size;
+        ++entry;
+    }
+    if (fclose(file) != 0 || !success) {
+        utility::LogWarning(
+                "Write tensor archive failed: unable to write file: {}",
+                tmp_filename);
+        utility::filesystem::RemoveFile(tmp_filename);
+        return false;
+    }
+    // On Windows, rename() does not replace an existing file.
+    if (std::rename(tmp_filename.c_str(), filename.c_str()) != 0 &&
+        (!utility::filesystem::RemoveFile(filename) ||
+         std::rename(tmp_filename.c_str(), filename.c_str()) != 0)) {
+        utility::LogWarning(
+                "Write tensor archive failed: unable to replace file: {}",
+                filename);
+        utility::filesystem::RemoveFile(tmp_filename);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,74 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \brief Reads a tensor archive, the native binary snapshot format of the
+/// tensor geometries.
+///
+/// A tensor archive holds named tensors, stored contiguously at aligned
+/// offsets after a binary header. The file is memory mapped copy-on-write and
+/// the tensors are CPU views of the mapping: their data is neither parsed nor
+/// copied, and the pages are loaded lazily as the tensors are accessed.
+/// Writing to the tensors never changes the file. The file is unmapped once
+/// the last tensor is destroyed.
+///
+/// \param filename Path to the archive.
+/// \param type Set to the kind of content the archive was written with, e.g.
+/// "PointCloud".
+/// \param tensors Set to the tensors of the archive, by name.
+/// \return true if successful.
+bool ReadTensorArchive(const std::string &filename,
+                       std::string &type,
+                       std::unordered_map<std::string, core::Tensor> &tensors);
+
+/// \brief Writes the tensors as a tensor archive, see ReadTensorArchive().
+///
+/// Tensors on other devices are copied to the CPU first. An existing archive
+/// at filename is only replaced once the new one is complete. This lets it be
+/// overwritten while tensors read from it are in use, except on Windows, where
+/// the write fails in that case.
+/// \param filename Path to the archive.
+/// \param type Kind of content of the archive, e.g. "PointCloud".
+/// \param tensors Tensors to write, by name.
+/// \return true if successful.
+bool WriteTensorArchive(
+        const std::string &filename,
+        const std::string &type,
+        const std::unordered_map<std::string, core::Tensor> &tensors);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,91 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <string>
+#include <unordered_map>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/TensorArchive.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+bool ReadPointCloudFromO3DT(const std::string &filename,
+                            geometry::PointCloud &pointcloud,
+                            const ReadPointCloudOption &params) {
+    std::string type;
+    std::unordered_map<std::string, core::Tensor> tensors;
+    if (!ReadTensorArchive(filename, type, tensors)) {
+        return false;
+    }
+    if (type != "PointCloud" || tensors.count("points") == 0) {
+        utility::LogWarning(
+                "Read O3DT failed: {} does not hold a point cloud.", filename);
+        return false;
+    }
+    // The point attributes are views of the mapped file, so nothing is left
+    // to be read.
+    pointcloud = geometry::PointCloud(tensors);
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.Finish();
+    return true;
+}
+
+bool WritePointCloudToO3DT(const std::string &filename,
+                           const geometry::PointCloud &pointcloud,
+                           const WritePointCloudOption &params) {
+    const geometry::TensorMap &point_attr = pointcloud.GetPointAttr();
+    if (!pointcloud.HasPoints()) {
+        utility::LogWarning("Write O3DT failed: point cloud has no points.");
+        return false;
+    }
+    const int64_t num_points = pointcloud.GetPoints().GetLength();
+    for (const auto &it : point_attr) {
+        if (it.second.GetLength() != num_points) {
+            utility::LogWarning(
+                    "Write O3DT failed: Points ({}) and {} ({}) have "
+                    "different lengths.",
+                    num_points, it.first, it.second.GetLength());
+            return false;
+        }
+    }
+    utility::CountingProgressReporter reporter(params.update_progress);
+    if (!WriteTensorArchive(filename, "PointCloud",
+                            std::unordered_map<std::string, core::Tensor>(
+                                    point_attr.begin(), point_attr.end()))) {
+        return false;
+    }
+    reporter.Finish();
+    return true;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
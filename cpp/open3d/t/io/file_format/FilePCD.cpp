@@ -0,0 +1,1134 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <liblzf/lzf.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <sstream>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/FileFormatIO.h"
+#include "open3d/io/file_format/PCDHeader.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/PointCloudReader.h"
+#include "open3d/t/io/PointCloudWriter.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/ProgressReporters.h"
+
+// References for PCD file IO
+// http://pointclouds.org/documentation/tutorials/pcd_file_format.html
+// https://github.com/PointCloudLibrary/pcl/blob/master/io/src/pcd_io.cpp
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+using open3d::io::PCD_DATA_ASCII;
+using open3d::io::PCD_DATA_BINARY;
+using open3d::io::PCD_DATA_BINARY_COMPRESSED;
+using open3d::io::PCDHeader;
+using open3d::io::PCLPointField;
+
+/// A point cloud attribute and the field values of its columns.
+struct PCDAttribute {
+    std::string name;
+    core::Dtype dtype;
+    /// Field index and component in the field of each column.
+    std::vector<std::pair<int, int>> columns;
+    /// Packed rgb or rgba field, decoded into three UInt8 columns.
+    bool is_color = false;
+};
+
+/// Values of the fields of an attribute to write, as a contiguous tensor of the
+/// field type with one row per point.
+struct PCDFieldData {
+    core::Tensor data;
+    /// Index of the first field of the attribute in the header.
+    size_t first_field;
+    /// Number of fields of the attribute.
+    size_t num_fields;
+};
+
+/// Returns the Dtype of a PCD field type, or Undefined. 8 byte unsigned
+/// fields have no matching Dtype.
+core::Dtype GetDtype(char type, int size) {
+    if (type == 'F' && size == 4) {
+        return core::Dtype::Float32;
+    } else if (type == 'F' && size == 8) {
+        return core::Dtype::Float64;
+    } else if (type == 'I' && size == 1) {
+        return core::Dtype::Int8;
+    } else if (type == 'I' && size == 2) {
+        return core::Dtype::Int16;
+    } else if (type == 'I' && size == 4) {
+        return core::Dtype::Int32;
+    } else if (type == 'I' && size == 8) {
+        return core::Dtype::Int64;
+    } else if (type == 'U' && size == 1) {
+        return core::Dtype::UInt8;
+    } else if (type == 'U' && size == 2) {
+        return core::Dtype::UInt16;
+    } else if (type == 'U' && size == 4) {
+        return core::Dtype::UInt32;
+    } else {
+        return core::Dtype::Undefined;
+    }
+}
+
+/// Groups the fields of the header into point cloud attributes. x, y, z,
+/// normal_x, normal_y, normal_z and rgb(a) go to points, normals and colors,
+/// every other field to an attribute of the same name with one column per
+/// component.
+std::vector<PCDAttribute> GetAttributes(const PCDHeader &header) {
+    std::vector<PCDAttribute> attributes;
+    std::vector<bool> is_used(header.fields.size(), false);
+    auto find_field = [&](const std::string &name) {
+        for (size_t i = 0; i < header.fields.size(); i++) {
+            const PCLPointField &field = header.fields[i];
+            if (field.name == name && field.count == 1 &&
+                GetDtype(field.type, field.size) != core::Dtype::Undefined) {
+                return int(i);
+            }
+        }
+        return -1;
+    };
+
+    const std::vector<std::pair<std::string, std::vector<std::string>>>
+            base_attributes = {
+                    {"points", {"x", "y", "z"}},
+                    {"normals", {"normal_x", "normal_y", "normal_z"}}};
+    for (const auto &base_attribute : base_attributes) {
+        PCDAttribute attribute;
+        attribute.name = base_attribute.first;
+        for (const std::string &name : base_attribute.second) {
+            int index = find_field(name);
+            if (index >= 0) {
+                attribute.columns.emplace_back(index, 0);
+            }
+        }
+        if (attribute.columns.size() != 3) {
+            continue;
+        }
+        // Mixed field types are read as Float64.
+        attribute.dtype = core::Dtype::Float64;
+        const PCLPointField &field = header.fields[attribute.columns[0].first];
+        if (std::all_of(attribute.columns.begin(), attribute.columns.end(),
+                        [&](const std::pair<int, int> &column) {
+                            const PCLPointField &other =
+                                    header.fields[column.first];
+                            return other.type == field.type &&
+                                   other.size == field.size;
+                        })) {
+            attribute.dtype = GetDtype(field.type, field.size);
+        }
+        for (const auto &column : attribute.columns) {
+            is_used[column.first] = true;
+        }
+        attributes.push_back(attribute);
+    }
+    for (size_t i = 0; i < header.fields.size(); i++) {
+        const PCLPointField &field = header.fields[i];
+        if ((field.name == "rgb" || field.name == "rgba") && field.size == 4 &&
+            field.count == 1) {
+            PCDAttribute attribute;
+            attribute.name = "colors";
+            attribute.dtype = core::Dtype::UInt8;
+            attribute.columns = {{int(i), 0}, {int(i), 0}, {int(i), 0}};
+            attribute.is_color = true;
+            attributes.push_back(attribute);
+            is_used[i] = true;
+            break;
+        }
+    }
+    for (size_t i = 0; i < header.fields.size(); i++) {
+        const PCLPointField &field = header.fields[i];
+        // PCL names padding fields "_".
+        if (is_used[i] || field.name == "_") {
+            continue;
+        }
+        PCDAttribute attribute;
+        attribute.name = field.name;
+        attribute.dtype = GetDtype(field.type, field.size);
+        if (attribute.dtype == core::Dtype::Undefined) {
+            utility::LogWarning(
+                    "Read PCD warning: skipping field \"{}\", unsupported "
+                    "type {} of size {}.",
+                    field.name, field.type, field.size);
+            continue;
+        }
+        for (int c = 0; c < field.count; c++) {
+            attribute.columns.emplace_back(int(i), c);
+        }
+        attributes.push_back(attribute);
+    }
+    return attributes;
+}
+
+/// Converts num values of type S at src, src_stride bytes apart, to every
+/// data_stride-th value of data.
+template <typename T, typename S>
+void DecodeValues(const char *src,
+                  int64_t src_stride,
+                  int64_t num,
+                  T *data,
+                  int64_t data_stride) {
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num; i++) {
+        S value;
+        std::memcpy(&value, src + i * src_stride, sizeof(S));
+        data[i * data_stride] = static_cast<T>(value);
+    }
+}
+
+template <typename T>
+void DecodeBinaryColumn(const PCLPointField &field,
+                        const char *src,
+                        int64_t src_stride,
+                        int64_t num,
+                        T *data,
+                        int64_t data_stride) {
+    const int type_size = field.type * 16 + field.size;
+    switch (type_size) {
+        case 'F' * 16 + 4:
+            DecodeValues<T, float>(src, src_stride, num, data, data_stride);
+            break;
+        case 'F' * 16 + 8:
+            DecodeValues<T, double>(src, src_stride, num, data, data_stride);
+            break;
+        case 'I' * 16 + 1:
+            DecodeValues<T, int8_t>(src, src_stride, num, data, data_stride);
+            break;
+        case 'I' * 16 + 2:
+            DecodeValues<T, int16_t>(src, src_stride, num, data, data_stride);
+            break;
+        case 'I' * 16 + 4:
+            DecodeValues<T, int32_t>(src, src_stride, num, data, data_stride);
+            break;
+        case 'I' * 16 + 8:
+            DecodeValues<T, int64_t>(src, src_stride, num, data, data_stride);
+            break;
+        case 'U' * 16 + 1:
+            DecodeValues<T, uint8_t>(src, src_stride, num, data, data_stride);
+            break;
+        case 'U' * 16 + 2:
+            DecodeValues<T, uint16_t>(src, src_stride, num, data,
+                                      data_stride);
+            break;
+        case 'U' * 16 + 4:
+            DecodeValues<T, uint32_t>(src, src_stride, num, data,
+                                      data_stride);
+            break;
+        default:
+            break;
+    }
+}
+
+/// Decodes the attributes from the binary payload. Binary records are stored
+/// point by point, binary_compressed ones field by field.
+geometry::PointCloud DecodeBinaryData(
+        const PCDHeader &header,
+        const std::vector<PCDAttribute> &attributes,
+        const char *buffer,
+        utility::CountingProgressReporter &reporter) {
+    const int64_t num_points = header.points;
+    const bool is_compressed =
+            header.datatype == PCD_DATA_BINARY_COMPRESSED;
+    geometry::PointCloud pointcloud;
+    int64_t num_read = 0;
+    for (const PCDAttribute &attribute : attributes) {
+        const int64_t num_columns = int64_t(attribute.columns.size());
+        core::Tensor data({num_points, num_columns}, attribute.dtype);
+        for (int64_t j = 0; j < num_columns; j++) {
+            const PCLPointField &field =
+                    header.fields[attribute.columns[j].first];
+            const int64_t component = attribute.columns[j].second;
+            const char *src;
+            int64_t src_stride;
+            if (is_compressed) {
+                src = buffer + int64_t(field.offset) * num_points +
+                      component * field.size;
+                src_stride = int64_t(field.size) * field.count;
+            } else {
+                src = buffer + field.offset + component * field.size;
+                src_stride = header.pointsize;
+            }
+            if (attribute.is_color) {
+                // Color data is packed in BGR order.
+                DecodeValues<uint8_t, uint8_t>(src + 2 - j, src_stride,
+                                               num_points,
+                                               data.GetDataPtr<uint8_t>() + j,
+                                               num_columns);
+                continue;
+            }
+            DISPATCH_DTYPE_TO_TEMPLATE(attribute.dtype, [&]() {
+                DecodeBinaryColumn(field, src, src_stride, num_points,
+                                   data.GetDataPtr<scalar_t>() + j,
+                                   num_columns);
+            });
+        }
+        pointcloud.SetPointAttr(attribute.name, data);
+        num_read += num_points;
+        reporter.Update(num_read);
+    }
+    return pointcloud;
+}
+
+template <typename T>
+T ParseASCIIValue(const char *str, char type) {
+    char *end;
+    if (type == 'F') {
+        return static_cast<T>(std::strtod(str, &end));
+    } else if (type == 'U') {
+        return static_cast<T>(std::strtoull(str, &end, 0));
+    } else {
+        return static_cast<T>(std::strtoll(str, &end, 0));
+    }
+}
+
+/// Parses the values of the attribute on the given lines of text, where
+/// value_offsets holds the offsets of the values of each line.
+template <typename T>
+void ParseASCIIAttribute(const PCDHeader &header,
+                         const PCDAttribute &attribute,
+                         const std::string &text,
+                         const std::vector<int64_t> &value_offsets,
+                         const std::vector<int64_t> &lines,
+                         T *data) {
+    const int64_t num_points = int64_t(lines.size());
+    const int64_t num_values = header.elementnum;
+    const int64_t num_columns = int64_t(attribute.columns.size());
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_points; i++) {
+        const int64_t *offsets = value_offsets.data() + lines[i] * num_values;
+        for (int64_t j = 0; j < num_columns; j++) {
+            const PCLPointField &field =
+                    header.fields[attribute.columns[j].first];
+            const char *str =
+                    text.c_str() +
+                    offsets[field.count_offset + attribute.columns[j].second];
+            if (attribute.is_color) {
+                // Color data is packed in BGR order.
+                uint8_t bgra[4] = {0, 0, 0, 0};
+                if (field.type == 'F') {
+                    float value = std::strtof(str, nullptr);
+                    std::memcpy(bgra, &value, 4);
+                } else {
+                    uint32_t value = ParseASCIIValue<uint32_t>(str, field.type);
+                    std::memcpy(bgra, &value, 4);
+                }
+                data[i * num_columns + j] = T(bgra[2 - j]);
+            } else {
+                data[i * num_columns + j] =
+                        ParseASCIIValue<T>(str, field.type);
+            }
+        }
+    }
+}
+
+/// Parses the ASCII payload in text. Each line holds the values of one point,
+/// lines with less values are skipped.
+geometry::PointCloud ParseASCIIData(
+        const std::string &text,
+        const PCDHeader &header,
+        const std::vector<PCDAttribute> &attributes,
+        utility::CountingProgressReporter &reporter) {
+    std::vector<int64_t> line_begins;
+    for (size_t pos = 0; pos < text.size();) {
+        size_t line_end = text.find('\n', pos);
+        if (line_end == std::string::npos) {
+            line_end = text.size();
+        }
+        line_begins.push_back(int64_t(pos));
+        pos = line_end + 1;
+    }
+
+    // Offsets of the values of each line, found in parallel.
+    const int64_t num_lines = int64_t(line_begins.size());
+    const int64_t num_values = header.elementnum;
+    std::vector<int64_t> value_offsets(num_lines * num_values);
+    std::vector<uint8_t> is_valid(num_lines, 0);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_lines; i++) {
+        const char *line = text.c_str() + line_begins[i];
+        int64_t num_found = 0;
+        const char *c = line;
+        while (num_found < num_values) {
+            while (*c == ' ' || *c == '\t' || *c == '\r') {
+                c++;
+            }
+            if (*c == '\n' || *c == '\0') {
+                break;
+            }
+            value_offsets[i * num_values + num_found++] = c - text.c_str();
+            while (*c != ' ' && *c != '\t' && *c != '\r' && *c != '\n' &&
+                   *c != '\0') {
+                c++;
+            }
+        }
+        is_valid[i] = num_found == num_values;
+    }
+    std::vector<int64_t> lines;
+    for (int64_t i = 0; i < num_lines && int64_t(lines.size()) < header.points;
+         i++) {
+        if (is_valid[i]) {
+            lines.push_back(i);
+        }
+    }
+
+    const int64_t num_points = int64_t(lines.size());
+    geometry::PointCloud pointcloud;
+    int64_t num_read = 0;
+    for (const PCDAttribute &attribute : attributes) {
+        const int64_t num_columns = int64_t(attribute.columns.size());
+        core::Tensor data({num_points, num_columns}, attribute.dtype);
+        DISPATCH_DTYPE_TO_TEMPLATE(attribute.dtype, [&]() {
+            ParseASCIIAttribute(header, attribute, text, value_offsets, lines,
+                                data.GetDataPtr<scalar_t>());
+        });
+        pointcloud.SetPointAttr(attribute.name, data);
+        num_read += num_points;
+        reporter.Update(num_read);
+    }
+    return pointcloud;
+}
+
+/// Reads the ASCII payload up to the end of the file.
+geometry::PointCloud ReadASCIIData(
+        FILE *file,
+        const PCDHeader &header,
+        const std::vector<PCDAttribute> &attributes,
+        utility::CountingProgressReporter &reporter) {
+    std::string text;
+    char read_buffer[DEFAULT_IO_BUFFER_SIZE];
+    size_t read_size;
+    while ((read_size = fread(read_buffer, 1, sizeof(read_buffer), file)) >
+           0) {
+        text.append(read_buffer, read_size);
+    }
+    return ParseASCIIData(text, header, attributes, reporter);
+}
+
+bool ReadPCDData(FILE *file,
+                 const PCDHeader &header,
+                 geometry::PointCloud &pointcloud,
+                 const ReadPointCloudOption &params) {
+    const std::vector<PCDAttribute> attributes = GetAttributes(header);
+    if (attributes.empty() || attributes[0].name != "points") {
+        utility::LogWarning(
+                "Read PCD failed: fields for point data are not complete.");
+        return false;
+    }
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(int64_t(header.points) * int64_t(attributes.size()));
+
+    const int64_t data_size = int64_t(header.points) * header.pointsize;
+    if (header.datatype == PCD_DATA_ASCII) {
+        pointcloud = ReadASCIIData(file, header, attributes, reporter);
+    } else if (header.datatype == PCD_DATA_BINARY) {
+        std::vector<char> buffer(data_size);
+        if (fread(buffer.data(), 1, data_size, file) != size_t(data_size)) {
+            utility::LogWarning("Read PCD failed: unable to read data.");
+            return false;
+        }
+        pointcloud =
+                DecodeBinaryData(header, attributes, buffer.data(), reporter);
+    } else {
+        std::uint32_t compressed_size;
+        std::uint32_t uncompressed_size;
+        if (fread(&compressed_size, sizeof(compressed_size), 1, file) != 1 ||
+            fread(&uncompressed_size, sizeof(uncompressed_size), 1, file) !=
+                    1) {
+            utility::LogWarning("Read PCD failed: unable to read data.");
+            return false;
+        }
+        if (int64_t(uncompressed_size) != data_size) {
+            utility::LogWarning(
+                    "Read PCD failed: {} bytes of uncompressed data, but {} "
+                    "points of {} bytes.",
+                    uncompressed_size, header.points, header.pointsize);
+            return false;
+        }
+        std::vector<char> buffer_compressed(compressed_size);
+        if (fread(buffer_compressed.data(), 1, compressed_size, file) !=
+            compressed_size) {
+            utility::LogWarning("Read PCD failed: unable to read data.");
+            return false;
+        }
+        // The payload is a single LZF block, which is decompressed serially.
+        std::vector<char> buffer(data_size);
+        if (lzf_decompress(buffer_compressed.data(), compressed_size,
+                           buffer.data(), uncompressed_size) !=
+            uncompressed_size) {
+            utility::LogWarning("Read PCD failed: uncompression failed.");
+            return false;
+        }
+        pointcloud =
+                DecodeBinaryData(header, attributes, buffer.data(), reporter);
+    }
+    reporter.Finish();
+    return true;
+}
+
+bool GetPCDType(const core::Dtype &dtype, char &type, int &size) {
+    if (dtype == core::Dtype::Float32) {
+        type = 'F';
+    } else if (dtype == core::Dtype::Float64) {
+        type = 'F';
+    } else if (dtype == core::Dtype::Int8 || dtype == core::Dtype::Int16 ||
+               dtype == core::Dtype::Int32 || dtype == core::Dtype::Int64) {
+        type = 'I';
+    } else if (dtype == core::Dtype::UInt8 || dtype == core::Dtype::UInt16 ||
+               dtype == core::Dtype::UInt32) {
+        type = 'U';
+    } else {
+        return false;
+    }
+    size = int(dtype.ByteSize());
+    return true;
+}
+
+/// Packs colors into the rgb field in BGR order, as PCL does.
+core::Tensor PackColors(const core::Tensor &colors) {
+    core::Tensor rgb;
+    if (colors.GetDtype() == core::Dtype::UInt8) {
+        rgb = colors.Contiguous();
+    } else {
+        // Other colors are in [0, 1], as in the legacy point cloud.
+        core::Tensor values = colors.To(core::Dtype::Float64).Contiguous();
+        rgb = core::Tensor(values.GetShape(), core::Dtype::UInt8);
+        const double *values_ptr = values.GetDataPtr<double>();
+        uint8_t *rgb_ptr = rgb.GetDataPtr<uint8_t>();
+        const int64_t num_values = values.NumElements();
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < num_values; i++) {
+            rgb_ptr[i] = uint8_t(std::round(
+                    std::min(1., std::max(0., values_ptr[i])) * 255.));
+        }
+    }
+    const int64_t num_points = rgb.GetLength();
+    core::Tensor packed({num_points, 1}, core::Dtype::Float32);
+    const uint8_t *rgb_ptr = rgb.GetDataPtr<uint8_t>();
+    float *packed_ptr = packed.GetDataPtr<float>();
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_points; i++) {
+        const uint8_t bgra[4] = {rgb_ptr[3 * i + 2], rgb_ptr[3 * i + 1],
+                                 rgb_ptr[3 * i], 0};
+        std::memcpy(packed_ptr + i, bgra, 4);
+    }
+    return packed;
+}
+
+/// Generates the header and the values of the fields, one per attribute.
+bool GenerateHeader(const geometry::PointCloud &pointcloud,
+                    bool write_ascii,
+                    bool compressed,
+                    PCDHeader &header,
+                    std::vector<PCDFieldData> &field_data) {
+    if (pointcloud.IsEmpty() || pointcloud.GetPoints().GetLength() == 0) {
+        utility::LogWarning("Write PCD failed: point cloud has 0 points.");
+        return false;
+    }
+    const int64_t num_points = pointcloud.GetPoints().GetLength();
+    const core::Device host("CPU:0");
+    header.version = "0.7";
+    header.width = int(num_points);
+    header.height = 1;
+    header.points = header.width;
+    header.fields.clear();
+    header.elementnum = 0;
+    header.pointsize = 0;
+    field_data.clear();
+
+    // Base attributes have one field per column, other attributes one field
+    // with a value per column.
+    auto add_attribute = [&](const std::string &key,
+                             const std::vector<std::string> &names) {
+        core::Tensor data = pointcloud.GetPointAttr(key).To(host);
+        if (data.GetLength() != num_points) {
+            utility::LogWarning(
+                    "Write PCD failed: Points ({}) and {} ({}) have different "
+                    "lengths.",
+                    num_points, key, data.GetLength());
+            return false;
+        }
+        PCLPointField field;
+        if (key == "colors") {
+            if (data.NumElements() != 3 * num_points) {
+                utility::LogWarning(
+                        "Write PCD failed: colors must have 3 values per "
+                        "point.");
+                return false;
+            }
+            data = PackColors(data);
+            field.type = 'F';
+            field.size = 4;
+        } else {
+            // PCD has no bool or half precision type.
+            if (data.GetDtype() == core::Dtype::Bool) {
+                data = data.To(core::Dtype::UInt8);
+            } else if (data.GetDtype() == core::Dtype::Float16) {
+                data = data.To(core::Dtype::Float32);
+            }
+            if (!GetPCDType(data.GetDtype(), field.type, field.size)) {
+                utility::LogWarning(
+                        "Write PCD failed: unsupported dtype {} of {}.",
+                        data.GetDtype().ToString(), key);
+                return false;
+            }
+        }
+        const int64_t num_values = data.NumElements() / num_points;
+        if (num_values == 0 ||
+            (names.size() > 1 && num_values != int64_t(names.size()))) {
+            utility::LogWarning(
+                    "Write PCD failed: {} has {} values per point.", key,
+                    num_values);
+            return false;
+        }
+        field_data.push_back({data.Contiguous(), header.fields.size(),
+                              names.size()});
+        for (const std::string &name : names) {
+            field.name = name;
+            field.count = int(num_values / int64_t(names.size()));
+            field.count_offset = header.elementnum;
+            field.offset = header.pointsize;
+            header.fields.push_back(field);
+            header.elementnum += field.count;
+            header.pointsize += field.count * field.size;
+        }
+        return true;
+    };
+
+    if (!add_attribute("points", {"x", "y", "z"})) {
+        return false;
+    }
+    if (pointcloud.HasPointNormals() &&
+        !add_attribute("normals", {"normal_x", "normal_y", "normal_z"})) {
+        return false;
+    }
+    if (pointcloud.HasPointColors() && !add_attribute("colors", {"rgb"})) {
+        return false;
+    }
+    // Other attributes are sorted by name, so that point clouds with the same
+    // attributes get the same fields.
+    std::vector<std::string> other_keys;
+    for (const auto &it : pointcloud.GetPointAttr()) {
+        if (it.first != "points" && it.first != "colors" &&
+            it.first != "normals") {
+            other_keys.push_back(it.first);
+        }
+    }
+    std::sort(other_keys.begin(), other_keys.end());
+    for (const std::string &key : other_keys) {
+        if (!add_attribute(key, {key})) {
+            return false;
+        }
+    }
+
+    if (write_ascii) {
+        header.datatype = PCD_DATA_ASCII;
+    } else {
+        if (compressed) {
+            header.datatype = PCD_DATA_BINARY_COMPRESSED;
+        } else {
+            header.datatype = PCD_DATA_BINARY;
+        }
+    }
+    return true;
+}
+
+/// Formats the value of the given field type at data.
+int FormatASCIIValue(const char *data,
+                     const PCLPointField &field,
+                     char *buffer,
+                     size_t buffer_size) {
+    if (field.type == 'F' && field.size == 4) {
+        float value;
+        std::memcpy(&value, data, sizeof(value));
+        return snprintf(buffer, buffer_size, "%.10g", value);
+    } else if (field.type == 'F') {
+        double value;
+        std::memcpy(&value, data, sizeof(value));
+        return snprintf(buffer, buffer_size, "%.17g", value);
+    } else if (field.type == 'U' && field.size == 1) {
+        return snprintf(buffer, buffer_size, "%u", unsigned(*data & 0xff));
+    } else if (field.type == 'U' && field.size == 2) {
+        uint16_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return snprintf(buffer, buffer_size, "%u", unsigned(value));
+    } else if (field.type == 'U') {
+        uint32_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return snprintf(buffer, buffer_size, "%u", unsigned(value));
+    } else if (field.size == 1) {
+        int8_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return snprintf(buffer, buffer_size, "%d", int(value));
+    } else if (field.size == 2) {
+        int16_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return snprintf(buffer, buffer_size, "%d", int(value));
+    } else if (field.size == 4) {
+        int32_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return snprintf(buffer, buffer_size, "%d", value);
+    } else {
+        int64_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return snprintf(buffer, buffer_size, "%lld", (long long)value);
+    }
+}
+
+bool WritePCDData(FILE *file,
+                  const PCDHeader &header,
+                  const std::vector<PCDFieldData> &field_data,
+                  const WritePointCloudOption &params) {
+    const int64_t num_points = header.points;
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(num_points);
+
+    // Copies the values of the fields to the records, which are stored point
+    // by point, or field by field if is_compressed.
+    auto pack = [&](char *buffer, bool is_compressed) {
+        for (const PCDFieldData &attribute : field_data) {
+            const char *src =
+                    static_cast<const char *>(attribute.data.GetDataPtr());
+            for (size_t f = 0; f < attribute.num_fields; f++) {
+                const PCLPointField &field =
+                        header.fields[attribute.first_field + f];
+                const int64_t value_size = int64_t(field.count) * field.size;
+                const int64_t src_stride = attribute.num_fields * value_size;
+                char *dst = buffer + int64_t(field.offset) *
+                                             (is_compressed ? num_points : 1);
+                const int64_t dst_stride =
+                        is_compressed ? value_size : header.pointsize;
+#pragma omp parallel for schedule(static)
+                for (int64_t i = 0; i < num_points; i++) {
+                    std::memcpy(dst + i * dst_stride,
+                                src + f * value_size + i * src_stride,
+                                value_size);
+                }
+            }
+        }
+    };
+
+    const int64_t data_size = num_points * header.pointsize;
+    if (header.datatype == PCD_DATA_ASCII) {
+        // Points are formatted in parallel blocks, written in order.
+        const int64_t points_per_block = 4096;
+        const int64_t num_blocks =
+                (num_points + points_per_block - 1) / points_per_block;
+        std::vector<char> records(data_size);
+        pack(records.data(), false);
+        std::vector<std::string> blocks(num_blocks);
+#pragma omp parallel for schedule(static)
+        for (int64_t b = 0; b < num_blocks; b++) {
+            char value_buffer[64];
+            std::string &block = blocks[b];
+            const int64_t end =
+                    std::min((b + 1) * points_per_block, num_points);
+            for (int64_t i = b * points_per_block; i < end; i++) {
+                const char *record = records.data() + i * header.pointsize;
+                bool is_first = true;
+                for (const PCLPointField &field : header.fields) {
+                    for (int c = 0; c < field.count; c++) {
+                        if (!is_first) {
+                            block.push_back(' ');
+                        }
+                        is_first = false;
+                        int length = FormatASCIIValue(
+                                record + field.offset + c * field.size, field,
+                                value_buffer, sizeof(value_buffer));
+                        block.append(value_buffer, length);
+                    }
+                }
+                block.push_back('\n');
+            }
+        }
+        for (int64_t b = 0; b < num_blocks; b++) {
+            if (fwrite(blocks[b].data(), 1, blocks[b].size(), file) !=
+                blocks[b].size()) {
+                return false;
+            }
+            reporter.Update(std::min((b + 1) * points_per_block, num_points));
+        }
+    } else if (header.datatype == PCD_DATA_BINARY) {
+        std::vector<char> records(data_size);
+        pack(records.data(), false);
+        if (fwrite(records.data(), 1, data_size, file) != size_t(data_size)) {
+            return false;
+        }
+    } else {
+        std::vector<char> buffer(data_size);
+        pack(buffer.data(), true);
+        // The payload must be a single LZF block, which is compressed
+        // serially.
+        std::vector<char> buffer_compressed(data_size * 2);
+        std::uint32_t size_compressed = lzf_compress(
+                buffer.data(), (unsigned int)data_size,
+                buffer_compressed.data(), (unsigned int)data_size * 2);
+        if (size_compressed == 0) {
+            utility::LogWarning("Write PCD failed: unable to compress data.");
+            return false;
+        }
+        utility::LogDebug("PCD data of {} bytes compressed into {} bytes.",
+                          data_size, size_compressed);
+        std::uint32_t size_uncompressed = std::uint32_t(data_size);
+        if (fwrite(&size_compressed, sizeof(size_compressed), 1, file) != 1 ||
+            fwrite(&size_uncompressed, sizeof(size_uncompressed), 1, file) !=
+                    1 ||
+            fwrite(buffer_compressed.data(), 1, size_compressed, file) !=
+                    size_compressed) {
+            return false;
+        }
+    }
+    reporter.Finish();
+    return true;
+}
+
+}  // namespace
+
+bool ReadPointCloudFromPCD(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params) {
+    PCDHeader header;
+    FILE *file = utility::filesystem::FOpen(filename.c_str(), "rb");
+    if (file == NULL) {
+        utility::LogWarning("Read PCD failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    if (!open3d::io::ReadPCDHeader(file, header)) {
+        utility::LogWarning("Read PCD failed: unable to parse header.");
+        fclose(file);
+        return false;
+    }
+    if (!ReadPCDData(file, header, pointcloud, params)) {
+        utility::LogWarning("Read PCD failed: unable to read data.");
+        fclose(file);
+        return false;
+    }
+    fclose(file);
+    return true;
+}
+
+bool WritePointCloudToPCD(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const WritePointCloudOption &params) {
+    PCDHeader header;
+    std::vector<PCDFieldData> field_data;
+    if (!GenerateHeader(pointcloud, bool(params.write_ascii),
+                        bool(params.compressed), header, field_data)) {
+        return false;
+    }
+    FILE *file = utility::filesystem::FOpen(filename.c_str(), "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write PCD failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    if (!open3d::io::WritePCDHeader(file, header)) {
+        utility::LogWarning("Write PCD failed: unable to write header.");
+        fclose(file);
+        return false;
+    }
+    if (!WritePCDData(file, header, field_data, params)) {
+        utility::LogWarning("Write PCD failed: unable to write data.");
+        fclose(file);
+        return false;
+    }
+    fclose(file);
+    return true;
+}
+
+/// Reads ascii and binary PCD files. binary_compressed files store the values
+/// field by field in a single LZF block, so they can only be read as a whole.
+class PCDPointCloudReader : public PointCloudReader {
+public:
+    bool IsOpened() const override { return is_opened_; }
+
+    bool IsEOF() const override {
+        return !is_opened_ || is_eof_ || num_read_ >= header_.points;
+    }
+
+    bool Open(const std::string &filename) override {
+        Close();
+        if (!file_.Open(filename, "rb")) {
+            utility::LogWarning("Read PCD failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        if (!open3d::io::ReadPCDHeader(file_.GetFILE(), header_)) {
+            utility::LogWarning("Read PCD failed: unable to parse header.");
+            file_.Close();
+            return false;
+        }
+        if (header_.datatype == PCD_DATA_BINARY_COMPRESSED) {
+            utility::LogWarning(
+                    "Read PCD failed: binary_compressed files cannot be read "
+                    "in chunks.");
+            file_.Close();
+            return false;
+        }
+        attributes_ = GetAttributes(header_);
+        if (attributes_.empty() || attributes_[0].name != "points") {
+            utility::LogWarning(
+                    "Read PCD failed: fields for point data are not complete.");
+            file_.Close();
+            return false;
+        }
+        is_opened_ = true;
+        return true;
+    }
+
+    void Close() override {
+        file_.Close();
+        is_opened_ = false;
+        is_eof_ = false;
+        header_ = PCDHeader();
+        attributes_.clear();
+        num_read_ = 0;
+    }
+
+    int64_t GetNumPoints() const override {
+        return is_opened_ ? header_.points : 0;
+    }
+
+    geometry::PointCloud NextChunk(int64_t chunk_size) override {
+        geometry::PointCloud pointcloud;
+        if (IsEOF() || chunk_size <= 0) {
+            return pointcloud;
+        }
+        PCDHeader header = header_;
+        header.points = int(std::min(chunk_size, header_.points - num_read_));
+        utility::CountingProgressReporter reporter(nullptr);
+        if (header.datatype == PCD_DATA_BINARY) {
+            const int64_t data_size = int64_t(header.points) * header.pointsize;
+            std::vector<char> buffer(data_size);
+            if (file_.ReadData(buffer.data(), data_size) !=
+                size_t(data_size)) {
+                utility::LogWarning("Read PCD failed: unable to read data.");
+                is_eof_ = true;
+                return pointcloud;
+            }
+            pointcloud = DecodeBinaryData(header, attributes_, buffer.data(),
+                                          reporter);
+        } else {
+            // Lines with less values are skipped, as in ReadPointCloud().
+            std::string text;
+            int num_lines = 0;
+            const char *line;
+            while (num_lines < header.points &&
+                   (line = file_.ReadLine()) != nullptr) {
+                if (CountASCIIValues(line, header.elementnum) ==
+                    header.elementnum) {
+                    text += line;
+                    if (text.back() != '\n') {
+                        text.push_back('\n');
+                    }
+                    num_lines++;
+                }
+            }
+            if (num_lines < header.points) {
+                is_eof_ = true;
+                if (num_lines == 0) {
+                    return pointcloud;
+                }
+                header.points = num_lines;
+            }
+            pointcloud = ParseASCIIData(text, header, attributes_, reporter);
+        }
+        num_read_ += header.points;
+        return pointcloud;
+    }
+
+private:
+    /// Counts the values of the line, up to max_values.
+    static int CountASCIIValues(const char *line, int max_values) {
+        int num_values = 0;
+        const char *c = line;
+        while (num_values < max_values) {
+            while (*c == ' ' || *c == '\t' || *c == '\r') {
+                c++;
+            }
+            if (*c == '\n' || *c == '\0') {
+                break;
+            }
+            num_values++;
+            while (*c != ' ' && *c != '\t' && *c != '\r' && *c != '\n' &&
+                   *c != '\0') {
+                c++;
+            }
+        }
+        return num_values;
+    }
+
+    utility::filesystem::CFile file_;
+    bool is_opened_ = false;
+    /// Set if the file ends before the number of points in the header.
+    bool is_eof_ = false;
+    PCDHeader header_;
+    std::vector<PCDAttribute> attributes_;
+    int64_t num_read_ = 0;
+};
+
+/// Writes binary PCD files. WIDTH and POINTS in the header are written with a
+/// fixed width, so that they can be updated when the file is closed.
+class PCDPointCloudWriter : public PointCloudWriter {
+public:
+    ~PCDPointCloudWriter() override { Close(); }
+
+    bool IsOpened() const override { return is_opened_; }
+
+    bool Open(const std::string &filename) override {
+        Close();
+        if (!file_.Open(filename, "wb")) {
+            utility::LogWarning("Write PCD failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        filename_ = filename;
+        is_opened_ = true;
+        is_header_written_ = false;
+        header_ = PCDHeader();
+        num_points_ = 0;
+        return true;
+    }
+
+    bool Close() override {
+        if (!IsOpened()) {
+            return true;
+        }
+        bool success = true;
+        if (!is_header_written_) {
+            // Nothing was written, the file gets the fields of an empty point
+            // cloud.
+            std::vector<PCDFieldData> field_data;
+            GenerateHeader(geometry::PointCloud(
+                                   core::Tensor::Zeros({1, 3},
+                                                       core::Dtype::Float32)),
+                           false, false, header_, field_data);
+        }
+        header_.width = int(num_points_);
+        header_.points = int(num_points_);
+        success = fseek(file_.GetFILE(), 0, SEEK_SET) == 0 &&
+                  open3d::io::WritePCDHeader(file_.GetFILE(), header_,
+                                             kCountWidth) &&
+                  fflush(file_.GetFILE()) == 0;
+        if (!success) {
+            utility::LogWarning("Write PCD failed: unable to write file: {}",
+                                filename_);
+        }
+        file_.Close();
+        is_opened_ = false;
+        return success;
+    }
+
+    int64_t GetNumPoints() const override { return num_points_; }
+
+    bool WriteChunk(const geometry::PointCloud &chunk) override {
+        if (!IsOpened()) {
+            utility::LogWarning("Write PCD failed: file is not opened.");
+            return false;
+        }
+        PCDHeader header;
+        std::vector<PCDFieldData> field_data;
+        if (!GenerateHeader(chunk, false, false, header, field_data)) {
+            return false;
+        }
+        if (num_points_ + header.points > std::numeric_limits<int>::max()) {
+            utility::LogWarning(
+                    "Write PCD failed: more than {} points.",
+                    std::numeric_limits<int>::max());
+            return false;
+        }
+        if (!is_header_written_) {
+            header_ = header;
+            if (!open3d::io::WritePCDHeader(file_.GetFILE(), header_,
+                                            kCountWidth)) {
+                utility::LogWarning(
+                        "Write PCD failed: unable to write header.");
+                return false;
+            }
+            is_header_written_ = true;
+        } else if (!std::equal(header.fields.begin(), header.fields.end(),
+                               header_.fields.begin(), header_.fields.end(),
+                               [](const PCLPointField &a,
+                                  const PCLPointField &b) {
+                                   return a.name == b.name &&
+                                          a.type == b.type &&
+                                          a.size == b.size &&
+                                          a.count == b.count;
+                               })) {
+            utility::LogWarning(
+                    "Write PCD failed: the chunk has other attributes or "
+                    "dtypes than the first chunk.");
+            return false;
+        }
+        if (!WritePCDData(file_.GetFILE(), header, field_data,
+                          WritePointCloudOption())) {
+            utility::LogWarning("Write PCD failed: unable to write file: {}",
+                                filename_);
+            return false;
+        }
+        num_points_ += header.points;
+        return true;
+    }
+
+private:
+    /// Digits of WIDTH and POINTS, enough for any int.
+    static constexpr int kCountWidth = 10;
+
+    utility::filesystem::CFile file_;
+    bool is_opened_ = false;
+    bool is_header_written_ = false;
+    std::string filename_;
+    PCDHeader header_;
+    int64_t num_points_ = 0;
+};
+
+std::unique_ptr<PointCloudReader> CreatePointCloudReaderPCD() {
+    return std::make_unique<PCDPointCloudReader>();
+}
+
+std::unique_ptr<PointCloudWriter> CreatePointCloudWriterPCD() {
+    return std::make_unique<PCDPointCloudWriter>();
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -26,11 +26,18 @@
 
 #include <rply.h>
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/file_format/PLYBinaryReader.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/PointCloudReader.h"
+#include "open3d/t/io/PointCloudWriter.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/ProgressReporters.h"
@@ -145,23 +152,34 @@ static std::string GetDtypeString(e_ply_type type) {
 
 static core::Dtype GetDtype(e_ply_type type) {
     // PLY_LIST attribute is not supported.
-    // Currently, we are not doing datatype conversions, so some of the ply
-    // datatypes are not included.
-
-    if (type == PLY_UINT8) {
+    if (type == PLY_INT8) {
+        return core::Dtype::Int8;
+    } else if (type == PLY_UINT8) {
         return core::Dtype::UInt8;
+    } else if (type == PLY_INT16) {
+        return core::Dtype::Int16;
     } else if (type == PLY_UINT16) {
         return core::Dtype::UInt16;
     } else if (type == PLY_INT32) {
         return core::Dtype::Int32;
+    } else if (type == PLY_UIN32) {
+        return core::Dtype::UInt32;
     } else if (type == PLY_FLOAT32) {
         return core::Dtype::Float32;
     } else if (type == PLY_FLOAT64) {
         return core::Dtype::Float64;
+    } else if (type == PLY_CHAR) {
+        return core::Dtype::Int8;
     } else if (type == PLY_UCHAR) {
         return core::Dtype::UInt8;
+    } else if (type == PLY_SHORT) {
+        return core::Dtype::Int16;
+    } else if (type == PLY_USHORT) {
+        return core::Dtype::UInt16;
     } else if (type == PLY_INT) {
         return core::Dtype::Int32;
+    } else if (type == PLY_UINT) {
+        return core::Dtype::UInt32;
     } else if (type == PLY_FLOAT) {
         return core::Dtype::Float32;
     } else if (type == PLY_DOUBLE) {
@@ -171,9 +189,177 @@ static core::Dtype GetDtype(e_ply_type type) {
     }
 }
 
+static core::Dtype GetDtype(open3d::io::PLYBinaryReader::ScalarType type) {
+    using ScalarType = open3d::io::PLYBinaryReader::ScalarType;
+    if (type == ScalarType::Int8) {
+        return core::Dtype::Int8;
+    } else if (type == ScalarType::UInt8) {
+        return core::Dtype::UInt8;
+    } else if (type == ScalarType::Int16) {
+        return core::Dtype::Int16;
+    } else if (type == ScalarType::UInt16) {
+        return core::Dtype::UInt16;
+    } else if (type == ScalarType::Int32) {
+        return core::Dtype::Int32;
+    } else if (type == ScalarType::UInt32) {
+        return core::Dtype::UInt32;
+    } else if (type == ScalarType::Float32) {
+        return core::Dtype::Float32;
+    } else if (type == ScalarType::Float64) {
+        return core::Dtype::Float64;
+    } else {
+        return core::Dtype::Undefined;
+    }
+}
+
+static std::string GetDtypeString(
+        open3d::io::PLYBinaryReader::ScalarType type) {
+    using ScalarType = open3d::io::PLYBinaryReader::ScalarType;
+    if (type == ScalarType::Int8) {
+        return "int8";
+    } else if (type == ScalarType::UInt8) {
+        return "uint8";
+    } else if (type == ScalarType::Int16) {
+        return "int16";
+    } else if (type == ScalarType::UInt16) {
+        return "uint16";
+    } else if (type == ScalarType::Int32) {
+        return "int32";
+    } else if (type == ScalarType::UInt32) {
+        return "uint32";
+    } else if (type == ScalarType::Float32) {
+        return "float32";
+    } else {
+        return "float64";
+    }
+}
+
+/// Vertex properties read into a point cloud attribute. Base attributes are
+/// read from three properties into one tensor.
+using BulkAttributes = std::vector<std::pair<std::string, std::vector<int>>>;
+
+/// Groups the vertex properties of the file opened by reader into point cloud
+/// attributes. Returns false if the dtypes of a base attribute mismatch.
+static bool GetBulkAttributes(const open3d::io::PLYBinaryReader &reader,
+                              BulkAttributes &attributes) {
+    const std::vector<open3d::io::PLYBinaryReader::Property> &properties =
+            reader.GetProperties();
+
+    // Base attributes are read into one tensor if all three properties exist.
+    std::vector<std::pair<std::string, std::vector<std::string>>>
+            base_attributes = {{"points", {"x", "y", "z"}},
+                               {"normals", {"nx", "ny", "nz"}},
+                               {"colors", {"red", "green", "blue"}}};
+    attributes.clear();
+    std::vector<bool> is_used(properties.size(), false);
+    for (const auto &base_attribute : base_attributes) {
+        std::vector<int> indices;
+        for (const std::string &name : base_attribute.second) {
+            int index = reader.FindProperty(name);
+            if (index >= 0 &&
+                GetDtype(properties[index].type_) != core::Dtype::Undefined) {
+                indices.push_back(index);
+            }
+        }
+        if (indices.size() != 3) {
+            continue;
+        }
+        if (GetDtype(properties[indices[0]].type_) !=
+                    GetDtype(properties[indices[1]].type_) ||
+            GetDtype(properties[indices[0]].type_) !=
+                    GetDtype(properties[indices[2]].type_)) {
+            return false;
+        }
+        for (int index : indices) {
+            is_used[index] = true;
+        }
+        attributes.emplace_back(base_attribute.first, indices);
+    }
+    for (size_t i = 0; i < properties.size(); i++) {
+        if (is_used[i]) {
+            continue;
+        }
+        if (GetDtype(properties[i].type_) == core::Dtype::Undefined) {
+            utility::LogWarning(
+                    "Read PLY warning: skipping property \"{}\", unsupported "
+                    "datatype \"{}\".",
+                    properties[i].name_, GetDtypeString(properties[i].type_));
+        } else {
+            attributes.emplace_back(properties[i].name_,
+                                    std::vector<int>{int(i)});
+        }
+    }
+    return true;
+}
+
+/// Reads the attributes of the vertices [begin_vertex, end_vertex) into
+/// pointcloud.
+/// \param update_progress Called with the number of attribute values, counted
+/// per vertex, read so far.
+static void ReadBulkAttributes(
+        const open3d::io::PLYBinaryReader &reader,
+        const BulkAttributes &attributes,
+        int64_t begin_vertex,
+        int64_t end_vertex,
+        geometry::PointCloud &pointcloud,
+        const std::function<void(int64_t)> &update_progress = nullptr) {
+    const std::vector<open3d::io::PLYBinaryReader::Property> &properties =
+            reader.GetProperties();
+    const int64_t num_vertices = end_vertex - begin_vertex;
+    int64_t num_read = 0;
+    std::function<void(int64_t)> update_attribute_progress;
+    if (update_progress) {
+        update_attribute_progress = [&](int64_t count) {
+            update_progress(num_read + count);
+        };
+    }
+
+    pointcloud.Clear();
+    for (const auto &attribute : attributes) {
+        const std::vector<int> &indices = attribute.second;
+        core::Dtype dtype = GetDtype(properties[indices[0]].type_);
+        core::Tensor data({num_vertices, int64_t(indices.size())}, dtype);
+        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+            reader.ReadProperties(indices, begin_vertex, end_vertex,
+                                  data.GetDataPtr<scalar_t>(),
+                                  update_attribute_progress);
+        });
+        pointcloud.SetPointAttr(attribute.first, data);
+        num_read += num_vertices;
+    }
+}
+
+/// Reads the vertex properties through io::PLYBinaryReader, which decodes
+/// binary little endian files in bulk. Returns false if the file is not
+/// covered by it, so that it is read through rply.
+static bool ReadPointCloudInBulk(
+        const std::string &filename,
+        geometry::PointCloud &pointcloud,
+        const open3d::io::ReadPointCloudOption &params) {
+    open3d::io::PLYBinaryReader reader;
+    BulkAttributes attributes;
+    // On mismatched base attribute dtypes, let the rply reader report them.
+    if (!reader.Open(filename) || !GetBulkAttributes(reader, attributes)) {
+        return false;
+    }
+    const int64_t num_vertices = reader.GetNumVertices();
+
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(num_vertices * int64_t(attributes.size()));
+    ReadBulkAttributes(reader, attributes, 0, num_vertices, pointcloud,
+                       [&](int64_t count) { reporter.Update(count); });
+    reporter.Finish();
+
+    return true;
+}
+
 bool ReadPointCloudFromPLY(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const open3d::io::ReadPointCloudOption &params) {
+    if (ReadPointCloudInBulk(filename, pointcloud, params)) {
+        return true;
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), nullptr, 0, nullptr);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}.",
@@ -307,14 +493,22 @@ bool ReadPointCloudFromPLY(const std::string &filename,
     return true;
 }
 
+// PLY has no half precision type, Float16 is written as float32.
 static e_ply_type GetPlyType(const core::Dtype &dtype) {
-    if (dtype == core::Dtype::UInt8) {
+    if (dtype == core::Dtype::Int8) {
+        return PLY_INT8;
+    } else if (dtype == core::Dtype::UInt8) {
         return PLY_UINT8;
+    } else if (dtype == core::Dtype::Int16) {
+        return PLY_INT16;
     } else if (dtype == core::Dtype::UInt16) {
         return PLY_UINT16;
     } else if (dtype == core::Dtype::Int32) {
         return PLY_INT32;
-    } else if (dtype == core::Dtype::Float32) {
+    } else if (dtype == core::Dtype::UInt32) {
+        return PLY_UIN32;
+    } else if (dtype == core::Dtype::Float32 ||
+               dtype == core::Dtype::Float16) {
         return PLY_FLOAT32;
     } else if (dtype == core::Dtype::Float64) {
         return PLY_FLOAT64;
@@ -467,6 +661,277 @@ bool WritePointCloudToPLY(const std::string &filename,
     return true;
 }
 
+/// Reads binary little endian PLY files through io::PLYBinaryReader. The file
+/// is memory mapped, so that only the pages of the current chunk are resident.
+class PLYPointCloudReader : public PointCloudReader {
+public:
+    bool IsOpened() const override { return reader_ != nullptr; }
+
+    bool IsEOF() const override {
+        return !reader_ || next_vertex_ >= reader_->GetNumVertices();
+    }
+
+    bool Open(const std::string &filename) override {
+        Close();
+        auto reader = std::make_unique<open3d::io::PLYBinaryReader>();
+        if (!reader->Open(filename)) {
+            utility::LogWarning(
+                    "Read PLY failed: {} is not a binary little endian PLY "
+                    "file with points and without list properties before or "
+                    "in its vertex element.",
+                    filename);
+            return false;
+        }
+        if (!GetBulkAttributes(*reader, attributes_)) {
+            utility::LogWarning(
+                    "Read PLY failed: datatype mismatch in base attributes.");
+            return false;
+        }
+        reader_ = std::move(reader);
+        return true;
+    }
+
+    void Close() override {
+        reader_.reset();
+        attributes_.clear();
+        next_vertex_ = 0;
+    }
+
+    int64_t GetNumPoints() const override {
+        return reader_ ? reader_->GetNumVertices() : 0;
+    }
+
+    geometry::PointCloud NextChunk(int64_t chunk_size) override {
+        geometry::PointCloud pointcloud;
+        if (IsEOF() || chunk_size <= 0) {
+            return pointcloud;
+        }
+        const int64_t end_vertex =
+                std::min(next_vertex_ + chunk_size, reader_->GetNumVertices());
+        ReadBulkAttributes(*reader_, attributes_, next_vertex_, end_vertex,
+                           pointcloud);
+        next_vertex_ = end_vertex;
+        return pointcloud;
+    }
+
+private:
+    std::unique_ptr<open3d::io::PLYBinaryReader> reader_;
+    BulkAttributes attributes_;
+    int64_t next_vertex_ = 0;
+};
+
+/// Writes binary little endian PLY files. The vertex count in the header is
+/// written with a fixed width, so that it can be updated when the file is
+/// closed.
+class PLYPointCloudWriter : public PointCloudWriter {
+public:
+    ~PLYPointCloudWriter() override { Close(); }
+
+    bool IsOpened() const override { return is_opened_; }
+
+    bool Open(const std::string &filename) override {
+        Close();
+        if (!file_.Open(filename, "wb")) {
+            utility::LogWarning("Write PLY failed: unable to open file: {}.",
+                                filename);
+            return false;
+        }
+        filename_ = filename;
+        is_opened_ = true;
+        attributes_.clear();
+        record_size_ = 0;
+        num_points_ = 0;
+        vertex_count_pos_ = -1;
+        return true;
+    }
+
+    bool Close() override {
+        if (!IsOpened()) {
+            return true;
+        }
+        bool success = true;
+        if (vertex_count_pos_ < 0) {
+            // Nothing was written, the file gets the attributes of an empty
+            // point cloud.
+            attributes_ = {{"points", core::Dtype::Float64, {"x", "y", "z"}}};
+            success = WriteHeader();
+        }
+        if (success) {
+            const std::string count = FormatVertexCount(num_points_);
+            success = fseek(file_.GetFILE(), long(vertex_count_pos_),
+                            SEEK_SET) == 0 &&
+                      fwrite(count.data(), 1, count.size(), file_.GetFILE()) ==
+                              count.size() &&
+                      fflush(file_.GetFILE()) == 0;
+        }
+        if (!success) {
+            utility::LogWarning("Write PLY failed: unable to write file: {}.",
+                                filename_);
+        }
+        file_.Close();
+        is_opened_ = false;
+        return success;
+    }
+
+    int64_t GetNumPoints() const override { return num_points_; }
+
+    bool WriteChunk(const geometry::PointCloud &chunk) override {
+        if (!IsOpened()) {
+            utility::LogWarning("Write PLY failed: file is not opened.");
+            return false;
+        }
+        if (chunk.IsEmpty()) {
+            utility::LogWarning("Write PLY failed: chunk has 0 points.");
+            return false;
+        }
+        if (vertex_count_pos_ < 0) {
+            SetAttributes(chunk);
+            if (!WriteHeader()) {
+                utility::LogWarning(
+                        "Write PLY failed: unable to write header.");
+                return false;
+            }
+        }
+
+        // Every attribute is converted to the dtype of the header, and then
+        // copied into the records of the chunk.
+        const int64_t num_points = chunk.GetPoints().GetLength();
+        const core::Device host("CPU:0");
+        std::vector<core::Tensor> data;
+        std::vector<int64_t> offsets;
+        int64_t offset = 0;
+        for (const Attribute &attribute : attributes_) {
+            const int64_t num_columns =
+                    int64_t(attribute.property_names_.size());
+            if (!chunk.HasPointAttr(attribute.name_) ||
+                chunk.GetPointAttr(attribute.name_).GetLength() !=
+                        num_points ||
+                chunk.GetPointAttr(attribute.name_).NumElements() !=
+                        num_points * num_columns) {
+                utility::LogWarning(
+                        "Write PLY failed: attribute {} of the chunk is "
+                        "missing or does not have {} values per point.",
+                        attribute.name_, num_columns);
+                return false;
+            }
+            data.push_back(chunk.GetPointAttr(attribute.name_)
+                                   .To(host, attribute.dtype_)
+                                   .Contiguous());
+            offsets.push_back(offset);
+            offset += num_columns * attribute.dtype_.ByteSize();
+        }
+        if (chunk.GetPointAttr().size() != attributes_.size()) {
+            utility::LogWarning(
+                    "Write PLY failed: the chunk has other attributes than "
+                    "the first chunk.");
+            return false;
+        }
+
+        std::vector<char> records(num_points * record_size_);
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < num_points; i++) {
+            char *record = records.data() + i * record_size_;
+            for (size_t j = 0; j < data.size(); j++) {
+                const int64_t value_size =
+                        data[j].NumElements() / num_points *
+                        data[j].GetDtype().ByteSize();
+                std::memcpy(record + offsets[j],
+                            static_cast<const char *>(data[j].GetDataPtr()) +
+                                    i * value_size,
+                            value_size);
+            }
+        }
+        if (fwrite(records.data(), 1, records.size(), file_.GetFILE()) !=
+            records.size()) {
+            utility::LogWarning("Write PLY failed: unable to write file: {}.",
+                                filename_);
+            return false;
+        }
+        num_points_ += num_points;
+        return true;
+    }
+
+private:
+    struct Attribute {
+        std::string name_;
+        core::Dtype dtype_;
+        std::vector<std::string> property_names_;
+    };
+
+    static std::string FormatVertexCount(int64_t num_points) {
+        // Wide enough for any int64_t.
+        const size_t width = 19;
+        std::string count = std::to_string(num_points);
+        return std::string(width - count.size(), '0') + count;
+    }
+
+    /// Takes the attributes of the file from the first chunk, in the order of
+    /// WritePointCloudToPLY().
+    void SetAttributes(const geometry::PointCloud &chunk) {
+        attributes_.clear();
+        const std::vector<std::pair<std::string, std::vector<std::string>>>
+                base_attributes = {{"points", {"x", "y", "z"}},
+                                   {"normals", {"nx", "ny", "nz"}},
+                                   {"colors", {"red", "green", "blue"}}};
+        for (const auto &base_attribute : base_attributes) {
+            if (chunk.HasPointAttr(base_attribute.first)) {
+                attributes_.push_back(
+                        {base_attribute.first,
+                         GetDtype(GetPlyType(
+                                 chunk.GetPointAttr(base_attribute.first)
+                                         .GetDtype())),
+                         base_attribute.second});
+            }
+        }
+        for (const auto &it : chunk.GetPointAttr()) {
+            if (it.first != "points" && it.first != "colors" &&
+                it.first != "normals") {
+                attributes_.push_back(
+                        {it.first, GetDtype(GetPlyType(it.second.GetDtype())),
+                         {it.first}});
+            }
+        }
+    }
+
+    bool WriteHeader() {
+        std::string header =
+                "ply\nformat binary_little_endian 1.0\ncomment Created by "
+                "Open3D\nelement vertex ";
+        vertex_count_pos_ = int64_t(header.size());
+        header += FormatVertexCount(0) + "\n";
+        record_size_ = 0;
+        for (const Attribute &attribute : attributes_) {
+            const std::string type_name =
+                    GetDtypeString(GetPlyType(attribute.dtype_));
+            for (const std::string &name : attribute.property_names_) {
+                header += "property " + type_name + " " + name + "\n";
+                record_size_ += attribute.dtype_.ByteSize();
+            }
+        }
+        header += "end_header\n";
+        return fwrite(header.data(), 1, header.size(), file_.GetFILE()) ==
+               header.size();
+    }
+
+    utility::filesystem::CFile file_;
+    bool is_opened_ = false;
+    std::string filename_;
+    std::vector<Attribute> attributes_;
+    int64_t record_size_ = 0;
+    int64_t num_points_ = 0;
+    /// Position of the vertex count in the file, or -1 before the header is
+    /// written.
+    int64_t vertex_count_pos_ = -1;
+};
+
+std::unique_ptr<PointCloudReader> CreatePointCloudReaderPLY() {
+    return std::make_unique<PLYPointCloudReader>();
+}
+
+std::unique_ptr<PointCloudWriter> CreatePointCloudWriterPLY() {
+    return std::make_unique<PLYPointCloudWriter>();
+}
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
@@ -25,11 +25,15 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <vector>
 
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/file_format/ASCIIValueReader.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/PointCloudReader.h"
+#include "open3d/t/io/PointCloudWriter.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/ProgressReporters.h"
@@ -46,35 +50,30 @@ bool ReadPointCloudFromXYZI(const std::string &filename,
                             geometry::PointCloud &pointcloud,
                             const open3d::io::ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        open3d::io::ASCIIValueReader reader;
+        if (!reader.Open(filename)) {
             utility::LogWarning("Read XYZI failed: unable to open file: {}",
                                 filename);
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
-        int64_t num_points = file.GetNumLines();
+        reporter.SetTotal(reader.GetFileSize());
+
+        const std::vector<double> values = reader.ReadValues(
+                4, 0, [&](int64_t offset) { reporter.Update(offset); });
+        const int64_t num_points = int64_t(values.size()) / 4;
 
         pointcloud.Clear();
         core::Tensor points({num_points, 3}, core::Dtype::Float64);
         core::Tensor intensities({num_points, 1}, core::Dtype::Float64);
         double *points_ptr = points.GetDataPtr<double>();
         double *intensities_ptr = intensities.GetDataPtr<double>();
-
-        int i = 0;
-        double x, y, z, I;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf %lf", &x, &y, &z, &I) == 4) {
-                points_ptr[3 * i + 0] = x;
-                points_ptr[3 * i + 1] = y;
-                points_ptr[3 * i + 2] = z;
-                intensities_ptr[i] = I;
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < num_points; i++) {
+            points_ptr[3 * i + 0] = values[4 * i + 0];
+            points_ptr[3 * i + 1] = values[4 * i + 1];
+            points_ptr[3 * i + 2] = values[4 * i + 2];
+            intensities_ptr[i] = values[4 * i + 3];
         }
         pointcloud.SetPoints(points);
         pointcloud.SetPointAttr("intensities", intensities);
@@ -144,6 +143,217 @@ bool WritePointCloudToXYZI(const std::string &filename,
     }
 }
 
+/// Reads XYZI files, or XYZ files if has_intensities is false, line by line.
+class XYZIPointCloudReader : public PointCloudReader {
+public:
+    explicit XYZIPointCloudReader(bool has_intensities)
+        : has_intensities_(has_intensities) {}
+
+    bool IsOpened() const override { return is_opened_; }
+
+    bool IsEOF() const override { return is_eof_; }
+
+    bool Open(const std::string &filename) override {
+        Close();
+        if (!file_.Open(filename, "r")) {
+            utility::LogWarning("Read XYZ{} failed: unable to open file: {}",
+                                has_intensities_ ? "I" : "", filename);
+            return false;
+        }
+        is_opened_ = true;
+        is_eof_ = IsAtEndOfFile();
+        return true;
+    }
+
+    void Close() override {
+        file_.Close();
+        is_opened_ = false;
+        is_eof_ = true;
+    }
+
+    int64_t GetNumPoints() const override { return -1; }
+
+    geometry::PointCloud NextChunk(int64_t chunk_size) override {
+        geometry::PointCloud pointcloud;
+        if (!is_opened_ || is_eof_ || chunk_size <= 0) {
+            return pointcloud;
+        }
+        std::vector<double> points;
+        std::vector<double> intensities;
+        points.reserve(3 * chunk_size);
+        if (has_intensities_) {
+            intensities.reserve(chunk_size);
+        }
+        int64_t num_points = 0;
+        const int num_values = has_intensities_ ? 4 : 3;
+        double values[4];
+        const char *line_buffer;
+        // Lines that cannot be parsed are skipped, as ReadPointCloudFromXYZ()
+        // of the legacy point cloud does.
+        while (num_points < chunk_size && (line_buffer = file_.ReadLine())) {
+            if (!open3d::io::ASCIIValueReader::ParseLine(
+                        line_buffer, num_values, values)) {
+                continue;
+            }
+            points.insert(points.end(), values, values + 3);
+            if (has_intensities_) {
+                intensities.push_back(values[3]);
+            }
+            num_points++;
+        }
+        is_eof_ = IsAtEndOfFile();
+        if (num_points == 0) {
+            return pointcloud;
+        }
+        pointcloud.SetPoints(
+                core::Tensor(points, {num_points, 3}, core::Dtype::Float64));
+        if (has_intensities_) {
+            pointcloud.SetPointAttr("intensities",
+                                    core::Tensor(intensities, {num_points, 1},
+                                                 core::Dtype::Float64));
+        }
+        return pointcloud;
+    }
+
+private:
+    bool IsAtEndOfFile() {
+        FILE *file = file_.GetFILE();
+        int c = fgetc(file);
+        if (c == EOF) {
+            return true;
+        }
+        ungetc(c, file);
+        return false;
+    }
+
+    bool has_intensities_;
+    bool is_opened_ = false;
+    bool is_eof_ = true;
+    utility::filesystem::CFile file_;
+};
+
+/// Writes XYZI files, or XYZ files if has_intensities is false, line by line.
+class XYZIPointCloudWriter : public PointCloudWriter {
+public:
+    explicit XYZIPointCloudWriter(bool has_intensities)
+        : has_intensities_(has_intensities) {}
+
+    ~XYZIPointCloudWriter() override { Close(); }
+
+    bool IsOpened() const override { return is_opened_; }
+
+    bool Open(const std::string &filename) override {
+        Close();
+        if (!file_.Open(filename, "w")) {
+            utility::LogWarning("Write XYZ{} failed: unable to open file: {}",
+                                has_intensities_ ? "I" : "", filename);
+            return false;
+        }
+        filename_ = filename;
+        num_points_ = 0;
+        is_opened_ = true;
+        return true;
+    }
+
+    bool Close() override {
+        if (!is_opened_) {
+            return true;
+        }
+        bool success = fflush(file_.GetFILE()) == 0;
+        file_.Close();
+        is_opened_ = false;
+        return success;
+    }
+
+    int64_t GetNumPoints() const override { return num_points_; }
+
+    bool WriteChunk(const geometry::PointCloud &chunk) override {
+        if (!is_opened_) {
+            utility::LogWarning("Write XYZ{} failed: file is not opened.",
+                                has_intensities_ ? "I" : "");
+            return false;
+        }
+        if (!chunk.HasPoints() ||
+            (has_intensities_ && !chunk.HasPointAttr("intensities"))) {
+            utility::LogWarning(
+                    "Write XYZ{} failed: chunk has no points or intensities.",
+                    has_intensities_ ? "I" : "");
+            return false;
+        }
+        const core::Device host("CPU:0");
+        core::Tensor points = chunk.GetPoints()
+                                      .To(host, core::Dtype::Float64)
+                                      .Contiguous();
+        if (!points.GetShape().IsCompatible({utility::nullopt, 3})) {
+            utility::LogWarning(
+                    "Write XYZ{} failed: Shape of points is {}, but it should "
+                    "be Nx3.",
+                    has_intensities_ ? "I" : "", points.GetShape());
+            return false;
+        }
+        const int64_t num_points = points.GetLength();
+        core::Tensor intensities;
+        if (has_intensities_) {
+            intensities = chunk.GetPointAttr("intensities")
+                                  .To(host, core::Dtype::Float64)
+                                  .Contiguous();
+            if (intensities.GetLength() != num_points ||
+                intensities.NumElements() != num_points) {
+                utility::LogWarning(
+                        "Write XYZI failed: Points ({}) and intensities ({}) "
+                        "have different lengths.",
+                        num_points, intensities.GetLength());
+                return false;
+            }
+        }
+
+        const double *points_ptr = points.GetDataPtr<double>();
+        for (int64_t i = 0; i < num_points; i++) {
+            const double *p = points_ptr + 3 * i;
+            int result;
+            if (has_intensities_) {
+                result = fprintf(file_.GetFILE(), "%.10f %.10f %.10f %.10f\n",
+                                 p[0], p[1], p[2],
+                                 intensities.GetDataPtr<double>()[i]);
+            } else {
+                result = fprintf(file_.GetFILE(), "%.10f %.10f %.10f\n", p[0],
+                                 p[1], p[2]);
+            }
+            if (result < 0) {
+                utility::LogWarning(
+                        "Write XYZ{} failed: unable to write file: {}",
+                        has_intensities_ ? "I" : "", filename_);
+                return false;
+            }
+        }
+        num_points_ += num_points;
+        return true;
+    }
+
+private:
+    bool has_intensities_;
+    bool is_opened_ = false;
+    std::string filename_;
+    int64_t num_points_ = 0;
+    utility::filesystem::CFile file_;
+};
+
+std::unique_ptr<PointCloudReader> CreatePointCloudReaderXYZ() {
+    return std::make_unique<XYZIPointCloudReader>(false);
+}
+
+std::unique_ptr<PointCloudReader> CreatePointCloudReaderXYZI() {
+    return std::make_unique<XYZIPointCloudReader>(true);
+}
+
+std::unique_ptr<PointCloudWriter> CreatePointCloudWriterXYZ() {
+    return std::make_unique<XYZIPointCloudWriter>(false);
+}
+
+std::unique_ptr<PointCloudWriter> CreatePointCloudWriterXYZI() {
+    return std::make_unique<XYZIPointCloudWriter>(true);
+}
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
@@ -37,6 +37,18 @@ namespace t {
 namespace pipelines {
 namespace registration {
 
+static void BuildTargetIndex(
+        open3d::core::nns::NearestNeighborSearch &target_nns) {
+    bool check = target_nns.HybridIndex();
+    if (!check) {
+        utility::LogError(
+                "[Tensor: Registration: NearestNeighborSearch::HybridIndex] "
+                "Index is not set.");
+    }
+}
+
+/// \p target_nns must already have its hybrid index set, so that repeated
+/// calls (e.g. ICP iterations) only pay for the query.
 static RegistrationResult GetRegistrationResultAndCorrespondences(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -61,14 +73,6 @@ static RegistrationResult GetRegistrationResultAndCorrespondences(
         return result;
     }
 
-    bool check = target_nns.HybridIndex();
-    if (!check) {
-        utility::LogError(
-                "[Tensor: EvaluateRegistration: "
-                "GetRegistrationResultAndCorrespondences: "
-                "NearestNeighborSearch::HybridSearch] "
-                "Index is not set.");
-    }
     // max_correspondece_dist in HybridSearch tensor implementation
     // is square root of that used in legacy implementation.
     max_correspondence_distance =
@@ -118,6 +122,9 @@ RegistrationResult EvaluateRegistration(const geometry::PointCloud &source,
     core::Tensor transformation_device = transformation.To(device);
 
     open3d::core::nns::NearestNeighborSearch target_nns(target.GetPoints());
+    if (max_correspondence_distance > 0.0) {
+        BuildTargetIndex(target_nns);
+    }
 
     geometry::PointCloud source_transformed = source.Clone();
     source_transformed.Transform(transformation_device);
@@ -132,6 +139,23 @@ RegistrationResult RegistrationICP(const geometry::PointCloud &source,
                                    const core::Tensor &init,
                                    const TransformationEstimation &estimation,
                                    const ICPConvergenceCriteria &criteria) {
+    open3d::core::nns::NearestNeighborSearch target_nns(target.GetPoints());
+    if (max_correspondence_distance > 0.0) {
+        BuildTargetIndex(target_nns);
+    }
+    return RegistrationICP(source, target, target_nns,
+                           max_correspondence_distance, init, estimation,
+                           criteria);
+}
+
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        open3d::core::nns::NearestNeighborSearch &target_nns,
+        double max_correspondence_distance,
+        const core::Tensor &init,
+        const TransformationEstimation &estimation,
+        const ICPConvergenceCriteria &criteria) {
     core::Device device = source.GetDevice();
     core::Dtype dtype = core::Dtype::Float32;
     source.GetPoints().AssertDtype(dtype);
@@ -145,7 +169,6 @@ RegistrationResult RegistrationICP(const geometry::PointCloud &source,
     init.AssertDtype(dtype);
     core::Tensor transformation_device = init.To(device);
 
-    open3d::core::nns::NearestNeighborSearch target_nns(target.GetPoints());
     geometry::PointCloud source_transformed = source.Clone();
     source_transformed.Transform(transformation_device);
 
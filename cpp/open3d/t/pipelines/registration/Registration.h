@@ -33,6 +33,12 @@
 #include "open3d/t/pipelines/registration/TransformationEstimation.h"
 
 namespace open3d {
+namespace core {
+namespace nns {
+class NearestNeighborSearch;
+}
+}  // namespace core
+
 namespace t {
 
 namespace geometry {
@@ -144,6 +150,30 @@ RegistrationResult RegistrationICP(
                 TransformationEstimationPointToPoint(),
         const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
 
+/// \brief Functions for ICP registration against a pre-built target index.
+///
+/// Use this overload to register several sources against the same target
+/// (e.g. a map) without rebuilding the target search index for every call.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param target_nns NearestNeighborSearch constructed from the points of
+/// \p target, with HybridIndex() already set.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param init Initial transformation estimation.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria.
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        core::nns::NearestNeighborSearch &target_nns,
+        double max_correspondence_distance,
+        const core::Tensor &init,
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace t
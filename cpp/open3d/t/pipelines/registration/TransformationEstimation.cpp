@@ -26,6 +26,7 @@
 
 #include "open3d/t/pipelines/registration/TransformationEstimation.h"
 
+#include "open3d/core/TensorExpr.h"
 #include "open3d/t/pipelines/kernel/ComputePosePointToPlane.h"
 #include "open3d/t/pipelines/kernel/TransformationConverter.h"
 
@@ -53,9 +54,9 @@ double TransformationEstimationPointToPoint::ComputeRMSE(
     core::Tensor source_select = source.GetPoints().IndexGet({corres.first});
     core::Tensor target_select = target.GetPoints().IndexGet({corres.second});
 
-    core::Tensor error_t = (source_select - target_select);
-    error_t.Mul_(error_t);
-    error = static_cast<double>(error_t.Sum({0, 1}).Item<float>());
+    // Fused: the squared differences are never materialized.
+    core::TensorExpr diff = core::TensorExpr(source_select) - target_select;
+    error = static_cast<double>((diff * diff).Sum({0, 1}).Item<float>());
     return std::sqrt(error / static_cast<double>(corres.second.GetShape()[0]));
 }
 
@@ -117,10 +118,11 @@ double TransformationEstimationPointToPlane::ComputeRMSE(
     core::Tensor target_n_select =
             target.GetPointNormals().IndexGet({corres.second});
 
-    core::Tensor error_t =
-            (source_select - target_select).Mul_(target_n_select);
-    error_t.Mul_(error_t);
-    double error = static_cast<double>(error_t.Sum({0, 1}).Item<float>());
+    core::TensorExpr error_t =
+            (core::TensorExpr(source_select) - target_select) *
+            target_n_select;
+    double error = static_cast<double>(
+            (error_t * error_t).Sum({0, 1}).Item<float>());
     return std::sqrt(error / static_cast<double>(corres.second.GetShape()[0]));
 }
 
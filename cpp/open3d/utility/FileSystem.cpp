@@ -43,6 +43,7 @@
 #else
 #include <dirent.h>
 #include <limits.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #endif
@@ -556,6 +557,110 @@ size_t CFile::ReadData(void *data, size_t elem_size, size_t num_elems) {
     return elems;
 }
 
+MappedFile::~MappedFile() { Close(); }
+
+bool MappedFile::Open(const std::string &filename, bool copy_on_write) {
+    Close();
+#ifndef _WIN32
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error_code_ = errno;
+        return false;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        error_code_ = errno;
+        close(fd);
+        return false;
+    }
+    size_ = static_cast<int64_t>(file_stat.st_size);
+    if (size_ > 0) {
+        const int protection =
+                copy_on_write ? PROT_READ | PROT_WRITE : PROT_READ;
+        void *data = mmap(nullptr, static_cast<size_t>(size_), protection,
+                          MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            error_code_ = errno;
+            close(fd);
+            size_ = 0;
+            return false;
+        }
+        data_ = static_cast<const char *>(data);
+    }
+    // The mapping stays valid after the file descriptor is closed.
+    close(fd);
+#else
+    std::wstring filename_w;
+    filename_w.resize(filename.size());
+    int newSize = MultiByteToWideChar(CP_UTF8, 0, filename.c_str(),
+                                      static_cast<int>(filename.length()),
+                                      const_cast<wchar_t *>(filename_w.c_str()),
+                                      static_cast<int>(filename.length()));
+    filename_w.resize(newSize);
+    HANDLE file_handle =
+            CreateFileW(filename_w.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                        nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_handle == INVALID_HANDLE_VALUE) {
+        error_code_ = ENOENT;
+        return false;
+    }
+    file_handle_ = file_handle;
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file_handle, &file_size)) {
+        error_code_ = EIO;
+        Close();
+        return false;
+    }
+    size_ = static_cast<int64_t>(file_size.QuadPart);
+    if (size_ > 0) {
+        HANDLE mapping_handle = CreateFileMappingW(
+                file_handle, nullptr,
+                copy_on_write ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr);
+        if (mapping_handle == nullptr) {
+            error_code_ = EIO;
+            Close();
+            return false;
+        }
+        mapping_handle_ = mapping_handle;
+        data_ = static_cast<const char *>(MapViewOfFile(
+                mapping_handle, copy_on_write ? FILE_MAP_COPY : FILE_MAP_READ,
+                0, 0, 0));
+        if (data_ == nullptr) {
+            error_code_ = EIO;
+            Close();
+            return false;
+        }
+    }
+#endif
+    copy_on_write_ = copy_on_write;
+    return true;
+}
+
+std::string MappedFile::GetError() { return GetIOErrorString(error_code_); }
+
+void MappedFile::Close() {
+#ifndef _WIN32
+    if (data_) {
+        munmap(const_cast<char *>(data_), static_cast<size_t>(size_));
+    }
+#else
+    if (data_) {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_handle_) {
+        CloseHandle(mapping_handle_);
+        mapping_handle_ = nullptr;
+    }
+    if (file_handle_) {
+        CloseHandle(file_handle_);
+        file_handle_ = nullptr;
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    copy_on_write_ = false;
+}
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
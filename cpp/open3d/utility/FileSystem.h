@@ -147,6 +147,54 @@ private:
     std::vector<char> line_buffer_;
 };
 
+/// RAII wrapper for a read-only memory mapping of a whole file.
+/// The pages are loaded lazily by the OS, so large files can be decoded
+/// directly from the mapping, in parallel, without copying them to a buffer.
+class MappedFile {
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /// The destructor unmaps the file automatically.
+    ~MappedFile();
+
+    /// Map a file for reading.
+    /// \param copy_on_write If true, the mapped content can also be written
+    /// to through GetMutableData(). The writes are private to the mapping and
+    /// never reach the file.
+    bool Open(const std::string &filename, bool copy_on_write = false);
+
+    /// Returns the last encountered error for this file.
+    std::string GetError();
+
+    /// Unmap the file.
+    void Close();
+
+    /// Returns the mapped file content, or nullptr if the file is empty or
+    /// not mapped.
+    const char *GetData() const { return data_; }
+
+    /// Returns the writable mapped content, or nullptr if the file is empty or
+    /// not mapped with copy_on_write.
+    char *GetMutableData() const {
+        return copy_on_write_ ? const_cast<char *>(data_) : nullptr;
+    }
+
+    /// Returns the file size in bytes.
+    int64_t GetFileSize() const { return size_; }
+
+private:
+    const char *data_ = nullptr;
+    int64_t size_ = 0;
+    bool copy_on_write_ = false;
+    int error_code_ = 0;
+#ifdef _WIN32
+    void *file_handle_ = nullptr;
+    void *mapping_handle_ = nullptr;
+#endif
+};
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
@@ -580,10 +580,16 @@ void pybind_core_tensor(py::module& m) {
     // Get item from Tensor of one element.
     tensor.def("item", [](const Tensor& tensor) -> py::object {
         Dtype dtype = tensor.GetDtype();
-        if (dtype == Dtype::Float32) {
+        if (dtype == Dtype::Float16) {
+            return py::float_(static_cast<float>(tensor.Item<Float16>()));
+        } else if (dtype == Dtype::Float32) {
             return py::float_(tensor.Item<float>());
         } else if (dtype == Dtype::Float64) {
             return py::float_(tensor.Item<double>());
+        } else if (dtype == Dtype::Int8) {
+            return py::int_(tensor.Item<int8_t>());
+        } else if (dtype == Dtype::Int16) {
+            return py::int_(tensor.Item<int16_t>());
         } else if (dtype == Dtype::Int32) {
             return py::int_(tensor.Item<int32_t>());
         } else if (dtype == Dtype::Int64) {
@@ -592,6 +598,8 @@ void pybind_core_tensor(py::module& m) {
             return py::int_(tensor.Item<uint8_t>());
         } else if (dtype == Dtype::UInt16) {
             return py::int_(tensor.Item<uint16_t>());
+        } else if (dtype == Dtype::UInt32) {
+            return py::int_(tensor.Item<uint32_t>());
         } else if (dtype == Dtype::Bool) {
             return py::bool_(tensor.Item<bool>());
         } else {
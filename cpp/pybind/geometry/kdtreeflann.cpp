@@ -120,10 +120,13 @@ void pybind_kdtreeflann(py::module &m) {
             m, "KDTreeFlann", "KDTree with FLANN for nearest neighbor search.");
     kdtreeflann.def(py::init<>())
             .def(py::init<const Eigen::MatrixXd &>(), "data"_a)
-            .def("set_matrix_data", &KDTreeFlann::SetMatrixData,
+            .def("set_matrix_data",
+                 py::overload_cast<const Eigen::MatrixXd &>(
+                         &KDTreeFlann::SetMatrixData),
                  "Sets the data for the KDTree from a matrix.", "data"_a)
             .def(py::init<const Geometry &>(), "geometry"_a)
-            .def("set_geometry", &KDTreeFlann::SetGeometry,
+            .def("set_geometry",
+                 py::overload_cast<const Geometry &>(&KDTreeFlann::SetGeometry),
                  "Sets the data for the KDTree from geometry.", "geometry"_a)
             .def(py::init<const pipelines::registration::Feature &>(),
                  "feature"_a)
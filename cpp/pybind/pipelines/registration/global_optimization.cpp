@@ -271,6 +271,21 @@ void pybind_global_optimization(py::module &m) {
                        std::to_string(cr.lower_scale_factor_);
             });
 
+    py::enum_<GlobalOptimizationLinearSolver> linear_solver(
+            m, "GlobalOptimizationLinearSolver", py::arithmetic());
+    linear_solver.value("Dense", GlobalOptimizationLinearSolver::Dense)
+            .value("SparseCholesky",
+                   GlobalOptimizationLinearSolver::SparseCholesky)
+            .value("ConjugateGradient",
+                   GlobalOptimizationLinearSolver::ConjugateGradient)
+            .export_values();
+    // Trick to write docs without listing the members in the enum class again.
+    linear_solver.attr("__doc__") = docstring::static_property(
+            py::cpp_function([](py::handle arg) -> std::string {
+                return "Enum class for GlobalOptimizationLinearSolver.";
+            }),
+            py::none(), py::none(), "");
+
     py::class_<GlobalOptimizationOption> option(
             m, "GlobalOptimizationOption", "Option for GlobalOptimization.");
     py::detail::bind_default_constructor<GlobalOptimizationOption>(option);
@@ -299,17 +314,26 @@ void pybind_global_optimization(py::module &m) {
                            &GlobalOptimizationOption::reference_node_,
                            "int: The pose of this node is unchanged after "
                            "optimization.")
+            .def_readwrite("linear_solver",
+                           &GlobalOptimizationOption::linear_solver_,
+                           "registration.GlobalOptimizationLinearSolver: "
+                           "Solver used for the sparse linear system of each "
+                           "iteration.")
             .def(py::init([](double max_correspondence_distance,
                              double edge_prune_threshold,
                              double preference_loop_closure,
-                             int reference_node) {
+                             int reference_node,
+                             GlobalOptimizationLinearSolver linear_solver) {
                      return new GlobalOptimizationOption(
                              max_correspondence_distance, edge_prune_threshold,
-                             preference_loop_closure, reference_node);
+                             preference_loop_closure, reference_node,
+                             linear_solver);
                  }),
                  "max_correspondence_distance"_a = 0.03,
                  "edge_prune_threshold"_a = 0.25,
-                 "preference_loop_closure"_a = 1.0, "reference_node"_a = -1)
+                 "preference_loop_closure"_a = 1.0, "reference_node"_a = -1,
+                 "linear_solver"_a =
+                         GlobalOptimizationLinearSolver::SparseCholesky)
             .def("__repr__", [](const GlobalOptimizationOption &goo) {
                 return std::string("GlobalOptimizationOption") +
                        std::string("\n> max_correspondence_distance : ") +
@@ -319,7 +343,9 @@ void pybind_global_optimization(py::module &m) {
                        std::string("\n> preference_loop_closure : ") +
                        std::to_string(goo.preference_loop_closure_) +
                        std::string("\n> reference_node : ") +
-                       std::to_string(goo.reference_node_);
+                       std::to_string(goo.reference_node_) +
+                       std::string("\n> linear_solver : ") +
+                       std::to_string(static_cast<int>(goo.linear_solver_));
             });
 }
 
@@ -29,6 +29,7 @@
 
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/TSDFVoxelGridIO.h"
 #include "pybind/docstring.h"
 #include "pybind/t/io/io.h"
 
@@ -73,6 +74,7 @@ static const std::unordered_map<std::string, std::string>
                 {"line_set", "The ``LineSet`` object for I/O"},
                 {"image", "The ``Image`` object for I/O"},
                 {"voxel_grid", "The ``VoxelGrid`` object for I/O"},
+                {"tsdf_voxel_grid", "The ``TSDFVoxelGrid`` object for I/O"},
                 {"trajectory",
                  "The ``PinholeCameraTrajectory`` object for I/O"},
                 {"intrinsic", "The ``PinholeCameraIntrinsic`` object for I/O"},
@@ -118,6 +120,31 @@ void pybind_class_io(py::module &m_io) {
             "compressed"_a = false, "print_progress"_a = false);
     docstring::FunctionDocInject(m_io, "write_point_cloud",
                                  map_shared_argument_docstrings);
+
+    m_io.def(
+            "read_tsdf_voxel_grid",
+            [](const std::string &filename) {
+                py::gil_scoped_release release;
+                t::geometry::TSDFVoxelGrid tsdf_voxel_grid;
+                ReadTSDFVoxelGrid(filename, tsdf_voxel_grid);
+                return tsdf_voxel_grid;
+            },
+            "Function to read TSDFVoxelGrid from a tensor archive file",
+            "filename"_a);
+    docstring::FunctionDocInject(m_io, "read_tsdf_voxel_grid",
+                                 map_shared_argument_docstrings);
+
+    m_io.def(
+            "write_tsdf_voxel_grid",
+            [](const std::string &filename,
+               const t::geometry::TSDFVoxelGrid &tsdf_voxel_grid) {
+                py::gil_scoped_release release;
+                return WriteTSDFVoxelGrid(filename, tsdf_voxel_grid);
+            },
+            "Function to write TSDFVoxelGrid to a tensor archive file",
+            "filename"_a, "tsdf_voxel_grid"_a);
+    docstring::FunctionDocInject(m_io, "write_tsdf_voxel_grid",
+                                 map_shared_argument_docstrings);
 }
 
 }  // namespace io
@@ -26,6 +26,7 @@
 
 #include "open3d/core/nns/FixedRadiusIndex.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -34,12 +35,18 @@
 #include "open3d/core/SizeVector.h"
 #include "open3d/utility/Helper.h"
 #include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
 
 namespace open3d {
 namespace tests {
 
-TEST(FixedRadiusIndex, SearchRadius) {
-    core::Device device = core::Device("CUDA:0");
+class FixedRadiusIndexPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(FixedRadiusIndex,
+                         FixedRadiusIndexPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(FixedRadiusIndexPermuteDevices, SearchRadius) {
+    core::Device device = GetParam();
     std::vector<int> ref_indices = {1, 4};
     std::vector<float> ref_distance = {0.00626358, 0.00747938};
 
@@ -55,8 +62,8 @@ TEST(FixedRadiusIndex, SearchRadius) {
                        {1, 3}, core::Dtype::Float32, device);
 
     // if radius <= 0
-    // EXPECT_THROW(index.SearchRadius(query, -1.0), std::runtime_error);
-    // EXPECT_THROW(index.SearchRadius(query, 0.0), std::runtime_error);
+    EXPECT_THROW(index.SearchRadius(query, -1.0), std::runtime_error);
+    EXPECT_THROW(index.SearchRadius(query, 0.0), std::runtime_error);
 
     // if radius == 0.1
     std::tuple<core::Tensor, core::Tensor, core::Tensor> result =
@@ -68,5 +75,57 @@ TEST(FixedRadiusIndex, SearchRadius) {
              std::vector<float>({0.00626358, 0.00747938}));
 }
 
+TEST_P(FixedRadiusIndexPermuteDevices, SearchRadiusBatch) {
+    core::Device device = GetParam();
+
+    // Pseudo random points on a grid; compare against brute force search.
+    int size = 1000;
+    std::vector<double> points(size * 3);
+    for (int i = 0; i < size * 3; ++i) {
+        points[i] = ((i * 7919) % 101) / 100.0;
+    }
+    core::Tensor ref(points, {size, 3}, core::Dtype::Float64, device);
+    core::Tensor query = ref.Slice(0, 0, 100).Add(0.005);
+    double radius = 0.1;
+    core::nns::FixedRadiusIndex index(ref, radius);
+
+    core::Tensor indices, distances, num_neighbors;
+    std::tie(indices, distances, num_neighbors) =
+            index.SearchRadius(query, radius);
+
+    std::vector<double> ref_vec = ref.ToFlatVector<double>();
+    std::vector<double> query_vec = query.ToFlatVector<double>();
+    std::vector<int64_t> indices_vec = indices.ToFlatVector<int64_t>();
+    std::vector<double> distances_vec = distances.ToFlatVector<double>();
+    std::vector<int64_t> num_neighbors_vec =
+            num_neighbors.ToFlatVector<int64_t>();
+
+    int64_t offset = 0;
+    for (int i = 0; i < 100; ++i) {
+        std::vector<std::pair<double, int64_t>> gt;
+        for (int j = 0; j < size; ++j) {
+            double dist = 0;
+            for (int k = 0; k < 3; ++k) {
+                double d = ref_vec[3 * j + k] - query_vec[3 * i + k];
+                dist += d * d;
+            }
+            if (dist <= radius * radius) gt.emplace_back(dist, j);
+        }
+        std::sort(gt.begin(), gt.end());
+        ASSERT_EQ(num_neighbors_vec[i], int64_t(gt.size()));
+        std::vector<std::pair<double, int64_t>> result;
+        for (size_t j = 0; j < gt.size(); ++j) {
+            result.emplace_back(distances_vec[offset + j],
+                                indices_vec[offset + j]);
+        }
+        std::sort(result.begin(), result.end());
+        for (size_t j = 0; j < gt.size(); ++j) {
+            EXPECT_EQ(result[j].second, gt[j].second);
+            EXPECT_NEAR(result[j].first, gt[j].first, 1e-12);
+        }
+        offset += gt.size();
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -321,5 +321,70 @@ TEST_P(HashmapPermuteDevices, InsertComplexKeys) {
     }
 }
 
+TEST(Hashmap, CPUBackends) {
+    core::Device device("CPU:0");
+    const int n = 4096;
+    const int slots = 1023;
+
+    EXPECT_ANY_THROW(core::Hashmap(n, core::Dtype::Int32, core::Dtype::Int32,
+                                   {1}, {1}, device,
+                                   core::HashmapBackend::Slab));
+
+    for (core::HashmapBackend backend :
+         {core::HashmapBackend::TBB, core::HashmapBackend::LinearProbing}) {
+        // Small initial capacity to trigger rehashing on insertion.
+        core::Hashmap hashmap(slots / 4, core::Dtype::Int32,
+                              core::Dtype::Int32, {1}, {1}, device, backend);
+
+        HashData<int, int> data(n, slots);
+        core::Tensor keys(data.keys_, {n}, core::Dtype::Int32, device);
+        core::Tensor values(data.vals_, {n}, core::Dtype::Int32, device);
+
+        core::Tensor addrs, masks;
+        hashmap.Insert(keys, values, addrs, masks);
+        EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(),
+                  slots);
+        EXPECT_EQ(hashmap.Size(), slots);
+
+        // Erase and re-insert the same keys until erased slots fill the
+        // open-addressing table and force it to be rebuilt.
+        HashData<int, int> data_erase(slots / 2, slots / 2);
+        core::Tensor keys_erase(data_erase.keys_, {slots / 2},
+                                core::Dtype::Int32, device);
+        core::Tensor values_erase(data_erase.vals_, {slots / 2},
+                                  core::Dtype::Int32, device);
+        for (int i = 0; i < 32; ++i) {
+            hashmap.Erase(keys_erase, masks);
+            EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(),
+                      slots / 2);
+            EXPECT_EQ(hashmap.Size(), slots - slots / 2);
+
+            hashmap.Insert(keys_erase, values_erase, addrs, masks);
+            EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(),
+                      slots / 2);
+            EXPECT_EQ(hashmap.Size(), slots);
+        }
+
+        hashmap.Rehash(hashmap.GetBucketCount() * 2);
+        EXPECT_EQ(hashmap.Size(), slots);
+
+        hashmap.Find(keys, addrs, masks);
+        EXPECT_TRUE(masks.All());
+        core::Tensor found_indices = addrs.To(core::Dtype::Int64);
+        core::Tensor found_keys =
+                hashmap.GetKeyTensor().IndexGet({found_indices});
+        core::Tensor found_values =
+                hashmap.GetValueTensor().IndexGet({found_indices});
+        EXPECT_TRUE(found_keys.Reshape({n}).AllClose(keys));
+        EXPECT_TRUE(found_values.Reshape({n}).AllClose(values));
+
+        std::vector<int> missing_keys_val = {1, 2, 3};
+        core::Tensor missing_keys(missing_keys_val, {3}, core::Dtype::Int32,
+                                  device);
+        hashmap.Find(missing_keys, addrs, masks);
+        EXPECT_FALSE(masks.Any());
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -26,6 +26,8 @@
 
 #include "open3d/core/MemoryManager.h"
 
+#include <cstring>
+#include <thread>
 #include <vector>
 
 #include "open3d/core/Blob.h"
@@ -78,5 +80,48 @@ TEST_P(MemoryManagerPermuteDevicePairs, Memcpy) {
     core::MemoryManager::Free(src_ptr, src_device);
 }
 
+TEST(MemoryManager, CPUCachedMallocFree) {
+    core::Device device("CPU:0");
+    core::CPUCachedMemoryManager mm;
+    core::CPUCachedMemoryManager::ReleaseCache();
+    core::CPUCachedMemoryManager::ResetStatistics();
+
+    // Pointers are 64-byte aligned in all size classes.
+    for (size_t byte_size : {1, 63, 64, 65, 1000, 1 << 20, (3 << 20) + 1}) {
+        void* ptr = mm.Malloc(byte_size, device);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 64, 0u);
+        std::memset(ptr, 0, byte_size);
+        mm.Free(ptr, device);
+    }
+    EXPECT_EQ(mm.Malloc(0, device), nullptr);
+
+    // A freed block is reused for a request of the same size class.
+    core::CPUCachedMemoryManager::ReleaseCache();
+    core::CPUCachedMemoryManager::ResetStatistics();
+    void* ptr = mm.Malloc(1000, device);
+    mm.Free(ptr, device);
+    EXPECT_GE(core::CPUCachedMemoryManager::GetStatistics().cached_bytes_,
+              1000u);
+    void* ptr_reused = mm.Malloc(1010, device);
+    EXPECT_EQ(ptr, ptr_reused);
+    core::CPUCachedMemoryStatistics statistics =
+            core::CPUCachedMemoryManager::GetStatistics();
+    EXPECT_EQ(statistics.num_hits_, 1u);
+    EXPECT_EQ(statistics.num_misses_, 1u);
+    EXPECT_EQ(statistics.cached_bytes_, 0u);
+    mm.Free(ptr_reused, device);
+
+    // Blocks freed by other threads are released as well.
+    std::thread([&]() { mm.Free(mm.Malloc(100, device), device); }).join();
+    core::CPUCachedMemoryManager::TrimCache(0);
+    EXPECT_EQ(core::CPUCachedMemoryManager::GetStatistics().cached_bytes_, 0u);
+
+    // Nothing is cached beyond the limit.
+    core::CPUCachedMemoryManager::SetMaxCachedBytes(0);
+    mm.Free(mm.Malloc(100, device), device);
+    EXPECT_EQ(core::CPUCachedMemoryManager::GetStatistics().cached_bytes_, 0u);
+    core::CPUCachedMemoryManager::SetMaxCachedBytes(size_t(1) << 30);
+}
+
 }  // namespace tests
 }  // namespace open3d
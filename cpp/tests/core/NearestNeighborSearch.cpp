@@ -26,6 +26,7 @@
 
 #include "open3d/core/nns/NearestNeighborSearch.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -135,6 +136,79 @@ TEST_P(NNSPermuteDevices, FixedRadiusSearch) {
              std::vector<double>({0.00626358, 0.00747938}));
 }
 
+TEST(NearestNeighborSearch, FixedRadiusSearchDifferentRadii) {
+    // Pseudo-random points and queries in the unit cube.
+    const int64_t num_points = 500;
+    const int64_t num_queries = 50;
+    std::vector<double> values(3 * (num_points + num_queries));
+    uint32_t seed = 12345;
+    for (double &value : values) {
+        seed = seed * 1664525u + 1013904223u;
+        value = double(seed >> 8) / double(1 << 24);
+    }
+    core::Tensor ref(std::vector<double>(values.begin(),
+                                         values.begin() + 3 * num_points),
+                     {num_points, 3}, core::Dtype::Float64);
+    core::Tensor query(std::vector<double>(values.begin() + 3 * num_points,
+                                           values.end()),
+                       {num_queries, 3}, core::Dtype::Float64);
+
+    core::nns::NearestNeighborSearch nns(ref);
+    for (double radius : {0.1, 0.25}) {
+        SCOPED_TRACE(radius);
+        // The index is rebuilt for every radius.
+        nns.FixedRadiusIndex(radius);
+        core::Tensor indices, distances, num_neighbors;
+        std::tie(indices, distances, num_neighbors) =
+                nns.FixedRadiusSearch(query, radius);
+        const std::vector<int64_t> indices_vec =
+                indices.ToFlatVector<int64_t>();
+        const std::vector<double> distances_vec =
+                distances.ToFlatVector<double>();
+        const std::vector<int64_t> num_neighbors_vec =
+                num_neighbors.ToFlatVector<int64_t>();
+        ASSERT_EQ(int64_t(num_neighbors_vec.size()), num_queries);
+
+        // The neighbors of each query are the ones found by brute force.
+        int64_t offset = 0;
+        for (int64_t i = 0; i < num_queries; i++) {
+            std::vector<std::pair<int64_t, double>> neighbors;
+            for (int64_t k = 0; k < num_neighbors_vec[i]; k++) {
+                neighbors.emplace_back(indices_vec[offset + k],
+                                       distances_vec[offset + k]);
+            }
+            offset += num_neighbors_vec[i];
+            std::sort(neighbors.begin(), neighbors.end());
+
+            std::vector<int64_t> expected;
+            const double *q = values.data() + 3 * (num_points + i);
+            for (int64_t j = 0; j < num_points; j++) {
+                const double *p = values.data() + 3 * j;
+                const double dist = (p[0] - q[0]) * (p[0] - q[0]) +
+                                    (p[1] - q[1]) * (p[1] - q[1]) +
+                                    (p[2] - q[2]) * (p[2] - q[2]);
+                if (dist <= radius * radius) {
+                    expected.push_back(j);
+                }
+            }
+            ASSERT_EQ(neighbors.size(), expected.size());
+            for (size_t k = 0; k < expected.size(); k++) {
+                EXPECT_EQ(neighbors[k].first, expected[k]);
+                const double *p = values.data() + 3 * expected[k];
+                EXPECT_NEAR(neighbors[k].second,
+                            (p[0] - q[0]) * (p[0] - q[0]) +
+                                    (p[1] - q[1]) * (p[1] - q[1]) +
+                                    (p[2] - q[2]) * (p[2] - q[2]),
+                            1e-12);
+            }
+        }
+        EXPECT_EQ(offset, indices.GetLength());
+    }
+
+    // The index only answers queries with its radius.
+    EXPECT_THROW(nns.FixedRadiusSearch(query, 0.1), std::runtime_error);
+}
+
 TEST(NearestNeighborSearch, MultiRadiusSearch) {
     // Set up nns.
     int size = 10;
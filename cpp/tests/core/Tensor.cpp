@@ -26,14 +26,19 @@
 
 #include "open3d/core/Tensor.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <numeric>
+#include <tuple>
 
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
+#include "open3d/core/kernel/CPULauncher.h"
 #include "open3d/core/kernel/Kernel.h"
+#include "open3d/core/kernel/ParallelUtil.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
 #include "tests/UnitTest.h"
@@ -1263,6 +1268,53 @@ TEST_P(TensorPermuteDevices, Add) {
               std::vector<float>({10, 12, 14, 16, 18, 20}));
 }
 
+TEST_P(TensorPermuteDevices, AddContiguousAndScalar) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}}, device);
+    core::Tensor s = core::Tensor::Init<float>(10, device);
+
+    // Broadcast scalar on either side.
+    EXPECT_EQ((a + s).ToFlatVector<float>(),
+              std::vector<float>({10, 11, 12, 13, 14, 15}));
+    EXPECT_EQ((s - a).ToFlatVector<float>(),
+              std::vector<float>({10, 9, 8, 7, 6, 5}));
+    EXPECT_EQ((s * s).ToFlatVector<float>(), std::vector<float>({100}));
+
+    // Non-contiguous operands take the generic path.
+    core::Tensor a_t = a.T();
+    EXPECT_EQ((a_t + s).ToFlatVector<float>(),
+              std::vector<float>({10, 13, 11, 14, 12, 15}));
+    EXPECT_EQ(a_t.Gt(2).ToFlatVector<bool>(),
+              std::vector<bool>({false, true, false, true, false, true}));
+
+    // Large enough to be split across threads.
+    core::Tensor b = core::Tensor::Ones({100000}, core::Dtype::Int32, device);
+    EXPECT_EQ((b + b).Sum({0}).Item<int32_t>(), 200000);
+    EXPECT_TRUE(b.Eq(1).All());
+
+    // {N, 3} operands are not coalesced to 1D by the Indexer, but still take
+    // the typed pointer path when they are contiguous or broadcast scalars.
+    using core::kernel::CPULauncher;
+    core::Tensor c =
+            core::Tensor::Ones({1000, 3}, core::Dtype::Float32, device);
+    core::Tensor dst =
+            core::Tensor::Empty({1000, 3}, core::Dtype::Float32, device);
+    core::Tensor row = core::Tensor::Ones({3}, core::Dtype::Float32, device);
+    EXPECT_TRUE(
+            CPULauncher::IsContiguousOrScalar(core::Indexer({c, c}, dst)));
+    EXPECT_TRUE(CPULauncher::IsContiguousOrScalar(core::Indexer({c, s}, dst)));
+    EXPECT_TRUE(CPULauncher::IsScalarInput(core::Indexer({c, s}, dst), 1));
+    EXPECT_TRUE(CPULauncher::IsContiguousOrScalar(
+            core::Indexer({c.Slice(0, 0, 1)}, dst.Slice(0, 0, 1))));
+    // Broadcast rows and strided views take the generic path.
+    EXPECT_FALSE(
+            CPULauncher::IsContiguousOrScalar(core::Indexer({c, row}, dst)));
+    EXPECT_FALSE(CPULauncher::IsContiguousOrScalar(
+            core::Indexer({c.Slice(1, 0, 2)}, dst.Slice(1, 0, 2))));
+    EXPECT_FALSE(CPULauncher::IsContiguousOrScalar(
+            core::Indexer({c.Slice(0, 0, 1000, 2)}, dst.Slice(0, 0, 500))));
+}
+
 TEST_P(TensorPermuteDevices, Add_) {
     core::Device device = GetParam();
     core::Tensor a = core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}}, device);
@@ -1943,6 +1995,49 @@ TEST_P(TensorPermuteDevices, ReduceArgMax) {
               std::vector<int64_t>({1, 2, 2, 1, 3, 2}));
 }
 
+TEST_P(TensorPermuteDevices, ReduceFewOutputsLargeArray) {
+    // Reducing {N, 3} along dim 0 has fewer outputs than threads, which uses
+    // per-thread partial outputs on CPU.
+    core::Device device = GetParam();
+    core::kernel::ScopedNumThreads scoped_num_threads(4);
+    const int64_t n = 200000;
+    std::vector<int> vals(n * 3);
+    std::vector<int> sums(3, 0);
+    std::vector<int> mins(3, std::numeric_limits<int>::max());
+    std::vector<int> maxs(3, std::numeric_limits<int>::lowest());
+    std::vector<int64_t> argmins(3, 0);
+    std::vector<int64_t> argmaxs(3, 0);
+    for (int64_t i = 0; i < n; ++i) {
+        for (int64_t j = 0; j < 3; ++j) {
+            int val = static_cast<int>((i * (j + 7)) % 1000) - 500;
+            vals[i * 3 + j] = val;
+            sums[j] += val;
+            if (val < mins[j]) {
+                mins[j] = val;
+                argmins[j] = i;
+            }
+            if (val > maxs[j]) {
+                maxs[j] = val;
+                argmaxs[j] = i;
+            }
+        }
+    }
+    core::Tensor src(vals, {n, 3}, core::Dtype::Int32, device);
+
+    EXPECT_EQ(src.Sum({0}).ToFlatVector<int>(), sums);
+    EXPECT_EQ(src.Min({0}).ToFlatVector<int>(), mins);
+    EXPECT_EQ(src.Max({0}).ToFlatVector<int>(), maxs);
+    EXPECT_EQ(src.ArgMin({0}).ToFlatVector<int64_t>(), argmins);
+    EXPECT_EQ(src.ArgMax({0}).ToFlatVector<int64_t>(), argmaxs);
+
+    core::Tensor src_t = src.T();
+    EXPECT_EQ(src_t.Sum({1}).ToFlatVector<int>(), sums);
+    EXPECT_EQ(src_t.Min({1}).ToFlatVector<int>(), mins);
+    EXPECT_EQ(src_t.Max({1}).ToFlatVector<int>(), maxs);
+    EXPECT_EQ(src_t.ArgMin({1}).ToFlatVector<int64_t>(), argmins);
+    EXPECT_EQ(src_t.ArgMax({1}).ToFlatVector<int64_t>(), argmaxs);
+}
+
 TEST_P(TensorPermuteDevices, Sqrt) {
     core::Device device = GetParam();
     core::Tensor src =
@@ -2077,6 +2172,128 @@ TEST_P(TensorPermuteDevices, Abs) {
     EXPECT_EQ(src.ToFlatVector<float>(), dst_vals);
 }
 
+TEST_P(TensorPermuteDevices, Where) {
+    core::Device device = GetParam();
+
+    core::Tensor condition = core::Tensor::Init<bool>(
+            {{true, false, true}, {false, true, false}}, device);
+    core::Tensor x = core::Tensor::Init<float>({{1, 2, 3}, {4, 5, 6}}, device);
+    core::Tensor y = core::Tensor::Init<float>({-1, -2, -3}, device);
+    core::Tensor dst = core::Tensor::Where(condition, x, y);
+    EXPECT_EQ(dst.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({1, -2, 3, -1, 5, -3}));
+
+    // Broadcast scalar and strided operands.
+    dst = core::Tensor::Where(x.T().Gt(2.f),
+                              core::Tensor::Init<float>(0.f, device), x.T());
+    EXPECT_EQ(dst.GetShape(), core::SizeVector({3, 2}));
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({1, 0, 2, 0, 0, 0}));
+
+    // Large enough to be split across threads.
+    core::Tensor large_x =
+            core::Tensor::Arange(0, 100000, 1, core::Dtype::Int64, device);
+    core::Tensor large_y = large_x.Neg();
+    core::Tensor large_dst =
+            core::Tensor::Where(large_x.Lt(50000), large_x, large_y);
+    EXPECT_EQ(large_dst.Sum({0}).Item<int64_t>(),
+              (49999LL * 50000 - (50000LL + 99999) * 50000) / 2);
+
+    // Dtype mismatches.
+    EXPECT_ANY_THROW(core::Tensor::Where(x, x, y));
+    EXPECT_ANY_THROW(
+            core::Tensor::Where(condition, x, y.To(core::Dtype::Float64)));
+}
+
+TEST_P(TensorPermuteDevices, Clip) {
+    core::Device device = GetParam();
+
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    core::Tensor src =
+            core::Tensor::Init<float>({{-2, -0.5, 0}, {0.5, 2, nan}}, device);
+    core::Tensor dst = src.Clip(-1, 1);
+    std::vector<float> dst_vals = dst.ToFlatVector<float>();
+    EXPECT_EQ(std::vector<float>(dst_vals.begin(), dst_vals.begin() + 5),
+              std::vector<float>({-1, -0.5, 0, 0.5, 1}));
+    EXPECT_TRUE(std::isnan(dst_vals[5]));
+
+    core::Tensor src_int = core::Tensor::Init<int32_t>({-5, 3, 7, 10}, device);
+    EXPECT_EQ(src_int.Clip(0, 8).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 3, 7, 8}));
+
+    // Bounds out of the range of the dtype saturate instead of wrapping.
+    EXPECT_EQ(src_int.Clip(-1e10, 1e10).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({-5, 3, 7, 10}));
+    EXPECT_EQ(src_int.Clip(-1e10, 4).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({-5, 3, 4, 4}));
+    core::Tensor src_uint8 =
+            core::Tensor::Init<uint8_t>({0, 3, 200, 255}, device);
+    EXPECT_EQ(src_uint8.Clip(-1, 100).ToFlatVector<uint8_t>(),
+              std::vector<uint8_t>({0, 3, 100, 100}));
+    EXPECT_EQ(src_uint8.Clip(5, 300).ToFlatVector<uint8_t>(),
+              std::vector<uint8_t>({5, 5, 200, 255}));
+    core::Tensor src_int64 = core::Tensor::Init<int64_t>(
+            {std::numeric_limits<int64_t>::lowest(), 0,
+             std::numeric_limits<int64_t>::max()},
+            device);
+    EXPECT_EQ(src_int64.Clip(-1e30, 1e30).ToFlatVector<int64_t>(),
+              src_int64.ToFlatVector<int64_t>());
+    core::Tensor src_uint16 = core::Tensor::Init<uint16_t>({1, 9}, device);
+    src_uint16.Clip_(-5, 4);
+    EXPECT_EQ(src_uint16.ToFlatVector<uint16_t>(),
+              std::vector<uint16_t>({1, 4}));
+
+    // Inplace version on a strided view.
+    core::Tensor t = core::Tensor::Init<float>({{-3, 1}, {2, 5}}, device);
+    core::Tensor t_col = t.Slice(1, 0, 1);
+    t_col.Clip_(0, 1);
+    EXPECT_EQ(t.ToFlatVector<float>(), std::vector<float>({0, 1, 1, 5}));
+}
+
+TEST_P(TensorPermuteDevices, AddMul) {
+    core::Device device = GetParam();
+
+    core::Tensor src =
+            core::Tensor::Init<float>({{1, 2, 3}, {4, 5, 6}}, device);
+    core::Tensor lhs = core::Tensor::Init<float>({2, 3, 4}, device);
+    core::Tensor rhs = core::Tensor::Init<float>(10.f, device);
+    core::Tensor dst = src.AddMul(lhs, rhs);
+    EXPECT_EQ(dst.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({21, 32, 43, 24, 35, 46}));
+
+    // The output shape broadcasts all three operands.
+    dst = rhs.AddMul(lhs, src);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({12, 16, 22, 18, 25, 34}));
+
+    // Fused multiply-add: with eps = 2^-23, (1 + eps) * (1 - eps) - 1 = -eps^2
+    // is exact with a single rounding, but rounds to 0 with a separate
+    // multiply and add. The same holds for Float64 with eps = 2^-52.
+    const float eps = std::ldexp(1.f, -23);
+    core::Tensor one_plus = core::Tensor::Init<float>({1 + eps}, device);
+    core::Tensor one_minus = core::Tensor::Init<float>({1 - eps}, device);
+    core::Tensor minus_one = core::Tensor::Init<float>({-1}, device);
+    EXPECT_EQ(minus_one.AddMul(one_plus, one_minus).Item<float>(),
+              -eps * eps);
+    const double eps64 = std::ldexp(1., -52);
+    EXPECT_EQ(core::Tensor::Init<double>({-1}, device)
+                      .AddMul(core::Tensor::Init<double>({1 + eps64}, device),
+                              core::Tensor::Init<double>({1 - eps64}, device))
+                      .Item<double>(),
+              -eps64 * eps64);
+
+    // Integers and the inplace version.
+    core::Tensor acc = core::Tensor::Init<int64_t>({1, 2, 3}, device);
+    acc.AddMul_(core::Tensor::Init<int64_t>({1, 2, 3}, device),
+                core::Tensor::Init<int64_t>(2, device));
+    EXPECT_EQ(acc.ToFlatVector<int64_t>(), std::vector<int64_t>({3, 6, 9}));
+
+    // The inplace version can not change the shape.
+    EXPECT_ANY_THROW(rhs.AddMul_(lhs, src));
+}
+
 TEST_P(TensorPermuteDevices, Floor) {
     core::Device device = GetParam();
 
@@ -2403,6 +2620,316 @@ TEST_P(TensorPermuteDevices, NonZeroNumpy) {
     EXPECT_EQ(results[1].GetShape(), core::SizeVector{3});
 }
 
+TEST_P(TensorPermuteDevices, NonZeroLarge) {
+    core::Device device = GetParam();
+
+    // Spans several compaction chunks, with an empty chunk in between.
+    const int64_t rows = 1000;
+    const int64_t cols = 100;
+    std::vector<int32_t> vals(rows * cols, 0);
+    std::vector<int64_t> expected_rows;
+    std::vector<int64_t> expected_cols;
+    for (int64_t i = 0; i < rows * cols; i++) {
+        if (i % 7 == 0 && (i < 40000 || i >= 80000)) {
+            vals[i] = int32_t(i + 1);
+            expected_rows.push_back(i / cols);
+            expected_cols.push_back(i % cols);
+        }
+    }
+    core::Tensor a(vals, {rows, cols}, core::Dtype::Int32, device);
+    std::vector<core::Tensor> results = a.NonZeroNumpy();
+    EXPECT_EQ(results[0].ToFlatVector<int64_t>(), expected_rows);
+    EXPECT_EQ(results[1].ToFlatVector<int64_t>(), expected_cols);
+}
+
+TEST_P(TensorPermuteDevices, BooleanIndexGet) {
+    core::Device device = GetParam();
+
+    // Mask over the leading dimension of a non-contiguous tensor.
+    core::Tensor x = core::Tensor::Init<float>(
+            {{0, 1, 2}, {3, 4, 5}, {6, 7, 8}, {9, 10, 11}}, device);
+    core::Tensor x_t = x.T();
+    core::Tensor mask =
+            core::Tensor::Init<bool>({true, false, true}, device);
+    core::Tensor y = x_t.IndexGet({mask});
+    EXPECT_EQ(y.GetShape(), core::SizeVector({2, 4}));
+    EXPECT_EQ(y.ToFlatVector<float>(),
+              std::vector<float>({0, 3, 6, 9, 2, 5, 8, 11}));
+
+    // Mask of the same shape as the tensor.
+    core::Tensor mask_2d = x.Gt(core::Tensor::Init<float>({4.5}, device));
+    y = x.IndexGet({mask_2d});
+    EXPECT_EQ(y.GetShape(), core::SizeVector({7}));
+    EXPECT_EQ(y.ToFlatVector<float>(),
+              std::vector<float>({5, 6, 7, 8, 9, 10, 11}));
+
+    // Nothing selected.
+    y = x.IndexGet({core::Tensor::Zeros({4}, core::Dtype::Bool, device)});
+    EXPECT_EQ(y.GetShape(), core::SizeVector({0, 3}));
+
+    // Same result as indexing with the selected indices, over several
+    // compaction chunks.
+    const int64_t n = 100000;
+    core::Tensor points = core::Tensor::Arange(0, 3 * n, 1, core::Dtype::Int64,
+                                               device)
+                                  .View({n, 3});
+    core::Tensor select = points.Slice(1, 0, 1).Reshape({n}).Lt(
+            core::Tensor::Init<int64_t>({3 * n / 2}, device));
+    select.Slice(0, 1000, 2000).Fill(false);
+    core::Tensor selected = points.IndexGet({select});
+    core::Tensor selected_indices = select.NonZero();
+    EXPECT_EQ(selected.GetShape(),
+              core::SizeVector({selected_indices.GetShape()[1], 3}));
+    EXPECT_TRUE(selected.AllClose(points.IndexGet({selected_indices[0]})));
+}
+
+TEST_P(TensorPermuteDevices, Cat) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<float>({{0, 1}, {2, 3}}, device);
+    core::Tensor b = core::Tensor::Init<float>({{4, 5}}, device);
+    core::Tensor c = core::Tensor::Cat({a, b});
+    EXPECT_EQ(c.GetShape(), core::SizeVector({3, 2}));
+    EXPECT_EQ(c.ToFlatVector<float>(), std::vector<float>({0, 1, 2, 3, 4, 5}));
+
+    // Along the last dimension, with a non-contiguous and an empty tensor.
+    core::Tensor d = core::Tensor::Cat(
+            {a, a.T(), core::Tensor::Empty({2, 0}, core::Dtype::Float32,
+                                           device)},
+            -1);
+    EXPECT_EQ(d.GetShape(), core::SizeVector({2, 4}));
+    EXPECT_EQ(d.ToFlatVector<float>(),
+              std::vector<float>({0, 1, 0, 2, 2, 3, 1, 3}));
+
+    EXPECT_ANY_THROW(core::Tensor::Cat({}));
+    EXPECT_ANY_THROW(core::Tensor::Cat({a, b}, 1));
+    EXPECT_ANY_THROW(core::Tensor::Cat({a, a.To(core::Dtype::Float64)}));
+}
+
+TEST_P(TensorPermuteDevices, Stack) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<int32_t>({0, 1, 2}, device);
+    core::Tensor b = core::Tensor::Init<int32_t>({3, 4, 5}, device);
+    core::Tensor c = core::Tensor::Stack({a, b});
+    EXPECT_EQ(c.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(c.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 1, 2, 3, 4, 5}));
+
+    c = core::Tensor::Stack({a, b}, -1);
+    EXPECT_EQ(c.GetShape(), core::SizeVector({3, 2}));
+    EXPECT_EQ(c.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 3, 1, 4, 2, 5}));
+
+    EXPECT_ANY_THROW(core::Tensor::Stack({a, b.Slice(0, 0, 2)}));
+}
+
+TEST_P(TensorPermuteDevices, Sort) {
+    core::Device device = GetParam();
+
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    core::Tensor a =
+            core::Tensor::Init<float>({{3, nan, 1, 2}, {1, 1, 0, -1}}, device);
+    core::Tensor sorted = a.Sort();
+    EXPECT_EQ(sorted.GetShape(), core::SizeVector({2, 4}));
+    EXPECT_EQ(sorted[1].ToFlatVector<float>(),
+              std::vector<float>({-1, 0, 1, 1}));
+    EXPECT_EQ(sorted[0].Slice(0, 0, 3).ToFlatVector<float>(),
+              std::vector<float>({1, 2, 3}));
+    EXPECT_TRUE(std::isnan(sorted[0][3].Item<float>()));
+    EXPECT_EQ(a.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 3, 0, 1, 3, 2, 0, 1}));
+
+    // Along the first dimension.
+    EXPECT_EQ(a.Slice(1, 2, 4).Sort(0).ToFlatVector<float>(),
+              std::vector<float>({0, -1, 1, 2}));
+    EXPECT_EQ(a.Slice(1, 2, 4).ArgSort(0).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 1, 0, 0}));
+}
+
+TEST_P(TensorPermuteDevices, SortLarge) {
+    core::Device device = GetParam();
+
+    // Large enough to be sorted in parallel chunks, with many equal keys to
+    // check that ArgSort is stable.
+    const int64_t n = 300000;
+    std::vector<int32_t> vals(n);
+    for (int64_t i = 0; i < n; i++) {
+        vals[i] = int32_t((i * 7919) % 1000);
+    }
+    core::Tensor a(vals, {n}, core::Dtype::Int32, device);
+
+    std::vector<int64_t> expected_indices(n);
+    std::iota(expected_indices.begin(), expected_indices.end(), 0);
+    std::stable_sort(expected_indices.begin(), expected_indices.end(),
+                     [&](int64_t lhs, int64_t rhs) {
+                         return vals[lhs] < vals[rhs];
+                     });
+    EXPECT_EQ(a.ArgSort().ToFlatVector<int64_t>(), expected_indices);
+    std::sort(vals.begin(), vals.end());
+    EXPECT_EQ(a.Sort().ToFlatVector<int32_t>(), vals);
+}
+
+TEST_P(TensorPermuteDevices, Unique) {
+    core::Device device = GetParam();
+
+    core::Tensor a =
+            core::Tensor::Init<int64_t>({{5, 1, 5}, {3, 1, 5}}, device);
+    core::Tensor values, inverse, counts;
+    std::tie(values, inverse, counts) = a.Unique();
+    EXPECT_EQ(values.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 3, 5}));
+    EXPECT_EQ(inverse.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(inverse.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 0, 2, 1, 0, 2}));
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(), std::vector<int64_t>({2, 1, 3}));
+    EXPECT_TRUE(values.IndexGet({inverse}).AllClose(a));
+
+    // NaNs are equal to each other.
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    core::Tensor b = core::Tensor::Init<double>({nan, 2, nan}, device);
+    std::tie(values, inverse, counts) = b.Unique();
+    EXPECT_EQ(values.GetShape(), core::SizeVector({2}));
+    EXPECT_EQ(inverse.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 0, 1}));
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 2}));
+
+    std::tie(values, inverse, counts) =
+            core::Tensor::Empty({0}, core::Dtype::Float32, device).Unique();
+    EXPECT_EQ(values.GetShape(), core::SizeVector({0}));
+    EXPECT_EQ(inverse.GetShape(), core::SizeVector({0}));
+    EXPECT_EQ(counts.GetShape(), core::SizeVector({0}));
+}
+
+TEST_P(TensorPermuteDevices, UniqueRows) {
+    core::Device device = GetParam();
+
+    // Each row is one key, such as the voxel coordinates of points.
+    core::Tensor a = core::Tensor::Init<int32_t>({{1, 2, 3},
+                                                  {0, 5, 1},
+                                                  {1, 2, 3},
+                                                  {1, 2, -3},
+                                                  {0, 5, 1},
+                                                  {1, 2, 3}},
+                                                 device);
+    core::Tensor values, inverse, counts;
+    std::tie(values, inverse, counts) = a.Unique(0);
+    EXPECT_EQ(values.GetShape(), core::SizeVector({3, 3}));
+    EXPECT_EQ(values.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 5, 1, 1, 2, -3, 1, 2, 3}));
+    EXPECT_EQ(inverse.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 0, 2, 1, 0, 2}));
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(), std::vector<int64_t>({2, 1, 3}));
+    EXPECT_TRUE(values.IndexGet({inverse}).AllClose(a));
+
+    // Unique columns.
+    std::tie(values, inverse, counts) = a.T().Unique(1);
+    EXPECT_EQ(values.GetShape(), core::SizeVector({3, 3}));
+    EXPECT_TRUE(values.AllClose(
+            core::Tensor::Init<int32_t>({{0, 1, 1}, {5, 2, 2}, {1, -3, 3}},
+                                        device)));
+    EXPECT_EQ(inverse.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 0, 2, 1, 0, 2}));
+
+    // Rows of a 1D tensor are its elements.
+    core::Tensor b = core::Tensor::Init<int64_t>({5, 1, 5}, device);
+    std::tie(values, inverse, counts) = b.Unique(0);
+    EXPECT_EQ(values.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 5}));
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 2}));
+
+    std::tie(values, inverse, counts) =
+            core::Tensor::Empty({0, 3}, core::Dtype::Int32, device).Unique(0);
+    EXPECT_EQ(values.GetShape(), core::SizeVector({0, 3}));
+    EXPECT_EQ(inverse.GetShape(), core::SizeVector({0}));
+    EXPECT_EQ(counts.GetShape(), core::SizeVector({0}));
+}
+
+TEST_P(TensorPermuteDevices, Float16) {
+    core::Device device = GetParam();
+
+    // Round trip through Float16: round-to-nearest-even, overflow to inf and
+    // underflow to zero or a subnormal.
+    const float inf = std::numeric_limits<float>::infinity();
+    const float subnormal = std::ldexp(1.0f, -24);
+    core::Tensor src(std::vector<float>({0.1f, 1.0f, -2.5f, 65504.0f, 70000.0f,
+                                         1e-8f, subnormal, 2049.0f}),
+                     {8}, core::Dtype::Float32, device);
+    core::Tensor half = src.To(core::Dtype::Float16);
+    EXPECT_EQ(half.GetDtype(), core::Dtype::Float16);
+    EXPECT_EQ(half.GetDtype().ByteSize(), 2);
+    EXPECT_EQ(half.To(core::Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({0.0999755859375f, 1.0f, -2.5f, 65504.0f, inf,
+                                  0.0f, subnormal, 2048.0f}));
+    EXPECT_TRUE(std::isnan(static_cast<float>(
+            core::Float16(std::numeric_limits<float>::quiet_NaN()))));
+    EXPECT_EQ(core::Float16(-0.0f).Bits(), 0x8000);
+
+    // Element-wise ops round once per element.
+    core::Tensor a = core::Tensor::Init<float>({1.5f, 4.0f, 9.0f}, device)
+                             .To(core::Dtype::Float16);
+    core::Tensor b = core::Tensor::Init<float>({0.25f, -1.0f, 2.0f}, device)
+                             .To(core::Dtype::Float16);
+    EXPECT_EQ((a + b).GetDtype(), core::Dtype::Float16);
+    EXPECT_EQ((a + b).To(core::Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({1.75f, 3.0f, 11.0f}));
+    EXPECT_EQ((a * b).To(core::Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({0.375f, -4.0f, 18.0f}));
+    EXPECT_EQ(a.Sqrt().To(core::Dtype::Float32).ToFlatVector<float>()[1], 2.0f);
+    EXPECT_EQ((a > b).ToFlatVector<bool>(),
+              std::vector<bool>({true, true, true}));
+
+    // Accumulating 4096 ones in half precision would stall at 2048.
+    core::Tensor ones =
+            core::Tensor::Ones({4096}, core::Dtype::Float16, device);
+    EXPECT_EQ(ones.Sum({0}).Item<core::Float16>(), 4096.0f);
+    EXPECT_EQ(ones.Mean({0}).Item<core::Float16>(), 1.0f);
+    EXPECT_EQ(a.Max({0}).Item<core::Float16>(), 9.0f);
+    EXPECT_EQ(b.Min({0}).Item<core::Float16>(), -1.0f);
+    EXPECT_EQ(b.ArgMax({0}).Item<int64_t>(), 2);
+
+    // IndexGet / IndexSet.
+    core::Tensor idx = core::Tensor::Init<int64_t>({2, 0}, device);
+    EXPECT_EQ(a.IndexGet({idx}).To(core::Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({9.0f, 1.5f}));
+    a.IndexSet({idx}, b.IndexGet({idx}));
+    EXPECT_EQ(a.To(core::Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({0.25f, 4.0f, 2.0f}));
+}
+
+TEST_P(TensorPermuteDevices, SmallIntegerDtypes) {
+    core::Device device = GetParam();
+
+    core::Tensor i8(std::vector<int8_t>({-127, -1, 0, 127}), {4},
+                    core::Dtype::Int8, device);
+    EXPECT_EQ(i8.GetDtype().ByteSize(), 1);
+    EXPECT_EQ(i8.To(core::Dtype::Int64).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({-127, -1, 0, 127}));
+    EXPECT_EQ(i8.Abs().ToFlatVector<int8_t>(),
+              std::vector<int8_t>({127, 1, 0, 127}));
+    EXPECT_EQ(i8.Min({0}).Item<int8_t>(), -127);
+    EXPECT_EQ(i8.ArgMax({0}).Item<int64_t>(), 3);
+
+    core::Tensor i16(std::vector<int16_t>({-300, 2, 3, 300}), {4},
+                     core::Dtype::Int16, device);
+    EXPECT_EQ((i16 * 2).To(core::Dtype::Int32).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({-600, 4, 6, 600}));
+    EXPECT_EQ(i16.Sum({0}).Item<int16_t>(), 5);
+    EXPECT_EQ(i16.Max({0}).Item<int16_t>(), 300);
+
+    core::Tensor u32(std::vector<uint32_t>({4000000000u, 1, 2, 3}), {4},
+                     core::Dtype::UInt32, device);
+    EXPECT_EQ(u32.Max({0}).Item<uint32_t>(), 4000000000u);
+    EXPECT_EQ(u32.To(core::Dtype::Int64).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({4000000000, 1, 2, 3}));
+    EXPECT_EQ((u32 + u32).IndexGet({core::Tensor::Init<int64_t>({1, 3},
+                                                                device)})
+                      .ToFlatVector<uint32_t>(),
+              std::vector<uint32_t>({2, 6}));
+    u32.IndexSet({core::Tensor::Init<int64_t>({0}, device)},
+                 core::Tensor::Init<uint32_t>({7}, device));
+    EXPECT_EQ(u32.ToFlatVector<uint32_t>(),
+              std::vector<uint32_t>({7, 1, 2, 3}));
+    EXPECT_EQ(u32[0].Item<uint32_t>(), 7u);
+}
+
 TEST_P(TensorPermuteDevices, CreationEmpty) {
     core::Device device = GetParam();
 
@@ -0,0 +1,169 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/TensorExpr.h"
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class TensorExprPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(TensorExpr,
+                         TensorExprPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(TensorExprPermuteDevices, Eval) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<float>({{1, 2, 3}, {4, 5, 6}}, device);
+    core::Tensor b = core::Tensor::Init<float>({10, 20, 30}, device);
+
+    // Broadcasting, scalars and unary ops.
+    core::TensorExpr expr = ((core::TensorExpr(a) - b) * 2.f + 1.f).Abs();
+    EXPECT_EQ(expr.GetShape(), core::SizeVector({2, 3}));
+    core::Tensor dst = expr.Eval();
+    EXPECT_TRUE(dst.AllClose((((a - b) * 2.f) + 1.f).Abs()));
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({17, 35, 53, 11, 29, 47}));
+
+    // Broadcasting of the left operand.
+    dst = (core::TensorExpr(b) / a).Eval();
+    EXPECT_EQ(dst.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_TRUE(dst.AllClose(b / a));
+
+    // Neg and Sqrt.
+    dst = (-core::TensorExpr(a)).Neg().Sqrt().Neg().Eval();
+    EXPECT_TRUE(dst.AllClose(a.Sqrt().Neg()));
+
+    // Evaluating a plain tensor copies it.
+    dst = core::TensorExpr(a).Eval();
+    EXPECT_TRUE(dst.AllClose(a));
+    EXPECT_NE(dst.GetDataPtr(), a.GetDataPtr());
+}
+
+TEST_P(TensorExprPermuteDevices, EvalNonContiguous) {
+    core::Device device = GetParam();
+    core::Tensor a =
+            core::Tensor::Arange(0, 24, 1, core::Dtype::Float64, device)
+                    .Reshape({2, 3, 4});
+    core::Tensor b =
+            core::Tensor::Arange(0, 12, 1, core::Dtype::Float64, device)
+                    .Reshape({3, 4});
+    core::Tensor a_slice = a.Slice(2, 0, 4, 2);
+    core::Tensor b_t = b.T().Slice(0, 1, 3);
+
+    core::Tensor dst = (core::TensorExpr(a_slice) * b_t.T()).Eval();
+    EXPECT_TRUE(dst.AllClose(a_slice * b_t.T()));
+
+    core::Tensor c = a.Permute({2, 0, 1});
+    dst = (core::TensorExpr(c) - c.Slice(0, 0, 1)).Eval();
+    EXPECT_TRUE(dst.AllClose(c - c.Slice(0, 0, 1)));
+}
+
+TEST_P(TensorExprPermuteDevices, SharedSubExpression) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<float>({1, 2, 3, 4}, device);
+    core::Tensor b = core::Tensor::Init<float>({4, 3, 2, 1}, device);
+
+    core::TensorExpr diff = core::TensorExpr(a) - b;
+    core::Tensor dst = (diff * diff + diff).Eval();
+    EXPECT_EQ(dst.ToFlatVector<float>(), std::vector<float>({6, 0, 2, 12}));
+
+    // The same tensor used twice is loaded once.
+    dst = (core::TensorExpr(a) * a).Eval();
+    EXPECT_EQ(dst.ToFlatVector<float>(), std::vector<float>({1, 4, 9, 16}));
+}
+
+TEST_P(TensorExprPermuteDevices, Reduction) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<float>({{1, 2, 3}, {4, 5, 6}}, device);
+    core::Tensor b = core::Tensor::Init<float>({{6, 5, 4}, {3, 2, 1}}, device);
+    core::TensorExpr diff = core::TensorExpr(a) - b;
+
+    // Full reductions are fused.
+    core::Tensor sum = (diff * diff).Sum({0, 1});
+    EXPECT_EQ(sum.GetShape(), core::SizeVector({}));
+    EXPECT_EQ(sum.Item<float>(), 70.f);
+    EXPECT_EQ((diff * diff).Sum({0, 1}, true).GetShape(),
+              core::SizeVector({1, 1}));
+    EXPECT_EQ(diff.Prod({1, 0}).Item<float>(), -225.f);
+    EXPECT_EQ(diff.Min({0, 1}).Item<float>(), -5.f);
+    EXPECT_EQ(diff.Max({0, 1}).Item<float>(), 5.f);
+
+    // Partial reductions.
+    EXPECT_TRUE(
+            (diff * diff).Sum({1}).AllClose(((a - b) * (a - b)).Sum({1})));
+    EXPECT_TRUE(diff.Max({0}, true).AllClose((a - b).Max({0}, true)));
+
+    // Reductions over more elements than one chunk.
+    core::Tensor ones =
+            core::Tensor::Ones({100000, 3}, core::Dtype::Float64, device);
+    core::Tensor twos = ones * 2.0;
+    EXPECT_EQ((core::TensorExpr(twos) - ones).Sum({0, 1}).Item<double>(),
+              300000.0);
+
+    // Zero-size reductions.
+    core::Tensor empty =
+            core::Tensor::Empty({0, 3}, core::Dtype::Float32, device);
+    EXPECT_EQ(core::TensorExpr(empty).Sum({0, 1}).Item<float>(), 0.f);
+    EXPECT_ANY_THROW(core::TensorExpr(empty).Max({0, 1}));
+}
+
+TEST_P(TensorExprPermuteDevices, Dtypes) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<int32_t>({-3, -2, 7}, device);
+    core::Tensor dst = (core::TensorExpr(a) * a / 2).Eval();
+    EXPECT_EQ(dst.ToFlatVector<int32_t>(), std::vector<int32_t>({4, 2, 24}));
+    EXPECT_EQ(core::TensorExpr(a).Abs().Sum({0}).Item<int32_t>(), 12);
+    EXPECT_ANY_THROW(core::TensorExpr(a).Sqrt());
+
+    core::Tensor h = core::Tensor::Init<float>({0.5, 1.5, 2.5}, device)
+                             .To(core::Dtype::Float16);
+    core::TensorExpr h_expr = core::TensorExpr(h) * h;
+    EXPECT_EQ(h_expr.Eval().GetDtype(), core::Dtype::Float16);
+    EXPECT_TRUE(h_expr.Eval()
+                        .To(core::Dtype::Float32)
+                        .AllClose(core::Tensor::Init<float>({0.25, 2.25, 6.25},
+                                                            device)));
+    EXPECT_EQ(static_cast<float>(h_expr.Sum({0}).Item<core::Float16>()),
+              8.75f);
+
+    // Mismatched dtypes and bool tensors are rejected.
+    core::Tensor f = core::Tensor::Ones({3}, core::Dtype::Float32, device);
+    EXPECT_ANY_THROW(core::TensorExpr(a) + f);
+    EXPECT_ANY_THROW(
+            core::TensorExpr(core::Tensor::Ones({3}, core::Dtype::Bool)));
+    EXPECT_ANY_THROW(
+            core::TensorExpr(f) +
+            core::Tensor::Ones({2}, core::Dtype::Float32, device));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -144,5 +144,156 @@ TEST(KDTreeFlann, SearchHybrid) {
     ExpectEQ(ref_distance2, distance2);
 }
 
+TEST(KDTreeFlann, SearchBatch) {
+    int size = 1000;
+    int num_queries = 3000;
+
+    geometry::PointCloud pc;
+    std::vector<Eigen::Vector3d> queries(num_queries);
+
+    Eigen::Vector3d vmin(0.0, 0.0, 0.0);
+    Eigen::Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+    Rand(queries, vmin, vmax, 1);
+
+    geometry::KDTreeFlann kdtree(pc);
+
+    std::vector<std::shared_ptr<geometry::KDTreeSearchParam>> params = {
+            std::make_shared<geometry::KDTreeSearchParamKNN>(30),
+            std::make_shared<geometry::KDTreeSearchParamRadius>(1.0),
+            std::make_shared<geometry::KDTreeSearchParamHybrid>(1.0, 15)};
+    for (const auto &param : params) {
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        std::vector<int64_t> offsets;
+        EXPECT_TRUE(kdtree.SearchBatch(queries, *param, indices, distance2,
+                                       offsets));
+        ASSERT_EQ(offsets.size(), size_t(num_queries + 1));
+        EXPECT_EQ(offsets.back(), int64_t(indices.size()));
+        EXPECT_EQ(indices.size(), distance2.size());
+
+        for (int i = 0; i < num_queries; i++) {
+            std::vector<int> ref_indices;
+            std::vector<double> ref_distance2;
+            kdtree.Search(queries[i], *param, ref_indices, ref_distance2);
+            std::vector<int> query_indices(indices.begin() + offsets[i],
+                                           indices.begin() + offsets[i + 1]);
+            std::vector<double> query_distance2(
+                    distance2.begin() + offsets[i],
+                    distance2.begin() + offsets[i + 1]);
+            ExpectEQ(ref_indices, query_indices);
+            ExpectEQ(ref_distance2, query_distance2);
+        }
+    }
+
+    // Queries of the wrong dimension have no neighbors.
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    std::vector<int64_t> offsets;
+    EXPECT_FALSE(kdtree.SearchBatch(Eigen::MatrixXd::Zero(2, 5),
+                                    geometry::KDTreeSearchParamKNN(), indices,
+                                    distance2, offsets));
+    EXPECT_EQ(offsets, std::vector<int64_t>(6, 0));
+    EXPECT_TRUE(indices.empty());
+}
+
+TEST(KDTreeFlann, SearchBatchBlocked) {
+    int size = 1000;
+    int num_queries = 3000;
+
+    geometry::PointCloud pc;
+    std::vector<Eigen::Vector3d> queries(num_queries);
+
+    Eigen::Vector3d vmin(0.0, 0.0, 0.0);
+    Eigen::Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+    Rand(queries, vmin, vmax, 1);
+
+    geometry::KDTreeFlann kdtree(pc);
+    geometry::KDTreeSearchParamHybrid param(1.0, 15);
+
+    std::vector<int> ref_indices;
+    std::vector<double> ref_distance2;
+    std::vector<int64_t> ref_offsets;
+    kdtree.SearchBatch(queries, param, ref_indices, ref_distance2,
+                       ref_offsets);
+
+    // The last block is smaller than the block size.
+    int64_t next_block_begin = 0;
+    kdtree.SearchBatchBlocked(
+            queries, param,
+            [&](int64_t block_begin, int64_t block_end,
+                const std::vector<int> &indices,
+                const std::vector<double> &distance2,
+                const std::vector<int64_t> &offsets) {
+                EXPECT_EQ(block_begin, next_block_begin);
+                EXPECT_LE(block_end - block_begin, 700);
+                next_block_begin = block_end;
+                ASSERT_EQ(offsets.size(), size_t(block_end - block_begin + 1));
+                const int64_t ref_begin = ref_offsets[block_begin];
+                const int64_t ref_end = ref_offsets[block_end];
+                ExpectEQ(indices,
+                         std::vector<int>(ref_indices.begin() + ref_begin,
+                                          ref_indices.begin() + ref_end));
+                ExpectEQ(distance2, std::vector<double>(
+                                            ref_distance2.begin() + ref_begin,
+                                            ref_distance2.begin() + ref_end));
+            },
+            700);
+    EXPECT_EQ(next_block_begin, num_queries);
+}
+
+TEST(KDTreeFlann, DataStorage) {
+    int size = 1000;
+    int num_queries = 100;
+
+    geometry::PointCloud pc;
+    std::vector<Eigen::Vector3d> queries(num_queries);
+
+    Eigen::Vector3d vmin(0.0, 0.0, 0.0);
+    Eigen::Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+    Rand(queries, vmin, vmax, 1);
+
+    geometry::KDTreeFlann kdtree(pc);
+    geometry::KDTreeFlann kdtree_reference(
+            pc, geometry::KDTreeFlann::DataStorage::Reference);
+    geometry::KDTreeFlann kdtree_float(
+            pc, geometry::KDTreeFlann::DataStorage::Float);
+
+    std::vector<std::shared_ptr<geometry::KDTreeSearchParam>> params = {
+            std::make_shared<geometry::KDTreeSearchParamKNN>(30),
+            std::make_shared<geometry::KDTreeSearchParamRadius>(2.0),
+            std::make_shared<geometry::KDTreeSearchParamHybrid>(2.0, 15)};
+    for (const auto &param : params) {
+        for (const Eigen::Vector3d &query : queries) {
+            std::vector<int> ref_indices;
+            std::vector<double> ref_distance2;
+            int ref_result =
+                    kdtree.Search(query, *param, ref_indices, ref_distance2);
+
+            std::vector<int> indices;
+            std::vector<double> distance2;
+            EXPECT_EQ(kdtree_reference.Search(query, *param, indices,
+                                              distance2),
+                      ref_result);
+            ExpectEQ(ref_indices, indices);
+            ExpectEQ(ref_distance2, distance2);
+
+            // Neighbors at almost equal distances may come in a different
+            // order in single precision, so only the distances are compared.
+            EXPECT_EQ(kdtree_float.Search(query, *param, indices, distance2),
+                      ref_result);
+            ExpectEQ(ref_distance2, distance2, 1e-4);
+        }
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -594,6 +594,43 @@ TEST(PointCloud, VoxelDownSample) {
     ExpectEQ(ApplyIndices(pc_down->colors_, sort_indices), colors_down);
 }
 
+TEST(PointCloud, VoxelDownSampleAndTrace) {
+    // voxel_size: 1
+    // voxel_min_bound: (0, 0, 0)
+    std::vector<Eigen::Vector3d> points{
+            // voxel_{0, 1, 2}, octants 3 and 4
+            {0.5, 1.6, 2.4},
+            {0.2, 1.1, 2.9},
+            // voxel_{0, 0, 0}, octants 0, 7 and 1
+            {0.1, 0.2, 0.3},
+            {0.9, 0.8, 0.7},
+            {0.6, 0.1, 0.1},
+    };
+    geometry::PointCloud pcd;
+    pcd.points_ = points;
+
+    // Ground-truth reference, sorted by voxel index.
+    std::vector<Eigen::Vector3d> points_down{
+            {1.6 / 3, 1.1 / 3, 1.1 / 3},
+            {0.35, 1.35, 2.65},
+    };
+    Eigen::MatrixXi cubic_id_down(2, 8);
+    cubic_id_down << 2, 4, -1, -1, -1, -1, -1, 3, -1, -1, -1, 0, 1, -1, -1,
+            -1;
+    std::vector<std::vector<int>> original_indices_down{{2, 3, 4}, {0, 1}};
+
+    std::shared_ptr<geometry::PointCloud> pc_down;
+    Eigen::MatrixXi cubic_id;
+    std::vector<std::vector<int>> original_indices;
+    std::tie(pc_down, cubic_id, original_indices) =
+            pcd.VoxelDownSampleAndTrace(1.0, Eigen::Vector3d(0, 0, 0),
+                                        Eigen::Vector3d(3, 3, 3));
+
+    ExpectEQ(pc_down->points_, points_down);
+    EXPECT_TRUE(cubic_id == cubic_id_down);
+    EXPECT_EQ(original_indices, original_indices_down);
+}
+
 TEST(PointCloud, UniformDownSample) {
     std::vector<Eigen::Vector3d> points({
             {0, 0, 0},
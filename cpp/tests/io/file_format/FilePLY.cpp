@@ -24,6 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -39,7 +42,63 @@ TEST(FilePLY, DISABLED_ReadColorCallback) { NotImplemented(); }
 
 TEST(FilePLY, DISABLED_ReadFaceCallBack) { NotImplemented(); }
 
-TEST(FilePLY, DISABLED_ReadPointCloudFromPLY) { NotImplemented(); }
+TEST(FilePLY, ReadPointCloudFromPLY) {
+    // A binary PLY file with an element before the vertices, properties of
+    // mixed types, and a list property after the vertices.
+    const std::string filename = "test_mixed.ply";
+    const std::string header =
+            "ply\n"
+            "format binary_little_endian 1.0\n"
+            "comment Created by hand\n"
+            "element camera 1\n"
+            "property float focal\n"
+            "element vertex 3\n"
+            "property float x\n"
+            "property double y\n"
+            "property int z\n"
+            "property uchar red\n"
+            "property uchar green\n"
+            "property uchar blue\n"
+            "property short label\n"
+            "element face 1\n"
+            "property list uchar int vertex_indices\n"
+            "end_header\n";
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    ASSERT_NE(file, nullptr);
+    fwrite(header.data(), 1, header.size(), file);
+    float focal = 525.0f;
+    fwrite(&focal, sizeof(focal), 1, file);
+    for (int i = 0; i < 3; i++) {
+        float x = 0.5f * i;
+        double y = -1.25 * i;
+        int32_t z = 10 * i;
+        uint8_t rgb[3] = {uint8_t(i), uint8_t(127 + i), 255};
+        int16_t label = int16_t(-i);
+        fwrite(&x, sizeof(x), 1, file);
+        fwrite(&y, sizeof(y), 1, file);
+        fwrite(&z, sizeof(z), 1, file);
+        fwrite(rgb, 1, 3, file);
+        fwrite(&label, sizeof(label), 1, file);
+    }
+    uint8_t face_size = 3;
+    int32_t face[3] = {0, 1, 2};
+    fwrite(&face_size, 1, 1, file);
+    fwrite(face, sizeof(int32_t), 3, file);
+    fclose(file);
+
+    geometry::PointCloud pointcloud;
+    EXPECT_TRUE(io::ReadPointCloud(filename, pointcloud));
+    ASSERT_EQ(pointcloud.points_.size(), 3u);
+    ASSERT_EQ(pointcloud.colors_.size(), 3u);
+    EXPECT_FALSE(pointcloud.HasNormals());
+    for (int i = 0; i < 3; i++) {
+        ExpectEQ(pointcloud.points_[i],
+                 Eigen::Vector3d(0.5 * i, -1.25 * i, 10.0 * i));
+        ExpectEQ(pointcloud.colors_[i],
+                 Eigen::Vector3d(Eigen::Vector3d(i, 127 + i, 255) / 255.0));
+    }
+    utility::filesystem::RemoveFile(filename);
+}
 
 TEST(FilePLY, DISABLED_WritePointCloudToPLY) { NotImplemented(); }
 
@@ -24,12 +24,102 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <clocale>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
 namespace tests {
 
-TEST(FileXYZ, DISABLED_ReadPointCloudFromXYZ) { NotImplemented(); }
+TEST(FileXYZ, ReadPointCloudFromXYZ) {
+    // Lines that are not points, numbers in various notations, CRLF line
+    // breaks, and enough lines for the file to be parsed in several chunks.
+    std::string content =
+            "# comment\n"
+            "1 2\n"
+            "\t-1.5e-3  +2.25E2 3.\r\n"
+            "0.1000000000000000055511151231257827 -0.0 1e-30 extra\n"
+            "4 5 6abc\n"
+            "\n";
+    for (int i = 0; i < 10000; i++) {
+        content += std::to_string(i * 0.37) + " " + std::to_string(-i) + " " +
+                   std::to_string(i * 1e-7) + "\n";
+    }
+    content += "7 8 9";
+    const std::string filename = "test_numbers.xyz";
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    ASSERT_NE(file, nullptr);
+    fwrite(content.data(), 1, content.size(), file);
+    fclose(file);
+
+    // The points are the lines read by sscanf().
+    std::vector<Eigen::Vector3d> points;
+    size_t begin = 0;
+    while (begin < content.size()) {
+        size_t end = content.find('\n', begin);
+        if (end == std::string::npos) {
+            end = content.size();
+        }
+        const std::string line = content.substr(begin, end - begin);
+        double x, y, z;
+        if (sscanf(line.c_str(), "%lf %lf %lf", &x, &y, &z) == 3) {
+            points.push_back(Eigen::Vector3d(x, y, z));
+        }
+        begin = end + 1;
+    }
+
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloud(filename, pcd));
+    EXPECT_EQ(std::remove(filename.c_str()), 0);
+    ASSERT_EQ(pcd.points_.size(), points.size());
+    for (size_t i = 0; i < points.size(); i++) {
+        ASSERT_EQ(pcd.points_[i], points[i]);
+    }
+}
+
+TEST(FileXYZ, ReadPointCloudFromXYZCommaLocale) {
+    // The decimal point stays '.' under a locale with a decimal comma, also
+    // for numbers with more significant digits than a double holds exactly.
+    const std::string old_locale = std::setlocale(LC_NUMERIC, nullptr);
+    bool has_comma_locale = false;
+    for (const char *name :
+         {"de_DE.UTF-8", "de_DE.utf8", "de_DE", "fr_FR.UTF-8", "German"}) {
+        if (std::setlocale(LC_NUMERIC, name) != nullptr &&
+            *std::localeconv()->decimal_point == ',') {
+            has_comma_locale = true;
+            break;
+        }
+    }
+    if (!has_comma_locale) {
+        std::setlocale(LC_NUMERIC, old_locale.c_str());
+        GTEST_SKIP() << "No locale with a decimal comma is installed.";
+    }
+
+    const std::string filename = "test_comma_locale.xyz";
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    ASSERT_NE(file, nullptr);
+    fputs("4500000.1234567890 -0.12345678901234567 123456789012345678.9\n"
+          "1.5 2.25 3.125\n",
+          file);
+    fclose(file);
+
+    geometry::PointCloud pcd;
+    const bool success = io::ReadPointCloud(filename, pcd);
+    std::setlocale(LC_NUMERIC, old_locale.c_str());
+    EXPECT_TRUE(success);
+    EXPECT_EQ(std::remove(filename.c_str()), 0);
+    ASSERT_EQ(pcd.points_.size(), 2u);
+    EXPECT_EQ(pcd.points_[0],
+              Eigen::Vector3d(4500000.1234567890, -0.12345678901234567,
+                              123456789012345678.9));
+    EXPECT_EQ(pcd.points_[1], Eigen::Vector3d(1.5, 2.25, 3.125));
+}
 
 TEST(FileXYZ, DISABLED_WritePointCloudToXYZ) { NotImplemented(); }
 
@@ -24,6 +24,14 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/integration/ScalableTSDFVolume.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/geometry/RGBDImage.h"
+#include "open3d/pipelines/integration/UniformTSDFVolume.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -39,11 +47,180 @@ TEST(ScalableTSDFVolume, DISABLED_MemberData) { NotImplemented(); }
 
 TEST(ScalableTSDFVolume, DISABLED_Reset) { NotImplemented(); }
 
-TEST(ScalableTSDFVolume, DISABLED_Integrate) { NotImplemented(); }
+// A tilted plane in front of the camera.
+static geometry::RGBDImage CreatePlaneImage(
+        const camera::PinholeCameraIntrinsic &intrinsic) {
+    const int width = intrinsic.width_;
+    const int height = intrinsic.height_;
+    geometry::Image depth;
+    depth.Prepare(width, height, 1, 4);
+    geometry::Image color;
+    color.Prepare(width, height, 3, 1);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            *depth.PointerAt<float>(u, v) = 0.4f + 0.002f * u;
+            uint8_t *rgb = color.PointerAt<uint8_t>(u, v, 0);
+            rgb[0] = uint8_t(4 * u);
+            rgb[1] = uint8_t(4 * v);
+            rgb[2] = 128;
+        }
+    }
+    return geometry::RGBDImage(color, depth);
+}
+
+TEST(ScalableTSDFVolume, Integrate) {
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    geometry::RGBDImage image = CreatePlaneImage(intrinsic);
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic(0, 3) = 0.03;
+
+    const double voxel_length = 0.01;
+    const double sdf_trunc = 0.04;
+    const int resolution = 16;
+    const double volume_unit_length = voxel_length * resolution;
+    const auto color_type = pipelines::integration::TSDFVolumeColorType::RGB8;
+    pipelines::integration::ScalableTSDFVolume volume(
+            voxel_length, sdf_trunc, color_type, resolution,
+            /*depth_sampling_stride*/ 1);
+    // The second frame reuses the cached depth to camera distance multiplier.
+    volume.Integrate(image, intrinsic, extrinsic);
+    volume.Integrate(image, intrinsic, extrinsic);
+    EXPECT_GT(volume.volume_units_.size(), 0u);
+
+    // Each volume unit matches a uniform volume covering the same space.
+    for (const auto &unit : volume.volume_units_) {
+        pipelines::integration::UniformTSDFVolume uniform_volume(
+                volume_unit_length, resolution, sdf_trunc, color_type,
+                unit.first.cast<double>() * volume_unit_length);
+        uniform_volume.Integrate(image, intrinsic, extrinsic);
+        uniform_volume.Integrate(image, intrinsic, extrinsic);
+
+        const auto &voxels = unit.second.volume_->voxels_;
+        ASSERT_EQ(voxels.size(), uniform_volume.voxels_.size());
+        int num_mismatches = 0;
+        for (size_t i = 0; i < voxels.size(); i++) {
+            const geometry::TSDFVoxel &voxel = uniform_volume.voxels_[i];
+            if (voxels[i].tsdf_ != voxel.tsdf_ ||
+                voxels[i].weight_ != voxel.weight_ ||
+                voxels[i].color_ != voxel.color_) {
+                num_mismatches++;
+            }
+        }
+        EXPECT_EQ(num_mismatches, 0);
+    }
+}
 
 TEST(ScalableTSDFVolume, DISABLED_ExtractPointCloud) { NotImplemented(); }
 
-TEST(ScalableTSDFVolume, DISABLED_ExtractTriangleMesh) { NotImplemented(); }
+// Lexicographic order of points.
+static bool LessPoint(const Eigen::Vector3d &a, const Eigen::Vector3d &b) {
+    return std::lexicographical_compare(a.data(), a.data() + 3, b.data(),
+                                        b.data() + 3);
+}
+
+TEST(ScalableTSDFVolume, ExtractTriangleMesh) {
+    camera::PinholeCameraIntrinsic intrinsic(16, 12, 120.0, 120.0, 7.5, 5.5);
+    geometry::RGBDImage image = CreatePlaneImage(intrinsic);
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic(0, 3) = 0.03;
+
+    // Small volume units, so that many vertices lie on unit boundaries.
+    pipelines::integration::ScalableTSDFVolume volume(
+            0.01, 0.04, pipelines::integration::TSDFVolumeColorType::RGB8,
+            /*volume_unit_resolution*/ 4, /*depth_sampling_stride*/ 1);
+    volume.Integrate(image, intrinsic, extrinsic);
+    auto mesh = volume.ExtractTriangleMesh();
+    EXPECT_EQ(mesh->vertex_colors_.size(), mesh->vertices_.size());
+
+    // Mesh extracted by the serial implementation. The vertices are sorted
+    // lexicographically, since their order depends on the iteration order of
+    // the volume units. Each triangle starts at its smallest vertex index, and
+    // the triangles are sorted.
+    const std::vector<Eigen::Vector3d> ref_vertices = {
+            {-0.055, -0.015, 0.400000015},
+            {-0.055, -0.005, 0.400000015},
+            {-0.055, 0.005, 0.400000015},
+            {-0.055, 0.015, 0.400000015},
+            {-0.0466649632, -0.015, 0.405},
+            {-0.0466649632, 0.015, 0.405},
+            {-0.0466649609, -0.005, 0.405},
+            {-0.0466649609, 0.005, 0.405},
+            {-0.045, -0.015, 0.406000018},
+            {-0.045, -0.005, 0.406000018},
+            {-0.045, 0.005, 0.406000018},
+            {-0.045, 0.015, 0.406000018},
+            {-0.035, -0.015, 0.412000006},
+            {-0.035, -0.005, 0.412000006},
+            {-0.035, 0.005, 0.412000006},
+            {-0.035, 0.015, 0.412000006},
+            {-0.0300000248, -0.005, 0.415},
+            {-0.0300000248, 0.005, 0.415},
+            {-0.0300000248, -0.015, 0.415},
+            {-0.0300000248, 0.015, 0.415},
+            {-0.025, -0.015, 0.418000024},
+            {-0.025, -0.005, 0.418000024},
+            {-0.025, 0.005, 0.418000024},
+            {-0.025, 0.015, 0.418000024},
+            {-0.015, -0.015, 0.424000012},
+            {-0.015, -0.005, 0.424000012},
+            {-0.015, 0.005, 0.424000012},
+            {-0.015, 0.015, 0.424000012},
+            {-0.0133350887, -0.005, 0.425},
+            {-0.0133350887, 0.005, 0.425},
+            {-0.0133350864, -0.015, 0.425},
+            {-0.0133350864, 0.015, 0.425},
+            {-0.005, -0.015, 0.429167865},
+            {-0.005, -0.005, 0.429167867},
+            {-0.005, 0.005, 0.429167867},
+            {-0.005, 0.015, 0.429167865}};
+    const std::vector<Eigen::Vector3i> ref_triangles = {
+            {0, 1, 6}, {0, 6, 4}, {1, 2, 7}, {1, 7, 6},
+            {2, 3, 5}, {2, 5, 7}, {4, 6, 8}, {5, 10, 7},
+            {5, 11, 10}, {6, 7, 9}, {6, 9, 8}, {7, 10, 9},
+            {8, 9, 13}, {8, 13, 12}, {9, 10, 14}, {9, 14, 13},
+            {10, 11, 15}, {10, 15, 14}, {12, 13, 16}, {12, 16, 18},
+            {13, 14, 17}, {13, 17, 16}, {14, 15, 19}, {14, 19, 17},
+            {16, 17, 21}, {16, 20, 18}, {16, 21, 20}, {17, 19, 22},
+            {17, 22, 21}, {19, 23, 22}, {20, 21, 25}, {20, 25, 24},
+            {21, 22, 26}, {21, 26, 25}, {22, 23, 27}, {22, 27, 26},
+            {24, 25, 28}, {24, 28, 30}, {25, 26, 29}, {25, 29, 28},
+            {26, 27, 31}, {26, 31, 29}, {28, 29, 33}, {28, 32, 30},
+            {28, 33, 32}, {29, 31, 34}, {29, 34, 33}, {31, 35, 34}};
+
+    ASSERT_EQ(mesh->vertices_.size(), ref_vertices.size());
+    std::vector<int> order(mesh->vertices_.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return LessPoint(mesh->vertices_[a], mesh->vertices_[b]);
+    });
+    std::vector<Eigen::Vector3d> vertices;
+    std::vector<int> new_index(order.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        vertices.push_back(mesh->vertices_[order[i]]);
+        new_index[order[i]] = int(i);
+    }
+    ExpectEQ(vertices, ref_vertices);
+
+    std::vector<Eigen::Vector3i> triangles;
+    for (const Eigen::Vector3i &triangle : mesh->triangles_) {
+        Eigen::Vector3i t(new_index[triangle(0)], new_index[triangle(1)],
+                          new_index[triangle(2)]);
+        int first;
+        t.minCoeff(&first);
+        triangles.push_back(Eigen::Vector3i(t((first + 0) % 3),
+                                            t((first + 1) % 3),
+                                            t((first + 2) % 3)));
+    }
+    std::sort(triangles.begin(), triangles.end(),
+              [](const Eigen::Vector3i &a, const Eigen::Vector3i &b) {
+                  return std::lexicographical_compare(
+                          a.data(), a.data() + 3, b.data(), b.data() + 3);
+              });
+    ASSERT_EQ(triangles.size(), ref_triangles.size());
+    for (size_t i = 0; i < triangles.size(); i++) {
+        EXPECT_EQ(triangles[i], ref_triangles[i]) << "triangle " << i;
+    }
+}
 
 TEST(ScalableTSDFVolume, DISABLED_ExtractVoxelPointCloud) { NotImplemented(); }
 
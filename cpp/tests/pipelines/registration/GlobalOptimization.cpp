@@ -24,6 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/GlobalOptimization.h"
+
+#include <Eigen/Dense>
+
+#include "open3d/pipelines/registration/PoseGraph.h"
+#include "open3d/utility/Eigen.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -49,5 +55,54 @@ TEST(GlobalOptimization, DISABLED_CreatePoseGraphWithoutInvalidEdges) {
     NotImplemented();
 }
 
+TEST(GlobalOptimization, LinearSolver) {
+    using namespace pipelines::registration;
+
+    // A loop of nodes whose initial poses are perturbed away from the
+    // odometry / loop-closure edges.
+    const int n_nodes = 8;
+    PoseGraph pose_graph_init;
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> gt_poses;
+    for (int i = 0; i < n_nodes; i++) {
+        Eigen::Vector6d gt_vec;
+        gt_vec << 0.0, 0.0, 0.1 * i, std::cos(0.8 * i), std::sin(0.8 * i), 0.0;
+        gt_poses.push_back(utility::TransformVector6dToMatrix4d(gt_vec));
+        Eigen::Vector6d noise;
+        noise << 0.01 * i, -0.01, 0.02, 0.03 * (i % 2), -0.02, 0.01 * i;
+        pose_graph_init.nodes_.emplace_back(
+                utility::TransformVector6dToMatrix4d(gt_vec + noise));
+    }
+    for (int i = 0; i < n_nodes; i++) {
+        int j = (i + 1) % n_nodes;
+        pose_graph_init.edges_.emplace_back(
+                i, j, gt_poses[j].inverse() * gt_poses[i],
+                Eigen::Matrix6d::Identity(), false, 1.0);
+    }
+    pose_graph_init.nodes_[0].pose_ = gt_poses[0];
+
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> ref_poses;
+    for (auto linear_solver : {GlobalOptimizationLinearSolver::Dense,
+                               GlobalOptimizationLinearSolver::SparseCholesky,
+                               GlobalOptimizationLinearSolver::
+                                       ConjugateGradient}) {
+        PoseGraph pose_graph = pose_graph_init;
+        GlobalOptimizationOption option(0.075, 0.25, 1.0, 0, linear_solver);
+        GlobalOptimization(pose_graph, GlobalOptimizationLevenbergMarquardt(),
+                           GlobalOptimizationConvergenceCriteria(), option);
+        std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses;
+        for (const auto &node : pose_graph.nodes_) {
+            poses.push_back(node.pose_);
+        }
+        if (ref_poses.empty()) {
+            ref_poses = poses;
+            for (int i = 0; i < n_nodes; i++) {
+                ExpectEQ(ref_poses[i], gt_poses[i], 1e-4);
+            }
+        } else {
+            ExpectEQ(poses, ref_poses, 1e-4);
+        }
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
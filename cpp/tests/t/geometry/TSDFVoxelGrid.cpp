@@ -107,5 +107,69 @@ TEST_P(TSDFVoxelGridPermuteDevices, Integrate) {
     EXPECT_NEAR(result.fitness_, 1.0, 1e-5);
     EXPECT_NEAR(result.inlier_rmse_, 0, 1e-5);
 }
+
+TEST_P(TSDFVoxelGridPermuteDevices, IntegrateFloat16) {
+    core::Device device = GetParam();
+
+    float voxel_size = 0.008;
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor(
+            std::vector<float>({static_cast<float>(focal_length.first), 0,
+                                static_cast<float>(principal_point.first), 0,
+                                static_cast<float>(focal_length.second),
+                                static_cast<float>(principal_point.second), 0,
+                                0, 1}),
+            {3, 3}, core::Dtype::Float32);
+    auto trajectory = io::CreatePinholeCameraTrajectoryFromFile(
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log");
+
+    // Half precision TSDF values (4 bytes less per voxel) should reproduce the
+    // Float32 surface.
+    std::vector<geometry::PointCloud> pcds;
+    for (core::Dtype tsdf_dtype :
+         {core::Dtype::Float32, core::Dtype::Float16}) {
+        t::geometry::TSDFVoxelGrid voxel_grid(
+                {{"tsdf", tsdf_dtype},
+                 {"weight", core::Dtype::UInt16},
+                 {"color", core::Dtype::UInt16}},
+                voxel_size, 0.04f, 16, 1000, device);
+        for (size_t i = 0; i < trajectory->parameters_.size(); ++i) {
+            std::shared_ptr<geometry::Image> depth_legacy =
+                    io::CreateImageFromFile(
+                            fmt::format("{}/RGBD/depth/{:05d}.png",
+                                        std::string(TEST_DATA_DIR), i));
+            std::shared_ptr<geometry::Image> color_legacy =
+                    io::CreateImageFromFile(
+                            fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                        std::string(TEST_DATA_DIR), i));
+            Eigen::Matrix4f extrinsic =
+                    trajectory->parameters_[i].extrinsic_.cast<float>();
+            voxel_grid.Integrate(
+                    t::geometry::Image::FromLegacyImage(*depth_legacy, device),
+                    t::geometry::Image::FromLegacyImage(*color_legacy, device),
+                    intrinsic_t,
+                    core::eigen_converter::EigenMatrixToTensor(extrinsic).To(
+                            device));
+        }
+        pcds.push_back(voxel_grid.ExtractSurfacePoints().ToLegacyPointCloud());
+    }
+
+    auto result = pipelines::registration::EvaluateRegistration(
+            pcds[1], pcds[0], voxel_size);
+    EXPECT_NEAR(static_cast<double>(pcds[1].points_.size()),
+                static_cast<double>(pcds[0].points_.size()),
+                1e-3 * pcds[0].points_.size());
+    EXPECT_NEAR(result.fitness_, 1.0, 1e-3);
+
+    // Float16 tsdf values are only implemented with UInt16 weights.
+    EXPECT_THROW(t::geometry::TSDFVoxelGrid(
+                         {{"tsdf", core::Dtype::Float16},
+                          {"weight", core::Dtype::Float16}},
+                         voxel_size, 0.04f, 16, 1000, device),
+                 std::runtime_error);
+}
 }  // namespace tests
 }  // namespace open3d
@@ -28,12 +28,17 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdio>
+
 #include "open3d/core/Device.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorList.h"
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/io/PointCloudReader.h"
+#include "open3d/t/io/PointCloudWriter.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -76,6 +81,26 @@ const std::vector<ReadWritePCArgs> pcArgs({
          IsAscii::ASCII,
          Compressed::UNCOMPRESSED,
          {{"points", 1e-5}, {"intensities", 1e-5}}},  // 1
+        {"test.ply",
+         IsAscii::BINARY,
+         Compressed::UNCOMPRESSED,
+         {{"points", 1e-5}, {"intensities", 1e-5}}},  // 2
+        {"test.pcd",
+         IsAscii::ASCII,
+         Compressed::UNCOMPRESSED,
+         {{"points", 1e-5}, {"intensities", 1e-5}}},  // 3
+        {"test.pcd",
+         IsAscii::BINARY,
+         Compressed::UNCOMPRESSED,
+         {{"points", 1e-5}, {"intensities", 1e-5}}},  // 4
+        {"test.pcd",
+         IsAscii::BINARY,
+         Compressed::COMPRESSED,
+         {{"points", 1e-5}, {"intensities", 1e-5}}},  // 5
+        {"test.o3dt",
+         IsAscii::BINARY,
+         Compressed::UNCOMPRESSED,
+         {{"points", 0}, {"intensities", 0}}},  // 6
 });
 
 class ReadWriteTPC : public testing::TestWithParam<ReadWritePCArgs> {};
@@ -167,13 +192,15 @@ TEST(TPointCloudIO, ReadPointCloudFromPLY2) {
     EXPECT_EQ(pcd.GetPoints().GetLength(), 7);
 }
 
-// Skip unsupported datatype.
+// char properties are read as Int8.
 TEST(TPointCloudIO, ReadPointCloudFromPLY3) {
     t::geometry::PointCloud pcd;
     t::io::ReadPointCloud(
             std::string(TEST_DATA_DIR) + "/test_sample_wrong_format.ply", pcd,
             {"auto", false, false, true});
-    EXPECT_FALSE(pcd.HasPointAttr("intensity"));
+    EXPECT_EQ(pcd.GetPointAttr("intensity").GetDtype(), core::Dtype::Int8);
+    EXPECT_EQ(pcd.GetPointAttr("intensity").ToFlatVector<int8_t>(),
+              std::vector<int8_t>({100, 127}));
 }
 
 // Custom attributes check.
@@ -186,5 +213,308 @@ TEST(TPointCloudIO, ReadPointCloudFromPLY4) {
     EXPECT_EQ(pcd.GetPointAttr("intensity").GetLength(), 7);
 }
 
+// Colors and extra PCD fields, written in every data format.
+TEST(TPointCloudIO, ReadWritePointCloudPCD) {
+    core::Device device("CPU", 0);
+    t::geometry::PointCloud pc(device);
+    pc.SetPoints(core::Tensor(std::vector<float>{0, 0, 0, 1, 0, 0, 0, 1, 0},
+                              {3, 3}, core::Dtype::Float32, device));
+    pc.SetPointColors(
+            core::Tensor(std::vector<uint8_t>{255, 0, 0, 0, 128, 0, 0, 0, 1},
+                         {3, 3}, core::Dtype::UInt8, device));
+    pc.SetPointAttr("ring", core::Tensor(std::vector<int32_t>{3, -1, 7}, {3, 1},
+                                         core::Dtype::Int32, device));
+    // 1 byte unsigned (U 1) field.
+    pc.SetPointAttr("label",
+                    core::Tensor(std::vector<uint8_t>{0, 255, 128}, {3, 1},
+                                 core::Dtype::UInt8, device));
+
+    for (const auto &format :
+         std::vector<std::pair<bool, bool>>{{true, false}, {false, false},
+                                            {false, true}}) {
+        SCOPED_TRACE(std::to_string(format.first) + " " +
+                     std::to_string(format.second));
+        EXPECT_TRUE(t::io::WritePointCloud(
+                "test_fields.pcd", pc, {format.first, format.second, false}));
+        t::geometry::PointCloud pc_read(device);
+        EXPECT_TRUE(t::io::ReadPointCloud("test_fields.pcd", pc_read,
+                                          {"auto", false, false, false}));
+        for (const char *attr : {"points", "colors", "ring", "label"}) {
+            SCOPED_TRACE(attr);
+            EXPECT_EQ(pc_read.GetPointAttr(attr).GetDtype(),
+                      pc.GetPointAttr(attr).GetDtype());
+            EXPECT_TRUE(pc_read.GetPointAttr(attr).AllClose(
+                    pc.GetPointAttr(attr), 0, 0));
+        }
+    }
+    EXPECT_EQ(std::remove("test_fields.pcd"), 0);
+}
+
+// PCD fields are read with the Dtype of their type and size.
+TEST(TPointCloudIO, ReadPointCloudPCDFieldTypes) {
+    const std::string filename = "test_field_types.pcd";
+    FILE *file = fopen(filename.c_str(), "w");
+    ASSERT_NE(file, nullptr);
+    fprintf(file,
+            "VERSION 0.7\n"
+            "FIELDS x y z a b c d e f\n"
+            "SIZE 8 8 8 1 2 4 8 4 1\n"
+            "TYPE F F F I I U U F U\n"
+            "COUNT 1 1 1 1 1 1 1 1 1\n"
+            "WIDTH 2\n"
+            "HEIGHT 1\n"
+            "POINTS 2\n"
+            "DATA ascii\n"
+            "0 0 0 -1 -300 4000000000 1 0.5 255\n"
+            "1 1 1 2 300 1 2 1.5 7\n");
+    fclose(file);
+
+    t::geometry::PointCloud pc;
+    EXPECT_TRUE(t::io::ReadPointCloud(filename, pc,
+                                      {"auto", false, false, false}));
+    EXPECT_EQ(pc.GetPoints().GetDtype(), core::Dtype::Float64);
+    EXPECT_EQ(pc.GetPointAttr("a").GetDtype(), core::Dtype::Int8);
+    EXPECT_EQ(pc.GetPointAttr("b").GetDtype(), core::Dtype::Int16);
+    EXPECT_EQ(pc.GetPointAttr("c").GetDtype(), core::Dtype::UInt32);
+    EXPECT_EQ(pc.GetPointAttr("e").GetDtype(), core::Dtype::Float32);
+    EXPECT_EQ(pc.GetPointAttr("f").GetDtype(), core::Dtype::UInt8);
+    EXPECT_EQ(pc.GetPointAttr("a").ToFlatVector<int8_t>(),
+              std::vector<int8_t>({-1, 2}));
+    EXPECT_EQ(pc.GetPointAttr("b").ToFlatVector<int16_t>(),
+              std::vector<int16_t>({-300, 300}));
+    EXPECT_EQ(pc.GetPointAttr("c").ToFlatVector<uint32_t>(),
+              std::vector<uint32_t>({4000000000u, 1}));
+    EXPECT_EQ(pc.GetPointAttr("f").ToFlatVector<uint8_t>(),
+              std::vector<uint8_t>({255, 7}));
+    // There is no Dtype for 8 byte unsigned fields.
+    EXPECT_FALSE(pc.HasPointAttr("d"));
+    EXPECT_EQ(std::remove(filename.c_str()), 0);
+}
+
+// Int8, Int16 and UInt32 attributes keep their dtype, Float16 ones are written
+// and read as Float32.
+TEST(TPointCloudIO, ReadWritePointCloudSmallDtypes) {
+    core::Device device("CPU", 0);
+    t::geometry::PointCloud pc(device);
+    pc.SetPoints(core::Tensor(std::vector<float>{0, 0, 0, 1, 0, 0, 0, 1, 0},
+                              {3, 3}, core::Dtype::Float32, device));
+    pc.SetPointAttr("a", core::Tensor(std::vector<int8_t>{-1, 2, 127}, {3, 1},
+                                      core::Dtype::Int8, device));
+    pc.SetPointAttr("b",
+                    core::Tensor(std::vector<int16_t>{-300, 300, 7}, {3, 1},
+                                 core::Dtype::Int16, device));
+    pc.SetPointAttr("c", core::Tensor(std::vector<uint32_t>{2000000000u, 1, 0},
+                                      {3, 1}, core::Dtype::UInt32, device));
+    pc.SetPointAttr("d", core::Tensor(std::vector<float>{0.5f, -1.25f, 3},
+                                      {3, 1}, core::Dtype::Float32, device)
+                                 .To(core::Dtype::Float16));
+
+    for (const std::string &filename :
+         std::vector<std::string>{"test_dtypes.ply", "test_dtypes.pcd"}) {
+        for (bool write_ascii : {true, false}) {
+            SCOPED_TRACE(filename + " " + std::to_string(write_ascii));
+            EXPECT_TRUE(t::io::WritePointCloud(filename, pc,
+                                               {write_ascii, false, false}));
+            t::geometry::PointCloud pc_read(device);
+            EXPECT_TRUE(t::io::ReadPointCloud(filename, pc_read,
+                                              {"auto", false, false, false}));
+            for (const char *attr : {"points", "a", "b", "c"}) {
+                SCOPED_TRACE(attr);
+                EXPECT_EQ(pc_read.GetPointAttr(attr).GetDtype(),
+                          pc.GetPointAttr(attr).GetDtype());
+                EXPECT_TRUE(pc_read.GetPointAttr(attr).AllClose(
+                        pc.GetPointAttr(attr), 0, 0));
+            }
+            EXPECT_EQ(pc_read.GetPointAttr("d").GetDtype(),
+                      core::Dtype::Float32);
+            EXPECT_TRUE(pc_read.GetPointAttr("d").AllClose(
+                    pc.GetPointAttr("d").To(core::Dtype::Float32), 0, 0));
+            EXPECT_EQ(std::remove(filename.c_str()), 0);
+        }
+    }
+}
+
+// Point attributes read from a tensor archive are copy-on-write views of the
+// file.
+TEST(TPointCloudIO, ReadWritePointCloudO3DT) {
+    core::Device device("CPU", 0);
+    t::geometry::PointCloud pc(device);
+    pc.SetPoints(core::Tensor(std::vector<float>{0, 0, 0, 1, 0, 0, 0, 1, 0},
+                              {3, 3}, core::Dtype::Float32, device));
+    pc.SetPointAttr("labels", core::Tensor(std::vector<uint8_t>{3, 1, 7},
+                                           {3}, core::Dtype::UInt8, device));
+    EXPECT_TRUE(t::io::WritePointCloud("test_view.o3dt", pc));
+
+    t::geometry::PointCloud pc_read(device);
+    EXPECT_TRUE(t::io::ReadPointCloud("test_view.o3dt", pc_read,
+                                      {"auto", false, false, false}));
+    for (const char *attr : {"points", "labels"}) {
+        SCOPED_TRACE(attr);
+        EXPECT_EQ(pc_read.GetPointAttr(attr).GetShape(),
+                  pc.GetPointAttr(attr).GetShape());
+        EXPECT_TRUE(pc_read.GetPointAttr(attr).AllClose(pc.GetPointAttr(attr),
+                                                        0, 0));
+    }
+
+    // Writing to the tensors leaves the file unchanged, and the file can be
+    // overwritten while they are in use.
+    pc_read.GetPoints().Fill(5);
+    t::geometry::PointCloud pc_reread(device);
+    EXPECT_TRUE(t::io::ReadPointCloud("test_view.o3dt", pc_reread,
+                                      {"auto", false, false, false}));
+    EXPECT_TRUE(pc_reread.GetPoints().AllClose(pc.GetPoints(), 0, 0));
+    EXPECT_TRUE(t::io::WritePointCloud("test_view.o3dt", pc_read));
+    EXPECT_TRUE(t::io::ReadPointCloud("test_view.o3dt", pc_reread,
+                                      {"auto", false, false, false}));
+    EXPECT_TRUE(pc_reread.GetPoints().AllClose(pc_read.GetPoints(), 0, 0));
+    EXPECT_TRUE(pc_reread.GetPointAttr("labels").AllClose(
+            pc.GetPointAttr("labels"), 0, 0));
+
+    // Files with an unknown dtype are rejected.
+    std::vector<char> bytes;
+    FILE *file = std::fopen("test_view.o3dt", "rb");
+    ASSERT_NE(file, nullptr);
+    char buffer[4096];
+    size_t read_size;
+    while ((read_size = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        bytes.insert(bytes.end(), buffer, buffer + read_size);
+    }
+    std::fclose(file);
+    const std::string dtype_name = "UInt8";
+    auto it = std::search(bytes.begin(), bytes.end(), dtype_name.begin(),
+                          dtype_name.end());
+    ASSERT_NE(it, bytes.end());
+    *(it + 4) = '9';
+    file = std::fopen("test_dtype.o3dt", "wb");
+    ASSERT_NE(file, nullptr);
+    std::fwrite(bytes.data(), 1, bytes.size(), file);
+    std::fclose(file);
+    EXPECT_FALSE(t::io::ReadPointCloud("test_dtype.o3dt", pc_reread,
+                                       {"auto", false, false, false}));
+    EXPECT_EQ(std::remove("test_dtype.o3dt"), 0);
+
+    // The mapped file is released before it is removed.
+    pc_read = t::geometry::PointCloud(device);
+    pc_reread = t::geometry::PointCloud(device);
+    EXPECT_EQ(std::remove("test_view.o3dt"), 0);
+}
+
+// Chunked writing and reading.
+TEST(TPointCloudIO, ChunkedReadWrite) {
+    core::Device device("CPU", 0);
+    const int64_t num_points = 10;
+    std::vector<double> points(3 * num_points);
+    std::vector<double> intensities(num_points);
+    std::vector<uint8_t> colors(3 * num_points);
+    for (int64_t i = 0; i < 3 * num_points; i++) {
+        points[i] = 0.25 * i;
+        colors[i] = uint8_t(7 * i);
+    }
+    for (int64_t i = 0; i < num_points; i++) {
+        intensities[i] = 0.5 * i;
+    }
+    t::geometry::PointCloud pc(device);
+    pc.SetPoints(core::Tensor(points, {num_points, 3}, core::Dtype::Float64,
+                              device));
+    pc.SetPointAttr("intensities",
+                    core::Tensor(intensities, {num_points, 1},
+                                 core::Dtype::Float64, device));
+
+    for (const std::string &filename :
+         std::vector<std::string>{"test_chunked.ply", "test_chunked.pcd",
+                                  "test_chunked.xyz", "test_chunked.xyzi"}) {
+        SCOPED_TRACE(filename);
+        t::geometry::PointCloud file_pc = pc;
+        if (filename == "test_chunked.ply" || filename == "test_chunked.pcd") {
+            file_pc.SetPointColors(core::Tensor(colors, {num_points, 3},
+                                                core::Dtype::UInt8, device));
+        }
+
+        std::unique_ptr<t::io::PointCloudWriter> writer =
+                t::io::PointCloudWriter::Create(filename);
+        ASSERT_TRUE(writer->IsOpened());
+        for (int64_t begin = 0; begin < num_points; begin += 4) {
+            const int64_t end = std::min(begin + 4, num_points);
+            t::geometry::PointCloud chunk(device);
+            for (const auto &it : file_pc.GetPointAttr()) {
+                chunk.SetPointAttr(it.first, it.second.Slice(0, begin, end));
+            }
+            EXPECT_TRUE(writer->WriteChunk(chunk));
+        }
+        EXPECT_EQ(writer->GetNumPoints(), num_points);
+        EXPECT_TRUE(writer->Close());
+
+        // The file reads back as a whole like the point cloud.
+        t::geometry::PointCloud pc_full(device);
+        EXPECT_TRUE(t::io::ReadPointCloud(filename, pc_full,
+                                          {"auto", false, false, false}));
+        for (const auto &it : pc_full.GetPointAttr()) {
+            SCOPED_TRACE(it.first);
+            EXPECT_TRUE(
+                    it.second.AllClose(file_pc.GetPointAttr(it.first), 0, 0));
+        }
+
+        // The chunks are slices of the point cloud read as a whole.
+        std::unique_ptr<t::io::PointCloudReader> reader =
+                t::io::PointCloudReader::Create(filename);
+        ASSERT_TRUE(reader->IsOpened());
+        int64_t begin = 0;
+        while (!reader->IsEOF()) {
+            t::geometry::PointCloud chunk = reader->NextChunk(3);
+            ASSERT_FALSE(chunk.IsEmpty());
+            const int64_t end = begin + chunk.GetPoints().GetLength();
+            EXPECT_EQ(end - begin, std::min<int64_t>(3, num_points - begin));
+            EXPECT_EQ(chunk.GetPointAttr().size(),
+                      pc_full.GetPointAttr().size());
+            for (const auto &it : pc_full.GetPointAttr()) {
+                SCOPED_TRACE(it.first);
+                EXPECT_TRUE(chunk.GetPointAttr(it.first).AllClose(
+                        it.second.Slice(0, begin, end), 0, 0));
+            }
+            begin = end;
+        }
+        EXPECT_EQ(begin, num_points);
+        EXPECT_TRUE(reader->NextChunk(3).IsEmpty());
+        reader->Close();
+        EXPECT_EQ(std::remove(filename.c_str()), 0);
+    }
+}
+
+TEST(TPointCloudIO, ChunkedReadPCD) {
+    core::Device device("CPU", 0);
+    const int64_t num_points = 10;
+    std::vector<float> points(3 * num_points);
+    for (int64_t i = 0; i < 3 * num_points; i++) {
+        points[i] = 0.25f * i;
+    }
+    t::geometry::PointCloud pc(device);
+    pc.SetPoints(core::Tensor(points, {num_points, 3}, core::Dtype::Float32,
+                              device));
+
+    // ascii files are read in chunks, binary_compressed ones only as a whole.
+    EXPECT_TRUE(t::io::WritePointCloud("test_chunked.pcd", pc,
+                                       {true, false, false}));
+    std::unique_ptr<t::io::PointCloudReader> reader =
+            t::io::PointCloudReader::Create("test_chunked.pcd");
+    ASSERT_TRUE(reader->IsOpened());
+    EXPECT_EQ(reader->GetNumPoints(), num_points);
+    int64_t begin = 0;
+    while (!reader->IsEOF()) {
+        t::geometry::PointCloud chunk = reader->NextChunk(4);
+        ASSERT_FALSE(chunk.IsEmpty());
+        const int64_t end = begin + chunk.GetPoints().GetLength();
+        EXPECT_TRUE(chunk.GetPoints().AllClose(
+                pc.GetPoints().Slice(0, begin, end), 0, 0));
+        begin = end;
+    }
+    EXPECT_EQ(begin, num_points);
+    reader->Close();
+
+    EXPECT_TRUE(t::io::WritePointCloud("test_chunked.pcd", pc,
+                                       {false, true, false}));
+    EXPECT_FALSE(reader->Open("test_chunked.pcd"));
+    EXPECT_EQ(std::remove("test_chunked.pcd"), 0);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/TSDFVoxelGridIO.h"
+
+#include <cstdio>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/t/geometry/TSDFVoxelGrid.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(TSDFVoxelGridIO, ReadWriteTSDFVoxelGrid) {
+    const std::unordered_map<std::string, core::Dtype> attr_dtype_map = {
+            {"tsdf", core::Dtype::Float32},
+            {"weight", core::Dtype::UInt16},
+            {"color", core::Dtype::UInt16}};
+    t::geometry::TSDFVoxelGrid voxel_grid(attr_dtype_map, 0.01f, 0.03f, 8,
+                                          20);
+
+    // Blocks with arbitrary voxel bytes.
+    std::shared_ptr<core::Hashmap> hashmap = voxel_grid.GetBlockHashmap();
+    const int64_t num_blocks = 10;
+    std::vector<int32_t> keys;
+    for (int32_t i = 0; i < num_blocks; i++) {
+        keys.insert(keys.end(), {i, -i, 2 * i});
+    }
+    core::SizeVector value_shape = hashmap->GetValueTensor().GetShape();
+    value_shape[0] = num_blocks;
+    std::vector<uint8_t> values(value_shape.NumElements());
+    for (size_t i = 0; i < values.size(); i++) {
+        values[i] = uint8_t(i % 251);
+    }
+    core::Tensor keys_t(keys, {num_blocks, 3}, core::Dtype::Int32);
+    core::Tensor values_t(values, value_shape, core::Dtype::UInt8);
+    core::Tensor addrs, masks;
+    hashmap->Insert(keys_t, values_t, addrs, masks);
+
+    EXPECT_TRUE(t::io::WriteTSDFVoxelGrid("test_voxel_grid.o3dt", voxel_grid));
+    t::geometry::TSDFVoxelGrid voxel_grid_read;
+    EXPECT_TRUE(
+            t::io::ReadTSDFVoxelGrid("test_voxel_grid.o3dt", voxel_grid_read));
+    EXPECT_EQ(voxel_grid_read.GetVoxelSize(), 0.01f);
+    EXPECT_EQ(voxel_grid_read.GetSDFTrunc(), 0.03f);
+    EXPECT_EQ(voxel_grid_read.GetBlockResolution(), 8);
+    EXPECT_EQ(voxel_grid_read.GetBlockCount(), 20);
+    EXPECT_EQ(voxel_grid_read.GetAttrDtypeMap(), attr_dtype_map);
+
+    // Every block is found with its voxels.
+    std::shared_ptr<core::Hashmap> hashmap_read =
+            voxel_grid_read.GetBlockHashmap();
+    EXPECT_EQ(hashmap_read->Size(), num_blocks);
+    hashmap_read->Find(keys_t, addrs, masks);
+    EXPECT_TRUE(masks.All());
+    EXPECT_TRUE(hashmap_read->GetValueTensor()
+                        .IndexGet({addrs.To(core::Dtype::Int64)})
+                        .AllClose(values_t, 0, 0));
+
+    // Other files are rejected.
+    EXPECT_FALSE(t::io::ReadTSDFVoxelGrid(
+            std::string(TEST_DATA_DIR) + "/fragment.pcd", voxel_grid_read));
+    EXPECT_EQ(std::remove("test_voxel_grid.o3dt"), 0);
+}
+
+}  // namespace tests
+}  // namespace open3d
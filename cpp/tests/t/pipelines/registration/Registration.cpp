@@ -28,6 +28,7 @@
 
 #include "core/CoreTest.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/pipelines/registration/Registration.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "tests/UnitTest.h"
@@ -206,6 +207,62 @@ TEST_P(RegistrationPermuteDevices, RegistrationICPPointToPoint) {
     EXPECT_NEAR(reg_p2p_t.inlier_rmse_, reg_p2p_l.inlier_rmse_, 0.0005);
 }
 
+TEST_P(RegistrationPermuteDevices, RegistrationICPReuseTargetIndex) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    std::vector<float> src_points_vec{
+            1.15495,  2.40671, 1.15061,  1.81481,  2.06281, 1.71927, 0.888322,
+            2.05068,  2.04879, 3.78842,  1.70788,  1.30246, 1.8437,  2.22894,
+            0.986237, 2.95706, 2.2018,   0.987878, 1.72644, 1.24356, 1.93486,
+            0.922024, 1.14872, 2.34317,  3.70293,  1.85134, 1.15357, 3.06505,
+            1.30386,  1.55279, 0.634826, 1.04995,  2.47046, 1.40107, 1.37469,
+            1.09687,  2.93002, 1.96242,  1.48532,  3.74384, 1.30258, 1.30244};
+    core::Tensor source_points(src_points_vec, {14, 3}, dtype, device);
+    t::geometry::PointCloud source_device(device);
+    source_device.SetPoints(source_points);
+
+    std::vector<float> target_points_vec{
+            2.41766, 2.05397, 1.74994, 1.37848, 2.19793, 1.66553, 2.24325,
+            2.27183, 1.33708, 3.09898, 1.98482, 1.77401, 1.81615, 1.48337,
+            1.49697, 3.01758, 2.20312, 1.51502, 2.38836, 1.39096, 1.74914,
+            1.30911, 1.4252,  1.37429, 3.16847, 1.39194, 1.90959, 1.59412,
+            1.53304, 1.5804,  1.34342, 2.19027, 1.30075};
+    core::Tensor target_points(target_points_vec, {11, 3}, dtype, device);
+    t::geometry::PointCloud target_device(device);
+    target_device.SetPoints(target_points);
+
+    core::Tensor init_trans_t = core::Tensor::Eye(4, dtype, device);
+    double max_correspondence_dist = 1.25;
+    t::pipelines::registration::ICPConvergenceCriteria criteria(1e-6, 1e-6,
+                                                                5);
+
+    t::pipelines::registration::RegistrationResult reg_p2p_t =
+            t::pipelines::registration::RegistrationICP(
+                    source_device, target_device, max_correspondence_dist,
+                    init_trans_t,
+                    t::pipelines::registration::
+                            TransformationEstimationPointToPoint(),
+                    criteria);
+
+    // The same index is reused for two registrations.
+    core::nns::NearestNeighborSearch target_nns(target_device.GetPoints());
+    EXPECT_TRUE(target_nns.HybridIndex());
+    for (int i = 0; i < 2; ++i) {
+        t::pipelines::registration::RegistrationResult reg_p2p_reuse_t =
+                t::pipelines::registration::RegistrationICP(
+                        source_device, target_device, target_nns,
+                        max_correspondence_dist, init_trans_t,
+                        t::pipelines::registration::
+                                TransformationEstimationPointToPoint(),
+                        criteria);
+        EXPECT_DOUBLE_EQ(reg_p2p_reuse_t.fitness_, reg_p2p_t.fitness_);
+        EXPECT_DOUBLE_EQ(reg_p2p_reuse_t.inlier_rmse_, reg_p2p_t.inlier_rmse_);
+        EXPECT_TRUE(reg_p2p_reuse_t.transformation_.AllClose(
+                reg_p2p_t.transformation_));
+    }
+}
+
 TEST_P(RegistrationPermuteDevices, RegistrationICPPointToPlane) {
     core::Device device = GetParam();
     core::Dtype dtype = core::Dtype::Float32;